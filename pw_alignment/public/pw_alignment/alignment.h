@@ -18,6 +18,7 @@
 // be removed and we could just inline the using statements.
 
 #include <atomic>
+#include <cstddef>
 #if __cplusplus >= 202002L
 #include <bit>
 #endif  // __cplusplus >= 202002L
@@ -104,4 +105,43 @@ struct [[gnu::aligned(bit_ceil(sizeof(T)))]] NaturallyAligned : public T {
 template <typename T>
 using AlignedAtomic = std::atomic<NaturallyAligned<T>>;
 
+/// @ingroup pw_alignment
+///
+/// The alignment used to keep objects on separate cache lines on the
+/// supported targets. `std::hardware_destructive_interference_size` is
+/// deliberately not used, since its value is ABI-unstable across compiler
+/// versions and tuning flags.
+inline constexpr size_t kDestructiveInterferenceSize = 64;
+
+/// @ingroup pw_alignment
+///
+/// An atomic padded and aligned to its own cache line, eliminating false
+/// sharing: two `CacheAlignedAtomic` variables updated by different cores
+/// never bounce the same cache line between them, unlike adjacent plain
+/// atomics. Use for hot cross-core state such as producer/consumer indices
+/// and per-core counters; do not use for large arrays of rarely-written
+/// flags, where the 64-byte footprint per value is wasted RAM.
+///
+/// Example:
+///
+/// @code{.cpp}
+///   #include "pw_alignment/alignment.h"
+///
+///   // Updated by different cores; padded so neither write stalls the other.
+///   pw::CacheAlignedAtomic<uint32_t> write_index{};
+///   pw::CacheAlignedAtomic<uint32_t> read_index{};
+/// @endcode
+template <typename T>
+struct alignas(kDestructiveInterferenceSize) CacheAlignedAtomic
+    : public std::atomic<T> {
+  using std::atomic<T>::atomic;
+  using std::atomic<T>::operator=;
+
+ private:
+  // Pad the object to a full cache line so the next object cannot share it.
+  [[maybe_unused]] std::byte padding_[kDestructiveInterferenceSize -
+                                      sizeof(std::atomic<T>) %
+                                          kDestructiveInterferenceSize];
+};
+
 }  // namespace pw
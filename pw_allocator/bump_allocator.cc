@@ -38,8 +38,11 @@ void* BumpAllocator::DoAllocate(Layout layout) {
 void BumpAllocator::DoDeallocate(void*) {}
 
 void BumpAllocator::Reset() {
-  if (owned_ != nullptr) {
-    owned_->Destroy();
+  // Destroy the whole chain of owned objects, newest first.
+  while (owned_ != nullptr) {
+    internal::GenericOwned* owned = owned_;
+    owned_ = owned->next();
+    owned->Destroy();
   }
   remaining_ = ByteSpan();
 }
@@ -71,6 +71,56 @@ TEST(BumpAllocatorTest, AllocateFailsWhenExhausted) {
   EXPECT_EQ(ptr, nullptr);
 }
 
+TEST(BumpAllocatorTest, CheckpointRollbackReleasesMemoryAndOwnedObjects) {
+  static int live_objects = 0;
+  struct Tracked {
+    Tracked() { ++live_objects; }
+    ~Tracked() { --live_objects; }
+  };
+
+  alignas(Tracked) std::array<std::byte, 256> buffer;
+  BumpAllocator allocator(buffer);
+
+  void* before = allocator.Allocate(Layout(16, 1));
+  ASSERT_NE(before, nullptr);
+
+  const BumpAllocator::Checkpoint checkpoint = allocator.SaveCheckpoint();
+  Tracked* owned = allocator.NewOwned<Tracked>();
+  ASSERT_NE(owned, nullptr);
+  void* scratch = allocator.Allocate(Layout(32, 1));
+  ASSERT_NE(scratch, nullptr);
+  EXPECT_EQ(live_objects, 1);
+
+  allocator.Rollback(checkpoint);
+  EXPECT_EQ(live_objects, 0);  // The owned object's destructor ran.
+
+  // The rolled-back memory is reusable: the next allocation lands at or
+  // before the rolled-back object (NewOwned allocated its wrapper first).
+  void* again = allocator.Allocate(Layout(16, 1));
+  ASSERT_NE(again, nullptr);
+  EXPECT_LE(reinterpret_cast<uintptr_t>(again),
+            reinterpret_cast<uintptr_t>(owned));
+}
+
+TEST(BumpAllocatorTest, ResetDestroysAllOwnedObjects) {
+  static int live_objects = 0;
+  struct Tracked {
+    Tracked() { ++live_objects; }
+    ~Tracked() { --live_objects; }
+  };
+
+  alignas(Tracked) std::array<std::byte, 256> buffer;
+  {
+    BumpAllocator allocator(buffer);
+    ASSERT_NE(allocator.NewOwned<Tracked>(), nullptr);
+    ASSERT_NE(allocator.NewOwned<Tracked>(), nullptr);
+    ASSERT_NE(allocator.NewOwned<Tracked>(), nullptr);
+    EXPECT_EQ(live_objects, 3);
+  }
+  // Every owned object in the chain is destroyed, not just the newest.
+  EXPECT_EQ(live_objects, 0);
+}
+
 TEST(BumpAllocatorTest, DeallocateDoesNothing) {
   alignas(16) std::array<std::byte, 256> buffer;
   BumpAllocator allocator(buffer);
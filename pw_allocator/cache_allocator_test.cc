@@ -0,0 +1,84 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/cache_allocator.h"
+
+#include "pw_allocator/testing.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::allocator {
+namespace {
+
+class CacheAllocatorTest : public ::testing::Test {
+ protected:
+  test::AllocatorForTest<2048> backing_;
+  CacheAllocator<> cache_{backing_};
+};
+
+TEST_F(CacheAllocatorTest, ReusesFreedAllocationsOfSameClass) {
+  void* first = cache_.Allocate(Layout(48, alignof(std::max_align_t)));
+  ASSERT_NE(first, nullptr);
+  cache_.Deallocate(first);
+
+  // An allocation in the same size class is served from the cache without
+  // touching the backing allocator.
+  backing_.ResetParameters();
+  void* second = cache_.Allocate(Layout(40, alignof(std::max_align_t)));
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(backing_.allocate_size(), 0u);
+  cache_.Deallocate(second);
+}
+
+TEST_F(CacheAllocatorTest, ReleaseAllReturnsMemory) {
+  void* ptr = cache_.Allocate(Layout(64, alignof(std::max_align_t)));
+  ASSERT_NE(ptr, nullptr);
+  cache_.Deallocate(ptr);
+
+  cache_.ReleaseAll();
+  EXPECT_EQ(backing_.deallocate_ptr(), ptr);
+
+  // After releasing, the next allocation comes from the backing allocator.
+  void* fresh = cache_.Allocate(Layout(64, alignof(std::max_align_t)));
+  EXPECT_NE(backing_.allocate_size(), 0u);
+  cache_.Deallocate(fresh);
+}
+
+TEST_F(CacheAllocatorTest, DistinctClassesDoNotMix) {
+  void* small = cache_.Allocate(Layout(24));
+  void* large = cache_.Allocate(Layout(256));
+  ASSERT_NE(small, nullptr);
+  ASSERT_NE(large, nullptr);
+  cache_.Deallocate(small);
+  cache_.Deallocate(large);
+
+  // A small request is never served by the cached large allocation.
+  void* small_again = cache_.Allocate(Layout(24));
+  EXPECT_NE(small_again, large);
+  // The large request reuses the cached large allocation.
+  void* large_again = cache_.Allocate(Layout(256));
+  EXPECT_EQ(large_again, large);
+  cache_.Deallocate(small_again);
+  cache_.Deallocate(large_again);
+}
+
+TEST_F(CacheAllocatorTest, OversizedAllocationsBypassCache) {
+  void* big = cache_.Allocate(Layout(1500));
+  ASSERT_NE(big, nullptr);
+  cache_.Deallocate(big);
+  // The deallocation went straight to the backing allocator.
+  EXPECT_EQ(backing_.deallocate_ptr(), big);
+}
+
+}  // namespace
+}  // namespace pw::allocator
@@ -0,0 +1,141 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/compacting_allocator.h"
+
+#include <cstring>
+
+#include "pw_allocator/first_fit.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::allocator {
+namespace {
+
+constexpr Layout kSmall(64, 4);
+
+class CompactingAllocatorTest : public ::testing::Test {
+ protected:
+  CompactingAllocatorTest() : underlying_(buffer_), compacting_(underlying_) {}
+
+  alignas(16) std::byte buffer_[1024] = {};
+  FirstFitAllocator<> underlying_;
+  CompactingAllocator<16> compacting_;
+};
+
+TEST_F(CompactingAllocatorTest, AllocateResolveFree) {
+  const auto handle = compacting_.Allocate(kSmall);
+  ASSERT_NE(handle, decltype(compacting_)::kInvalidHandle);
+  void* ptr = compacting_.Resolve(handle);
+  ASSERT_NE(ptr, nullptr);
+  std::memset(ptr, 0x5a, kSmall.size());
+  compacting_.Free(handle);
+}
+
+TEST_F(CompactingAllocatorTest, DefragmentMergesFreeSpace) {
+  // Fill the region with alternating allocations, then free every other one
+  // to fragment the free space.
+  decltype(compacting_)::Handle handles[16];
+  size_t count = 0;
+  while (true) {
+    const auto handle = compacting_.Allocate(kSmall);
+    if (handle == decltype(compacting_)::kInvalidHandle) {
+      break;
+    }
+    handles[count++] = handle;
+  }
+  ASSERT_GE(count, 4u);
+  size_t freed_bytes = 0;
+  for (size_t i = 0; i < count; i += 2) {
+    compacting_.Free(handles[i]);
+    handles[i] = decltype(compacting_)::kInvalidHandle;
+    freed_bytes += kSmall.size();
+  }
+
+  // The free space is fragmented into small holes: a large allocation fails.
+  const Layout large(freed_bytes - kSmall.size(), 4);
+  void* premature = underlying_.Allocate(large);
+  EXPECT_EQ(premature, nullptr);
+  if (premature != nullptr) {
+    underlying_.Deallocate(premature);
+  }
+
+  // Compaction slides survivors down and re-merges the holes.
+  const auto stats = compacting_.Defragment(/* max_move_bytes= */ 1024);
+  EXPECT_GT(stats.moved_allocations, 0u);
+  EXPECT_EQ(stats.moved_bytes, stats.moved_allocations * kSmall.size());
+
+  void* merged = underlying_.Allocate(large);
+  EXPECT_NE(merged, nullptr);
+  if (merged != nullptr) {
+    underlying_.Deallocate(merged);
+  }
+}
+
+TEST_F(CompactingAllocatorTest, DefragmentPreservesContentsAndNotifies) {
+  const auto keep = compacting_.Allocate(kSmall);
+  const auto hole = compacting_.Allocate(kSmall);
+  const auto moves = compacting_.Allocate(kSmall);
+  ASSERT_NE(moves, decltype(compacting_)::kInvalidHandle);
+
+  std::memset(compacting_.Resolve(moves), 0xa5, kSmall.size());
+  compacting_.Free(hole);
+
+  struct {
+    const void* from = nullptr;
+    void* to = nullptr;
+    size_t size = 0;
+  } seen;
+  compacting_.set_relocation_listener(
+      [&seen](const void* from, void* to, size_t size) {
+        seen.from = from;
+        seen.to = to;
+        seen.size = size;
+      });
+
+  void* const old_ptr = compacting_.Resolve(moves);
+  const auto stats = compacting_.Defragment(1024);
+  ASSERT_EQ(stats.moved_allocations, 1u);
+
+  void* const new_ptr = compacting_.Resolve(moves);
+  EXPECT_NE(new_ptr, old_ptr);
+  EXPECT_LT(new_ptr, old_ptr);
+  EXPECT_EQ(seen.from, old_ptr);
+  EXPECT_EQ(seen.to, new_ptr);
+  EXPECT_EQ(seen.size, kSmall.size());
+
+  // The payload moved with the allocation.
+  auto* bytes = static_cast<const unsigned char*>(new_ptr);
+  EXPECT_EQ(bytes[0], 0xa5);
+  EXPECT_EQ(bytes[kSmall.size() - 1], 0xa5);
+
+  compacting_.Free(keep);
+  compacting_.Free(moves);
+}
+
+TEST_F(CompactingAllocatorTest, DefragmentRespectsBudget) {
+  const auto first = compacting_.Allocate(kSmall);
+  const auto hole = compacting_.Allocate(kSmall);
+  const auto second = compacting_.Allocate(kSmall);
+  ASSERT_NE(second, decltype(compacting_)::kInvalidHandle);
+  compacting_.Free(hole);
+  static_cast<void>(first);
+
+  // A budget smaller than one allocation moves nothing.
+  const auto stats = compacting_.Defragment(kSmall.size() - 1);
+  EXPECT_EQ(stats.moved_allocations, 0u);
+  EXPECT_EQ(stats.moved_bytes, 0u);
+}
+
+}  // namespace
+}  // namespace pw::allocator
@@ -45,6 +45,34 @@ class FirstFitAllocatorTest : public BlockAllocatorTest<FirstFitAllocator> {
   FirstFitAllocator allocator_;
 };
 
+TEST_F(FirstFitAllocatorTest, DeferredCoalescing) {
+  FirstFitAllocator allocator(GetBytes());
+  allocator.set_deferred_coalescing(true);
+
+  // Fill most of the region with three adjacent allocations.
+  constexpr pw::allocator::Layout kLayout(64, 1);
+  void* a = allocator.Allocate(kLayout);
+  void* b = allocator.Allocate(kLayout);
+  void* c = allocator.Allocate(kLayout);
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  ASSERT_NE(c, nullptr);
+
+  // Deferred frees are O(1) and leave the memory unavailable until flushed.
+  allocator.Deallocate(a);
+  allocator.Deallocate(b);
+
+  // A request needing the combined space triggers an automatic flush, which
+  // coalesces the two freed neighbors.
+  void* combined = allocator.Allocate(pw::allocator::Layout(120, 1));
+  EXPECT_NE(combined, nullptr);
+
+  allocator.Deallocate(combined);
+  allocator.Deallocate(c);
+  allocator.FlushDeferredFrees();
+  allocator.set_deferred_coalescing(false);
+}
+
 TEST_F(FirstFitAllocatorTest, AutomaticallyInit) {
   FirstFitAllocator allocator(GetBytes());
   AutomaticallyInit(allocator);
@@ -0,0 +1,78 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/leak_tracking_allocator.h"
+
+#include <cstdint>
+
+#include "pw_allocator/testing.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::allocator {
+namespace {
+
+class LeakTrackingAllocatorTest : public ::testing::Test {
+ protected:
+  test::AllocatorForTest<2048> backing_;
+  LeakTrackingAllocator<1> tracker_{backing_};  // Sample every allocation.
+};
+
+TEST_F(LeakTrackingAllocatorTest, TracksOutstandingAllocations) {
+  void* a = tracker_.Allocate(Layout(32));
+  void* b = tracker_.Allocate(Layout(64));
+  ASSERT_NE(a, nullptr);
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(tracker_.outstanding_allocations(), 2u);
+
+  struct {
+    size_t total = 0;
+    size_t count = 0;
+    bool saw_a = false;
+    void* a;
+  } visit;
+  visit.a = a;
+  tracker_.ForEachOutstanding(
+      [&visit](const LeakTrackingAllocator<1>::AllocationInfo& info) {
+        visit.total += info.size;
+        visit.count += 1;
+        visit.saw_a = visit.saw_a || info.ptr == visit.a;
+        EXPECT_NE(info.capture_site, nullptr);  // Every allocation sampled.
+      });
+  EXPECT_EQ(visit.count, 2u);
+  EXPECT_EQ(visit.total, 96u);
+  EXPECT_TRUE(visit.saw_a);
+
+  tracker_.Deallocate(a);
+  EXPECT_EQ(tracker_.outstanding_allocations(), 1u);
+  tracker_.Deallocate(b);
+  EXPECT_EQ(tracker_.outstanding_allocations(), 0u);
+}
+
+TEST_F(LeakTrackingAllocatorTest, RespectsAlignment) {
+  void* ptr = tracker_.Allocate(Layout(64, 64));
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+  tracker_.Deallocate(ptr);
+}
+
+TEST_F(LeakTrackingAllocatorTest, DataIsUsable) {
+  auto* value = static_cast<uint32_t*>(tracker_.Allocate(Layout::Of<uint32_t>()));
+  ASSERT_NE(value, nullptr);
+  *value = 0x12345678;
+  EXPECT_EQ(*value, 0x12345678u);
+  tracker_.Deallocate(value);
+}
+
+}  // namespace
+}  // namespace pw::allocator
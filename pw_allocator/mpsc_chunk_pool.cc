@@ -0,0 +1,101 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/mpsc_chunk_pool.h"
+
+#include <algorithm>
+#include <new>
+
+#include "lib/stdcompat/bit.h"
+#include "pw_assert/check.h"
+#include "pw_bytes/alignment.h"
+
+namespace pw::allocator {
+
+static Layout EnsurePointerLayout(const Layout& layout) {
+  return Layout(std::max(layout.size(), sizeof(void*)),
+                std::max(layout.alignment(), alignof(void*)));
+}
+
+MpscChunkPool::MpscChunkPool(ByteSpan region, const Layout& layout)
+    : Pool(kCapabilities, layout),
+      allocated_layout_(EnsurePointerLayout(layout)) {
+  Result<ByteSpan> result =
+      GetAlignedSubspan(region, allocated_layout_.alignment());
+  PW_CHECK_OK(result.status());
+  start_ = cpp20::bit_cast<uintptr_t>(region.data());
+  end_ = start_ + region.size() - (region.size() % allocated_layout_.size());
+  region = result.value();
+  std::byte* current = region.data();
+  std::byte* end = current + region.size();
+  next_.store(current, std::memory_order_relaxed);
+  std::byte** next = &current;
+  while (current < end) {
+    next = std::launder(reinterpret_cast<std::byte**>(current));
+    current += allocated_layout_.size();
+    *next = current;
+  }
+  *next = nullptr;
+}
+
+void* MpscChunkPool::DoAllocate() {
+  // Single-consumer pop: concurrent pushes may change the head, which makes
+  // the compare-exchange retry; with only one popper the observed head cannot
+  // be recycled underneath us.
+  std::byte* head = next_.load(std::memory_order_acquire);
+  while (head != nullptr) {
+    std::byte* after = *(std::launder(reinterpret_cast<std::byte**>(head)));
+    if (next_.compare_exchange_weak(head,
+                                    after,
+                                    std::memory_order_acquire,
+                                    std::memory_order_acquire)) {
+      return head;
+    }
+  }
+  return nullptr;
+}
+
+void MpscChunkPool::DoDeallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  std::byte** next = std::launder(reinterpret_cast<std::byte**>(ptr));
+  std::byte* head = next_.load(std::memory_order_relaxed);
+  do {
+    *next = head;
+  } while (!next_.compare_exchange_weak(head,
+                                        static_cast<std::byte*>(ptr),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+Result<Layout> MpscChunkPool::DoGetInfo(InfoType info_type,
+                                        const void* ptr) const {
+  if (info_type == InfoType::kCapacity) {
+    return Layout(end_ - start_, allocated_layout_.alignment());
+  }
+  auto addr = cpp20::bit_cast<uintptr_t>(ptr);
+  if (addr < start_ || end_ <= addr) {
+    return Status::OutOfRange();
+  }
+  if ((addr - start_) % allocated_layout_.size() != 0) {
+    return Status::OutOfRange();
+  }
+  if (info_type == InfoType::kRecognizes) {
+    return Layout();
+  }
+  return Status::Unimplemented();
+}
+
+}  // namespace pw::allocator
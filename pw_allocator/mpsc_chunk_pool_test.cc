@@ -0,0 +1,67 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/mpsc_chunk_pool.h"
+
+#include <array>
+#include <cstdint>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::allocator {
+namespace {
+
+constexpr Layout kChunkLayout(64, alignof(std::max_align_t));
+
+TEST(MpscChunkPool, AllocatesAndExhausts) {
+  alignas(std::max_align_t) std::array<std::byte, 64 * 4> region = {};
+  MpscChunkPool pool(region, kChunkLayout);
+
+  std::array<void*, 4> chunks = {};
+  for (void*& chunk : chunks) {
+    chunk = pool.Allocate();
+    ASSERT_NE(chunk, nullptr);
+  }
+  EXPECT_EQ(pool.Allocate(), nullptr);
+
+  for (void* chunk : chunks) {
+    pool.Deallocate(chunk);
+  }
+  EXPECT_NE(pool.Allocate(), nullptr);
+}
+
+TEST(MpscChunkPool, ReusesFreedChunksLifo) {
+  alignas(std::max_align_t) std::array<std::byte, 64 * 2> region = {};
+  MpscChunkPool pool(region, kChunkLayout);
+
+  void* first = pool.Allocate();
+  ASSERT_NE(first, nullptr);
+  pool.Deallocate(first);
+  EXPECT_EQ(pool.Allocate(), first);
+}
+
+TEST(MpscChunkPool, ChunksAreAligned) {
+  alignas(std::max_align_t) std::array<std::byte, 64 * 3> region = {};
+  MpscChunkPool pool(region, kChunkLayout);
+  for (int i = 0; i < 3; ++i) {
+    void* chunk = pool.Allocate();
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(chunk) %
+                  alignof(std::max_align_t),
+              0u);
+  }
+}
+
+}  // namespace
+}  // namespace pw::allocator
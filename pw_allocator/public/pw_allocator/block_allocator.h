@@ -14,6 +14,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 
 #include "pw_allocator/allocator.h"
 #include "pw_allocator/block/basic.h"
@@ -112,6 +113,23 @@ class BlockAllocator : public internal::GenericBlockAllocator {
   /// Returns fragmentation information for the block allocator's memory region.
   Fragmentation MeasureFragmentation() const;
 
+  /// Enables or disables deferred coalescing. When enabled, `Deallocate`
+  /// records the free in O(1) without merging neighbors or touching the free
+  /// lists, bounding free latency (e.g. adjacent to ISRs). Pending frees are
+  /// coalesced by `FlushDeferredFrees()`, which should be called from a
+  /// non-latency-sensitive context; allocation also flushes automatically if
+  /// it would otherwise fail. Memory from pending frees is not reusable until
+  /// flushed.
+  void set_deferred_coalescing(bool enabled) {
+    defer_coalescing_ = enabled;
+    if (!enabled) {
+      FlushDeferredFrees();
+    }
+  }
+
+  /// Frees and merges all deferred deallocations.
+  void FlushDeferredFrees();
+
   /// Sets the memory region to be used by this allocator.
   ///
   /// This method will instantiate an initial block using the memory region.
@@ -225,6 +243,11 @@ class BlockAllocator : public internal::GenericBlockAllocator {
   /// @param  block   The block being freed.
   virtual void RecycleBlock(BlockType&) {}
 
+  /// Performs the actual free of a block, merging it with free neighbors.
+  /// Called directly by `DoDeallocate`, or during `FlushDeferredFrees` when
+  /// deferred coalescing is enabled.
+  void DeallocateBlock(BlockType* block);
+
   /// Returns if the previous block exists and is free.
   static bool PrevIsFree(const BlockType* block) {
     auto* prev = block->Prev();
@@ -244,6 +267,9 @@ class BlockAllocator : public internal::GenericBlockAllocator {
   // Represents the range of blocks for this allocator.
   size_t capacity_ = 0;
   size_t allocated_ = 0;
+  // Head of the deferred-free list, threaded through freed allocations.
+  void* deferred_frees_ = nullptr;
+  bool defer_coalescing_ = false;
   BlockType* first_ = nullptr;
   BlockType* last_ = nullptr;
   uint16_t unpoisoned_ = 0;
@@ -320,6 +346,11 @@ void* BlockAllocator<BlockType>::DoAllocate(Layout layout) {
 
   PW_ASSERT(last_->Next() == nullptr);
   auto result = ChooseBlock(layout);
+  if (!result.ok() && deferred_frees_ != nullptr) {
+    // Coalescing pending frees may produce a suitable block.
+    FlushDeferredFrees();
+    result = ChooseBlock(layout);
+  }
   if (!result.ok()) {
     // No valid block for request.
     return nullptr;
@@ -360,6 +391,35 @@ void BlockAllocator<BlockType>::DoDeallocate(void* ptr) {
     CrashOnDoubleFree(block);
   }
 
+  if (defer_coalescing_) {
+    // Record the free in O(1) and return; the block stays in the allocated
+    // state and is actually freed and merged during FlushDeferredFrees().
+    // The pending list is threaded through the blocks' usable space, so the
+    // smallest possible inner size must fit a pointer (the outer size also
+    // counts the header, which cannot hold the link).
+    static_assert(
+        BlockType::kMinOuterSize - BlockType::kBlockOverhead >= sizeof(void*));
+    std::memcpy(ptr, &deferred_frees_, sizeof(void*));
+    deferred_frees_ = ptr;
+    return;
+  }
+
+  DeallocateBlock(block);
+}
+
+template <typename BlockType>
+void BlockAllocator<BlockType>::FlushDeferredFrees() {
+  while (deferred_frees_ != nullptr) {
+    void* ptr = deferred_frees_;
+    std::memcpy(&deferred_frees_, ptr, sizeof(void*));
+    auto result = FromUsableSpace(ptr);
+    PW_ASSERT(result.ok());
+    DeallocateBlock(*result);
+  }
+}
+
+template <typename BlockType>
+void BlockAllocator<BlockType>::DeallocateBlock(BlockType* block) {
   // Neighboring blocks may be merged when freeing.
   if (auto* prev = block->Prev(); prev != nullptr && prev->IsFree()) {
     ReserveBlock(*prev);
@@ -27,6 +27,7 @@ class GenericOwned {
  public:
   virtual ~GenericOwned() = default;
   void set_next(GenericOwned* next) { next_ = next; }
+  GenericOwned* next() const { return next_; }
   void Destroy() { DoDestroy(); }
 
  private:
@@ -110,6 +111,44 @@ class BumpAllocator : public Allocator {
     return ptr;
   }
 
+  /// Opaque marker of the allocator's state, captured by `SaveCheckpoint` and
+  /// restored by `Rollback`.
+  class Checkpoint {
+   private:
+    friend class BumpAllocator;
+    size_t remaining_size_;
+    size_t allocated_;
+    internal::GenericOwned* owned_;
+  };
+
+  /// Captures the current allocation position. Allocations made after the
+  /// checkpoint can be released together with `Rollback`, making the arena
+  /// usable for nested request-scoped work (e.g. per-message scratch inside a
+  /// per-connection arena).
+  Checkpoint SaveCheckpoint() const {
+    Checkpoint checkpoint;
+    checkpoint.remaining_size_ = remaining_.size();
+    checkpoint.allocated_ = allocated_;
+    checkpoint.owned_ = owned_;
+    return checkpoint;
+  }
+
+  /// Releases every allocation made since the checkpoint was saved, invoking
+  /// the destructors of owned objects created after it (newest first).
+  /// Checkpoints must be rolled back in reverse order of creation, and a
+  /// checkpoint is invalidated by rolling back an earlier one.
+  void Rollback(const Checkpoint& checkpoint) {
+    while (owned_ != checkpoint.owned_) {
+      internal::GenericOwned* owned = owned_;
+      owned_ = owned->next();
+      owned->Destroy();
+    }
+    remaining_ = ByteSpan(
+        remaining_.data() - (checkpoint.remaining_size_ - remaining_.size()),
+        checkpoint.remaining_size_);
+    allocated_ = checkpoint.allocated_;
+  }
+
   /// Constructs and object of type `T` from the given `args`, and wraps it in a
   /// `UniquePtr`
   ///
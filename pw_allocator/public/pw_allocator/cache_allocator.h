@@ -0,0 +1,144 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "pw_allocator/allocator.h"
+#include "pw_allocator/capability.h"
+#include "pw_allocator/layout.h"
+
+namespace pw::allocator {
+
+/// Size-segregated cache in front of another allocator.
+///
+/// Freed allocations are kept on per-size-class LIFO free lists (embedded in
+/// the freed memory itself) and reused for subsequent allocations of the same
+/// class, skipping the underlying allocator's bookkeeping and, importantly,
+/// its lock. Size classes are powers of two from `sizeof(void*) * 2` up to
+/// `kMaxCachedSize`, with at most `kMaxCachedPerClass` entries retained per
+/// class to bound the memory held by the cache.
+///
+/// This class is not synchronized. The intended use as a thread cache is one
+/// `CacheAllocator` per thread, all backed by a shared
+/// `SynchronizedAllocator` (e.g. over a `TlsfAllocator`): the per-thread hot
+/// path is then lock-free, and only cache misses and evictions take the
+/// shared allocator's lock.
+///
+/// The underlying allocator must implement `GetAllocatedLayout` (as block
+/// allocators such as `TlsfAllocator` do); allocations whose layout cannot be
+/// recovered, or whose alignment exceeds `alignof(std::max_align_t)`, bypass
+/// the cache.
+template <size_t kMaxCachedSize = 512, size_t kMaxCachedPerClass = 8>
+class CacheAllocator : public Allocator {
+ public:
+  explicit constexpr CacheAllocator(Allocator& allocator)
+      : Allocator(allocator.capabilities()), allocator_(allocator) {}
+
+  ~CacheAllocator() override { ReleaseAll(); }
+
+  /// Returns all cached allocations to the underlying allocator, e.g. before
+  /// destroying the cache or when the system is low on memory.
+  void ReleaseAll() {
+    for (size_t i = 0; i < kNumClasses; ++i) {
+      while (free_lists_[i] != nullptr) {
+        FreeNode* node = free_lists_[i];
+        free_lists_[i] = node->next;
+        allocator_.Deallocate(node);
+      }
+      cached_counts_[i] = 0;
+    }
+  }
+
+ private:
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  static constexpr size_t kMinClassSize = sizeof(void*) * 2;
+  static constexpr size_t kNumClasses = []() {
+    size_t classes = 0;
+    for (size_t size = kMinClassSize; size <= kMaxCachedSize; size *= 2) {
+      ++classes;
+    }
+    return classes;
+  }();
+
+  static_assert(kNumClasses > 0, "kMaxCachedSize is too small to cache");
+
+  // Returns the smallest class whose size is >= `size`, or kNumClasses if the
+  // size is not cacheable.
+  static constexpr size_t ClassFor(size_t size) {
+    size_t class_size = kMinClassSize;
+    for (size_t i = 0; i < kNumClasses; ++i, class_size *= 2) {
+      if (size <= class_size) {
+        return i;
+      }
+    }
+    return kNumClasses;
+  }
+
+  static constexpr size_t ClassSize(size_t index) {
+    return kMinClassSize << index;
+  }
+
+  void* DoAllocate(Layout layout) override {
+    if (layout.alignment() <= alignof(std::max_align_t)) {
+      const size_t index = ClassFor(layout.size());
+      if (index < kNumClasses && free_lists_[index] != nullptr) {
+        FreeNode* node = free_lists_[index];
+        free_lists_[index] = node->next;
+        cached_counts_[index] -= 1;
+        return node;
+      }
+      if (index < kNumClasses) {
+        // Round up to the class size so the allocation is reusable for any
+        // request in this class when it is freed.
+        return allocator_.Allocate(
+            Layout(ClassSize(index), layout.alignment()));
+      }
+    }
+    return allocator_.Allocate(layout);
+  }
+
+  void DoDeallocate(void* ptr) override {
+    const Result<Layout> layout = GetAllocatedLayout(allocator_, ptr);
+    if (layout.ok() && layout->alignment() <= alignof(std::max_align_t)) {
+      // Cache under the largest class the allocation can serve.
+      const size_t index = ClassFor(layout->size());
+      const size_t floor_index =
+          index < kNumClasses && ClassSize(index) <= layout->size()
+              ? index
+              : (index == 0 ? kNumClasses : index - 1);
+      if (floor_index < kNumClasses &&
+          ClassSize(floor_index) <= layout->size() &&
+          layout->size() <= 2 * kMaxCachedSize &&
+          cached_counts_[floor_index] < kMaxCachedPerClass) {
+        FreeNode* node = new (ptr) FreeNode{free_lists_[floor_index]};
+        free_lists_[floor_index] = node;
+        cached_counts_[floor_index] += 1;
+        return;
+      }
+    }
+    allocator_.Deallocate(ptr);
+  }
+
+  Allocator& allocator_;
+  FreeNode* free_lists_[kNumClasses] = {};
+  uint8_t cached_counts_[kNumClasses] = {};
+};
+
+}  // namespace pw::allocator
@@ -0,0 +1,145 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_allocator/compacting_allocator.h
+///
+/// Opt-in compaction for relocatable allocations. `Fragmentation` reports how
+/// fragmented a block allocator's region is, but nothing acts on it: on
+/// long-running devices the largest contiguous free block shrinks until large
+/// allocations fail and force a reboot. `CompactingAllocator` adds a
+/// handle-based allocation mode where the layer may *move* allocations during
+/// explicit `Defragment(budget)` calls, re-merging free space.
+///
+/// Allocations are addressed by handle and resolved to a pointer with
+/// `Resolve()`; pointers are stable only between `Defragment` calls, which is
+/// what makes relocation safe. Compaction works with any underlying
+/// placement-ordered allocator (e.g. `FirstFitAllocator`): each candidate is
+/// reallocated, which lands in the lowest suitable gap, copied, and freed --
+/// moves that would not lower the allocation are rolled back.
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include "pw_allocator/allocator.h"
+#include "pw_allocator/layout.h"
+#include "pw_function/function.h"
+
+namespace pw::allocator {
+
+/// Handle-based compacting layer over an allocator, tracking up to
+/// `kMaxAllocations` live allocations.
+template <size_t kMaxAllocations>
+class CompactingAllocator {
+ public:
+  using Handle = size_t;
+  static constexpr Handle kInvalidHandle = static_cast<Handle>(-1);
+
+  /// Counters describing one `Defragment` pass.
+  struct DefragStats {
+    /// Allocations relocated to a lower address.
+    size_t moved_allocations;
+    /// Payload bytes copied while relocating.
+    size_t moved_bytes;
+  };
+
+  explicit constexpr CompactingAllocator(Allocator& allocator)
+      : allocator_(allocator) {}
+
+  ~CompactingAllocator() {
+    for (Slot& slot : slots_) {
+      if (slot.ptr != nullptr) {
+        allocator_.Deallocate(slot.ptr);
+      }
+    }
+  }
+
+  /// Allocates memory for `layout`, returning a handle or `kInvalidHandle`
+  /// on allocation failure or handle-table exhaustion.
+  Handle Allocate(Layout layout) {
+    for (size_t i = 0; i < kMaxAllocations; ++i) {
+      if (slots_[i].ptr == nullptr) {
+        void* ptr = allocator_.Allocate(layout);
+        if (ptr == nullptr) {
+          return kInvalidHandle;
+        }
+        slots_[i] = Slot{.ptr = ptr, .layout = layout};
+        return i;
+      }
+    }
+    return kInvalidHandle;
+  }
+
+  /// Returns the allocation's current address. Valid only until the next
+  /// `Defragment` call.
+  void* Resolve(Handle handle) const { return slots_[handle].ptr; }
+
+  /// Frees the allocation and invalidates the handle.
+  void Free(Handle handle) {
+    allocator_.Deallocate(slots_[handle].ptr);
+    slots_[handle].ptr = nullptr;
+  }
+
+  /// Registers a listener invoked as `listener(from, to, size)` after each
+  /// relocation, for owners that cache raw pointers between `Resolve` calls.
+  void set_relocation_listener(
+      Function<void(const void*, void*, size_t)>&& listener) {
+    relocation_listener_ = std::move(listener);
+  }
+
+  /// Compacts live allocations by moving them toward lower addresses,
+  /// copying at most `max_move_bytes` of payload. Returns the pass's
+  /// statistics; call repeatedly with a bounded budget to amortize the work
+  /// across idle periods. All outstanding `Resolve` results are invalidated.
+  DefragStats Defragment(size_t max_move_bytes) {
+    DefragStats stats = {};
+    for (Slot& slot : slots_) {
+      if (slot.ptr == nullptr ||
+          stats.moved_bytes + slot.layout.size() > max_move_bytes) {
+        continue;
+      }
+      void* destination = allocator_.Allocate(slot.layout);
+      if (destination == nullptr) {
+        continue;
+      }
+      if (destination >= slot.ptr) {
+        // The move would not lower the allocation; undo it.
+        allocator_.Deallocate(destination);
+        continue;
+      }
+      std::memcpy(destination, slot.ptr, slot.layout.size());
+      allocator_.Deallocate(slot.ptr);
+      if (relocation_listener_ != nullptr) {
+        relocation_listener_(slot.ptr, destination, slot.layout.size());
+      }
+      slot.ptr = destination;
+      stats.moved_allocations += 1;
+      stats.moved_bytes += slot.layout.size();
+    }
+    return stats;
+  }
+
+ private:
+  struct Slot {
+    void* ptr = nullptr;
+    Layout layout;
+  };
+
+  Allocator& allocator_;
+  std::array<Slot, kMaxAllocations> slots_;
+  Function<void(const void*, void*, size_t)> relocation_listener_;
+};
+
+}  // namespace pw::allocator
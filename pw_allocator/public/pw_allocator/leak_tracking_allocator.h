@@ -0,0 +1,145 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "pw_allocator/allocator.h"
+#include "pw_allocator/layout.h"
+#include "pw_function/function.h"
+
+namespace pw::allocator {
+
+/// Forwarding allocator that tracks every outstanding allocation, so leaks
+/// can be found by walking the live list at a quiescent point. Each
+/// allocation is prefixed with a small header holding its requested size and
+/// a sampled capture site (the allocating call's return address, recorded for
+/// every `kSampleInterval`-th allocation to bound overhead). Use alongside
+/// `TrackingAllocator`, which provides byte counts and high-water marks, when
+/// the identity of outstanding allocations is needed rather than aggregates.
+///
+/// This class is not synchronized; wrap it in a `SynchronizedAllocator` when
+/// used from multiple threads.
+template <size_t kSampleInterval = 16>
+class LeakTrackingAllocator : public Allocator {
+ public:
+  /// Information about one outstanding allocation.
+  struct AllocationInfo {
+    /// The pointer returned to the caller.
+    void* ptr;
+    /// The requested size in bytes.
+    size_t size;
+    /// Return address of the allocating call, or null if this allocation was
+    /// not sampled.
+    void* capture_site;
+  };
+
+  explicit constexpr LeakTrackingAllocator(Allocator& allocator)
+      : Allocator(allocator.capabilities()), allocator_(allocator) {}
+
+  /// Invokes `callback` for every outstanding allocation, oldest last.
+  void ForEachOutstanding(
+      const Function<void(const AllocationInfo&)>& callback) const {
+    for (const Record* record = live_; record != nullptr;
+         record = record->next) {
+      callback(AllocationInfo{
+          .ptr = UsableSpace(record),
+          .size = record->size,
+          .capture_site = record->capture_site,
+      });
+    }
+  }
+
+  /// The number of outstanding allocations.
+  size_t outstanding_allocations() const { return outstanding_; }
+
+ private:
+  struct Record {
+    Record* prev;
+    Record* next;
+    size_t size;
+    void* capture_site;
+    size_t offset;  // From the underlying allocation's base to this record.
+  };
+
+  static void* UsableSpace(const Record* record) {
+    return const_cast<std::byte*>(
+               reinterpret_cast<const std::byte*>(record)) +
+           sizeof(Record);
+  }
+
+  void* DoAllocate(Layout layout) override {
+    // Place the record immediately before the returned pointer, padding the
+    // prefix so the returned pointer keeps the requested alignment.
+    const size_t alignment =
+        layout.alignment() > alignof(Record) ? layout.alignment()
+                                             : alignof(Record);
+    const size_t prefix = AlignUp(sizeof(Record), alignment);
+    std::byte* base = static_cast<std::byte*>(
+        allocator_.Allocate(Layout(prefix + layout.size(), alignment)));
+    if (base == nullptr) {
+      return nullptr;
+    }
+
+    void* capture_site = nullptr;
+    if (++sample_counter_ >= kSampleInterval) {
+      sample_counter_ = 0;
+      capture_site = __builtin_return_address(0);
+    }
+
+    Record* record = new (base + prefix - sizeof(Record)) Record{
+        .prev = nullptr,
+        .next = live_,
+        .size = layout.size(),
+        .capture_site = capture_site,
+        .offset = prefix - sizeof(Record),
+    };
+    if (live_ != nullptr) {
+      live_->prev = record;
+    }
+    live_ = record;
+    outstanding_ += 1;
+    return base + prefix;
+  }
+
+  void DoDeallocate(void* ptr) override {
+    Record* record = reinterpret_cast<Record*>(static_cast<std::byte*>(ptr) -
+                                               sizeof(Record));
+    if (record->prev != nullptr) {
+      record->prev->next = record->next;
+    } else {
+      live_ = record->next;
+    }
+    if (record->next != nullptr) {
+      record->next->prev = record->prev;
+    }
+    outstanding_ -= 1;
+    std::byte* base =
+        reinterpret_cast<std::byte*>(record) - record->offset;
+    allocator_.Deallocate(base);
+  }
+
+  static constexpr size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+  }
+
+  Allocator& allocator_;
+  Record* live_ = nullptr;
+  size_t outstanding_ = 0;
+  size_t sample_counter_ = 0;
+};
+
+}  // namespace pw::allocator
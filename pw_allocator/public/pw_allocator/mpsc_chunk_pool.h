@@ -0,0 +1,61 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "pw_allocator/chunk_pool.h"
+#include "pw_allocator/pool.h"
+#include "pw_bytes/span.h"
+
+namespace pw::allocator {
+
+/// Lock-free variant of `ChunkPool` for multi-producer, single-consumer use.
+///
+/// Freed chunks are pushed onto an atomic LIFO, so `Deallocate` may be called
+/// concurrently from any number of contexts, including interrupt handlers.
+/// `Allocate` must only be called from a single context at a time (the
+/// "consumer"); with exactly one popper, the compare-exchange pop cannot
+/// observe a recycled head, so no ABA tagging is needed. This fits buffer
+/// pools where ISRs return receive chunks while one thread hands them out,
+/// such as `pw_multibuf` chunk backing storage fed by DMA completions.
+class MpscChunkPool : public Pool {
+ public:
+  static constexpr Capabilities kCapabilities =
+      kImplementsGetCapacity | kImplementsRecognizes;
+  static constexpr size_t kMinSize = sizeof(void*);
+  static constexpr size_t kMinAlignment = alignof(void*);
+
+  /// Construct a pool that allocates fixed-size chunks from a region of
+  /// memory. See `ChunkPool` for the region and layout requirements.
+  MpscChunkPool(ByteSpan region, const Layout& layout);
+
+ private:
+  /// @copydoc Pool::Allocate
+  void* DoAllocate() override;
+
+  /// @copydoc Deallocator::Deallocate
+  void DoDeallocate(void* ptr) override;
+
+  /// @copydoc Deallocator::GetInfo
+  Result<Layout> DoGetInfo(InfoType info_type, const void* ptr) const override;
+
+  const Layout allocated_layout_;
+  uintptr_t start_;
+  uintptr_t end_;
+  std::atomic<std::byte*> next_;
+};
+
+}  // namespace pw::allocator
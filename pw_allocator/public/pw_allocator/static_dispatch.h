@@ -0,0 +1,64 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_allocator/static_dispatch.h
+///
+/// Compile-time binding for allocators. `pw::Allocator` routes every
+/// allocation through a virtual `DoAllocate`/`DoDeallocate` call, which is
+/// the right default for the facade but costs an indirect branch per
+/// operation in object-churn loops even when a project only ever uses one
+/// allocator type.
+///
+/// `StaticDispatch<AllocatorType>` is that allocator with the dynamic
+/// dispatch compiled out. It derives from the concrete allocator, so it *is*
+/// still a `pw::Allocator` and can be passed to polymorphic consumers
+/// unchanged. Because the class is `final`, the compiler proves the dynamic
+/// type of any call made through it — `Allocate`, `Deallocate`, `Resize`,
+/// and the `New`/`MakeUnique` helpers — and devirtualizes and inlines the
+/// concrete `Do*` implementations. No forwarding shims are needed; marking
+/// the most-derived type is the entire mechanism.
+///
+/// @code{.cpp}
+///   // A bump allocator with inlined, devirtualized allocation paths:
+///   pw::allocator::StaticDispatch<pw::allocator::BumpAllocator> allocator;
+///   allocator.Init(buffer);
+///   Foo* foo = allocator.New<Foo>();   // No indirect branches.
+///
+///   pw::Allocator& generic = allocator;  // Facade still available.
+/// @endcode
+
+#include <utility>
+
+#include "pw_allocator/allocator.h"
+#include "pw_allocator/layout.h"
+
+namespace pw::allocator {
+
+/// Devirtualizing wrapper around a concrete allocator type.
+///
+/// `AllocatorType` must derive from `pw::Allocator`. Constructor arguments
+/// are forwarded to it.
+template <typename AllocatorType>
+class StaticDispatch final : public AllocatorType {
+ public:
+  static_assert(std::is_base_of_v<Allocator, AllocatorType>,
+                "AllocatorType must derive from pw::Allocator");
+
+  template <typename... Args>
+  constexpr explicit StaticDispatch(Args&&... args)
+      : AllocatorType(std::forward<Args>(args)...) {}
+};
+
+}  // namespace pw::allocator
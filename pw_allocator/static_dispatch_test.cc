@@ -0,0 +1,76 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_allocator/static_dispatch.h"
+
+#include <cstdint>
+
+#include "pw_allocator/bump_allocator.h"
+#include "pw_allocator/first_fit.h"
+#include "pw_unit_test/framework.h"
+
+namespace {
+
+using ::pw::allocator::BumpAllocator;
+using ::pw::allocator::FirstFitAllocator;
+using ::pw::allocator::Layout;
+using ::pw::allocator::StaticDispatch;
+
+TEST(StaticDispatchTest, AllocatesThroughConcreteType) {
+  alignas(16) std::byte buffer[256];
+  StaticDispatch<BumpAllocator> allocator;
+  allocator.Init(buffer);
+
+  void* ptr = allocator.Allocate(Layout(16, 4));
+  ASSERT_NE(ptr, nullptr);
+
+  // Zero-sized layouts fail, matching Allocator::Allocate.
+  EXPECT_EQ(allocator.Allocate(Layout(0, 1)), nullptr);
+}
+
+TEST(StaticDispatchTest, InheritedHelpersWork) {
+  alignas(16) std::byte buffer[256];
+  StaticDispatch<BumpAllocator> allocator;
+  allocator.Init(buffer);
+
+  uint32_t* value = allocator.New<uint32_t>(0xA5A5A5A5u);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*value, 0xA5A5A5A5u);
+}
+
+TEST(StaticDispatchTest, UsableAsGenericAllocator) {
+  alignas(16) std::byte buffer[512];
+  StaticDispatch<FirstFitAllocator<>> allocator(buffer);
+
+  pw::Allocator& generic = allocator;
+  void* ptr = generic.Allocate(Layout(32, 4));
+  ASSERT_NE(ptr, nullptr);
+  generic.Deallocate(ptr);
+}
+
+TEST(StaticDispatchTest, DeallocateAndResize) {
+  alignas(16) std::byte buffer[512];
+  StaticDispatch<FirstFitAllocator<>> allocator(buffer);
+
+  void* ptr = allocator.Allocate(Layout(32, 4));
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_TRUE(allocator.Resize(ptr, 16));
+  allocator.Deallocate(ptr);
+
+  // Null pointers are ignored, matching Deallocator::Deallocate.
+  allocator.Deallocate(nullptr);
+  EXPECT_FALSE(allocator.Resize(nullptr, 16));
+}
+
+}  // namespace
@@ -0,0 +1,86 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#include "pw_analog/burst_input.h"
+
+#include <array>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw {
+namespace analog {
+namespace {
+
+constexpr int32_t kLimitsMax = 4096;
+constexpr int32_t kLimitsMin = 0;
+
+// Fake burst input that completes captures synchronously, for testing.
+class TestBurstInput : public BurstAnalogInput {
+ public:
+  Status StartBurst(const BurstConfig& config,
+                    span<int32_t> samples,
+                    CompletionCallback&& callback) override {
+    if (config.sample_rate_hz == 0 || samples.empty()) {
+      return Status::InvalidArgument();
+    }
+    for (size_t i = 0; i < samples.size(); ++i) {
+      samples[i] = static_cast<int32_t>(i);
+    }
+    callback(OkStatus(), samples);
+    return OkStatus();
+  }
+
+  Status CancelBurst() override { return Status::FailedPrecondition(); }
+
+  AnalogInput::Limits GetLimits() const override {
+    return {.min = kLimitsMin, .max = kLimitsMax};
+  }
+};
+
+TEST(BurstInputTest, BurstFillsCallerBuffer) {
+  TestBurstInput input;
+  std::array<int32_t, 64> buffer = {};
+  struct {
+    Status status = Status::Unknown();
+    size_t count = 0;
+  } result;
+
+  EXPECT_EQ(input.StartBurst({.sample_rate_hz = 25600},
+                             buffer,
+                             [&result](Status status, span<const int32_t> samples) {
+                               result.status = status;
+                               result.count = samples.size();
+                             }),
+            OkStatus());
+  EXPECT_EQ(result.status, OkStatus());
+  EXPECT_EQ(result.count, 64u);
+  EXPECT_EQ(buffer[63], 63);
+}
+
+TEST(BurstInputTest, ZeroRateRejected) {
+  TestBurstInput input;
+  std::array<int32_t, 4> buffer = {};
+  EXPECT_EQ(input.StartBurst({.sample_rate_hz = 0},
+                             buffer,
+                             [](Status, span<const int32_t>) {}),
+            Status::InvalidArgument());
+}
+
+TEST(BurstInputTest, CancelWithoutBurstFailsPrecondition) {
+  TestBurstInput input;
+  EXPECT_EQ(input.CancelBurst(), Status::FailedPrecondition());
+}
+
+}  // namespace
+}  // namespace analog
+}  // namespace pw
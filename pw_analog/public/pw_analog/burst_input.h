@@ -0,0 +1,88 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+
+#include "pw_analog/analog_input.h"
+#include "pw_function/function.h"
+#include "pw_span/span.h"
+#include "pw_status/status.h"
+
+namespace pw::analog {
+
+/// Base interface for hardware-paced multi-sample ADC capture.
+///
+/// `AnalogInput::TryReadFor` reads one sample synchronously, so the spacing
+/// between consecutive samples depends on thread scheduling. Burst capture
+/// instead configures the silicon to run N conversions paced by a hardware
+/// timer (or the ADC's own sequencer), transferring results into the caller's
+/// buffer by DMA or interrupt, so sample spacing has the accuracy of the
+/// sample clock rather than the RTOS tick.
+///
+/// As with `AnalogInput`, the backend is responsible for thread safety and
+/// for arbitrating a shared ADC peripheral.
+class BurstAnalogInput {
+ public:
+  /// Describes the pacing of one burst.
+  /// These values are fixed for the duration of a burst.
+  struct BurstConfig {
+    /// Requested sample rate. Backends round to the nearest rate the timer
+    /// and ADC can produce; rates the hardware cannot approximate are
+    /// rejected by `StartBurst` with `INVALID_ARGUMENT`.
+    uint32_t sample_rate_hz;
+  };
+
+  /// Invoked exactly once per burst, with the capture status and the portion
+  /// of the caller's buffer that holds valid samples (the full span on
+  /// success, the samples captured before the failure otherwise).
+  ///
+  /// May be invoked from an interrupt (e.g. DMA-complete) context; backends
+  /// must document where the callback runs.
+  using CompletionCallback = Function<void(Status, span<const int32_t>)>;
+
+  virtual ~BurstAnalogInput() = default;
+
+  /// Starts capturing `samples.size()` conversions paced per `config`,
+  /// writing results into `samples`. The buffer must remain valid until the
+  /// completion callback is invoked.
+  ///
+  /// @returns @rst
+  ///
+  /// .. pw-status-codes::
+  ///
+  ///    OK: The burst was started; the callback will be invoked.
+  ///
+  ///    RESOURCE_EXHAUSTED: ADC peripheral or pacing timer in use.
+  ///
+  ///    INVALID_ARGUMENT: The sample rate or buffer size is unsupported.
+  ///
+  /// Other statuses left up to the implementer.
+  ///
+  /// @endrst
+  virtual Status StartBurst(const BurstConfig& config,
+                            span<int32_t> samples,
+                            CompletionCallback&& callback) = 0;
+
+  /// Cancels an in-progress burst. The completion callback is invoked with
+  /// `CANCELLED` and the samples captured so far. A no-op returning
+  /// `FAILED_PRECONDITION` if no burst is active.
+  virtual Status CancelBurst() = 0;
+
+  /// @returns The range of the ADC samples, matching
+  /// `AnalogInput::Limits` semantics. These values do not change at runtime.
+  virtual AnalogInput::Limits GetLimits() const = 0;
+};
+
+}  // namespace pw::analog
@@ -34,6 +34,18 @@
 #define PW_ASSERT_CAPTURE_VALUES 1
 #endif  // !defined(PW_ASSERT_CAPTURE_VALUES)
 
+// PW_ASSERT_OUTLINE_FAILURE_PATHS moves each CHECK's failure path -- message
+// formatting, value capture, and the backend handler call -- out of the
+// enclosing function into a cold-annotated local lambda, so the inline cost
+// of a CHECK in a hot function is just the comparison and a call to a
+// .text.unlikely trampoline. Requires C++; C translation units keep the
+// inline expansion. Disabled by default as some backends rely on the failure
+// expansion inheriting the exact enclosing scope (e.g. for PW_MODIFY_*
+// diagnostics around the check).
+#if !defined(PW_ASSERT_OUTLINE_FAILURE_PATHS)
+#define PW_ASSERT_OUTLINE_FAILURE_PATHS 0
+#endif  // !defined(PW_ASSERT_OUTLINE_FAILURE_PATHS)
+
 // Modes available for how to end an assert failure for pw_assert_basic.
 #define PW_ASSERT_BASIC_ACTION_ABORT 100
 #define PW_ASSERT_BASIC_ACTION_EXIT 101
@@ -24,6 +24,21 @@
 #include "pw_assert/config.h"
 #include "pw_preprocessor/compiler.h"
 
+// When PW_ASSERT_OUTLINE_FAILURE_PATHS is enabled (C++ only), CHECK failure
+// paths expand inside a cold, noinline lambda: the compiler outlines the
+// whole failure body (string formatting, value capture, handler call) into
+// .text.unlikely, leaving only the comparison and a trampoline call in the
+// hot function. The lambda captures by reference, so evaluated arguments are
+// passed to the cold body in registers with no code at the call site beyond
+// the call itself.
+#if PW_ASSERT_OUTLINE_FAILURE_PATHS && defined(__cplusplus)
+#define _PW_CHECK_FAILURE_BLOCK_BEGIN   [&]() __attribute__((noinline, cold)) {
+#define _PW_CHECK_FAILURE_BLOCK_END   }                                   ();
+#else
+#define _PW_CHECK_FAILURE_BLOCK_BEGIN
+#define _PW_CHECK_FAILURE_BLOCK_END
+#endif  // PW_ASSERT_OUTLINE_FAILURE_PATHS && defined(__cplusplus)
+
 // PW_CRASH - Crash the system, with a message.
 #define PW_CRASH(...)                                                        \
   do {                                                                       \
@@ -37,12 +52,14 @@
 #define PW_CHECK(condition, ...)                                               \
   do {                                                                         \
     if (!(condition)) {                                                        \
+      _PW_CHECK_FAILURE_BLOCK_BEGIN                                            \
       _pw_assert_ConditionCannotContainThePercentCharacter(                    \
           #condition); /* cannot use '%' in PW_CHECK conditions */             \
       if (0) { /* Check args but don't execute to avoid multiple evaluation */ \
         _pw_assert_CheckMessageArguments(" " __VA_ARGS__);                     \
       }                                                                        \
       PW_HANDLE_ASSERT_FAILURE(#condition, "" __VA_ARGS__);                    \
+      _PW_CHECK_FAILURE_BLOCK_END                                              \
     }                                                                          \
   } while (0)
 
@@ -229,6 +246,7 @@ constexpr T ConvertToType(const U& value) {
     _PW_CHECK_CONVERT(type_decl, evaluated_argument_a, arg_a);        \
     _PW_CHECK_CONVERT(type_decl, evaluated_argument_b, arg_b);        \
     if (!(evaluated_argument_a comparison_op evaluated_argument_b)) { \
+      _PW_CHECK_FAILURE_BLOCK_BEGIN                                   \
       _PW_CHECK_BINARY_ARG_HANDLER(#arg_a,                            \
                                    evaluated_argument_a,              \
                                    #comparison_op,                    \
@@ -236,6 +254,7 @@ constexpr T ConvertToType(const U& value) {
                                    evaluated_argument_b,              \
                                    type_fmt,                          \
                                    "" __VA_ARGS__);                   \
+      _PW_CHECK_FAILURE_BLOCK_END                                     \
     }                                                                 \
   } while (0)
 
@@ -0,0 +1,167 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_async/two_lane_dispatcher.h
+///
+/// Two-lane execution over a single `Dispatcher` sequence. Stacks that
+/// process control work (e.g. GATT discovery) and data work (notifications)
+/// on one sequence see bursts of control tasks delay data delivery past
+/// latency budgets. `TwoLaneDispatcher` layers two prioritized lanes over an
+/// existing dispatcher without adding a thread: data-lane tasks run first,
+/// and control-lane tasks are bounded-starved -- after
+/// `max_data_before_control` consecutive data tasks run while control work
+/// waits, one control task is interleaved, so discovery still progresses
+/// while data latency stays bounded by a single control task's runtime.
+///
+/// Both lanes implement `Dispatcher`, so existing code takes a lane where it
+/// previously took the dispatcher. Everything still executes on the
+/// underlying dispatcher's sequence: no locking model changes, and one task
+/// runs per underlying dispatch slot so unrelated tasks on the same
+/// dispatcher are not starved either. Delayed posts (`PostAt`/`PostAfter`)
+/// bypass lane ordering and go directly to the underlying dispatcher, as
+/// timed tasks have their own deadlines.
+///
+/// Not internally synchronized: all posts must happen on the underlying
+/// dispatcher's sequence, matching the single-sequence model this targets.
+
+#include "pw_assert/assert.h"
+#include "pw_async/dispatcher.h"
+#include "pw_async/task.h"
+#include "pw_containers/inline_deque.h"
+
+namespace pw::async {
+
+/// Two prioritized lanes over one dispatcher, each queueing up to
+/// `kMaxQueuedTasks` immediate tasks.
+template <size_t kMaxQueuedTasks>
+class TwoLaneDispatcher {
+ public:
+  explicit TwoLaneDispatcher(Dispatcher& underlying,
+                             size_t max_data_before_control = 8)
+      : underlying_(underlying),
+        max_data_before_control_(max_data_before_control),
+        data_lane_(*this, data_queue_),
+        control_lane_(*this, control_queue_),
+        pump_([this](Context& context, Status status) {
+          RunOne(context, status);
+        }) {}
+
+  /// The high-priority lane for latency-sensitive (data-plane) tasks.
+  Dispatcher& data_lane() { return data_lane_; }
+
+  /// The low-priority lane for bulk/control-plane tasks.
+  Dispatcher& control_lane() { return control_lane_; }
+
+ private:
+  // A Dispatcher view that feeds one of the two queues.
+  class Lane : public Dispatcher {
+   public:
+    Lane(TwoLaneDispatcher& owner, InlineDeque<Task*>& queue)
+        : owner_(owner), queue_(queue) {}
+
+    void PostAt(Task& task, chrono::SystemClock::time_point time) override {
+      if (time <= now()) {
+        // Immediate work goes through the lane queue for prioritization.
+        PW_ASSERT(!queue_.full());
+        queue_.push_back(&task);
+        owner_.SchedulePump();
+      } else {
+        // Timed work keeps its deadline semantics on the underlying
+        // dispatcher and skips lane ordering.
+        owner_.underlying_.PostAt(task, time);
+      }
+    }
+
+    bool Cancel(Task& task) override {
+      // Rotate through the queue, dropping the cancelled task; the queues
+      // are small and cancellation is rare.
+      bool found = false;
+      for (size_t i = queue_.size(); i > 0; --i) {
+        Task* const queued = queue_.front();
+        queue_.pop_front();
+        if (queued == &task) {
+          found = true;
+        } else {
+          queue_.push_back(queued);
+        }
+      }
+      return found || owner_.underlying_.Cancel(task);
+    }
+
+    chrono::SystemClock::time_point now() override {
+      return owner_.underlying_.now();
+    }
+
+   private:
+    TwoLaneDispatcher& owner_;
+    InlineDeque<Task*>& queue_;
+  };
+
+  void SchedulePump() {
+    if (!pump_posted_) {
+      pump_posted_ = true;
+      underlying_.Post(pump_);
+    }
+  }
+
+  void RunOne(Context&, Status status) {
+    pump_posted_ = false;
+
+    // Pick the next task: data first, except that one control task is
+    // interleaved after max_data_before_control consecutive data tasks ran
+    // with control work waiting.
+    InlineDeque<Task*>* queue = nullptr;
+    if (!control_queue_.empty() &&
+        (data_queue_.empty() ||
+         consecutive_data_tasks_ >= max_data_before_control_)) {
+      queue = &control_queue_;
+      consecutive_data_tasks_ = 0;
+    } else if (!data_queue_.empty()) {
+      queue = &data_queue_;
+      consecutive_data_tasks_ += 1;
+    }
+    if (queue == nullptr) {
+      return;
+    }
+
+    Task* const task = queue->front();
+    Dispatcher& lane =
+        queue == &control_queue_ ? control_lane_ : data_lane_;
+    queue->pop_front();
+
+    // Re-post the pump before running the task, so the lanes keep draining
+    // even if the task posts nothing, while unrelated tasks on the
+    // underlying dispatcher get a slot between lane tasks.
+    if (!data_queue_.empty() || !control_queue_.empty()) {
+      SchedulePump();
+    }
+
+    Context task_context{.dispatcher = &lane, .task = task};
+    (*task)(task_context, status);
+  }
+
+  Dispatcher& underlying_;
+  const size_t max_data_before_control_;
+  size_t consecutive_data_tasks_ = 0;
+  bool pump_posted_ = false;
+
+  InlineDeque<Task*, kMaxQueuedTasks> data_queue_;
+  InlineDeque<Task*, kMaxQueuedTasks> control_queue_;
+  Lane data_lane_;
+  Lane control_lane_;
+  Task pump_;
+};
+
+}  // namespace pw::async
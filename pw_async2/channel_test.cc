@@ -0,0 +1,193 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_async2/channel.h"
+
+#include "pw_async2/dispatcher.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::async2 {
+namespace {
+
+// Sends `count` sequential integers, respecting backpressure.
+class ProducerTask : public Task {
+ public:
+  ProducerTask(Channel<int, 2>& channel, int count)
+      : channel_(channel), count_(count) {}
+
+  int sent = 0;
+  bool failed = false;
+
+ private:
+  Poll<> DoPend(Context& context) override {
+    while (sent < count_) {
+      Poll<Status> poll = channel_.PendSend(context, int(sent));
+      if (poll.IsPending()) {
+        return Pending();
+      }
+      if (!poll.value().ok()) {
+        failed = true;
+        return Ready();
+      }
+      ++sent;
+    }
+    return Ready();
+  }
+
+  Channel<int, 2>& channel_;
+  const int count_;
+};
+
+// Receives until the channel closes.
+class ConsumerTask : public Task {
+ public:
+  explicit ConsumerTask(Channel<int, 2>& channel) : channel_(channel) {}
+
+  int received = 0;
+  int last = -1;
+  bool saw_close = false;
+
+ private:
+  Poll<> DoPend(Context& context) override {
+    while (true) {
+      Poll<std::optional<int>> poll = channel_.PendReceive(context);
+      if (poll.IsPending()) {
+        return Pending();
+      }
+      if (!poll.value().has_value()) {
+        saw_close = true;
+        return Ready();
+      }
+      last = poll.value().value();
+      ++received;
+    }
+  }
+
+  Channel<int, 2>& channel_;
+};
+
+TEST(Channel, StreamsValuesWithBackpressure) {
+  Channel<int, 2> channel;
+  ProducerTask producer(channel, 10);
+  ConsumerTask consumer(channel);
+
+  Dispatcher dispatcher;
+  dispatcher.Post(producer);
+  dispatcher.Post(consumer);
+
+  // Consumer stays pending (channel still open), producer completes.
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(producer.sent, 10);
+  EXPECT_EQ(consumer.received, 10);
+  EXPECT_EQ(consumer.last, 9);
+
+  channel.Close();
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(consumer.saw_close);
+}
+
+TEST(Channel, CloseDrainsBufferedValuesFirst) {
+  Channel<int, 2> channel;
+  ProducerTask producer(channel, 2);
+  Dispatcher dispatcher;
+  dispatcher.Post(producer);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+
+  channel.Close();
+
+  ConsumerTask consumer(channel);
+  dispatcher.Post(consumer);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(consumer.received, 2);  // Buffered values still delivered.
+  EXPECT_TRUE(consumer.saw_close);
+}
+
+TEST(Channel, SendAfterCloseFails) {
+  Channel<int, 2> channel;
+  channel.Close();
+  ProducerTask producer(channel, 1);
+  Dispatcher dispatcher;
+  dispatcher.Post(producer);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(producer.failed);
+  EXPECT_EQ(producer.sent, 0);
+}
+
+TEST(Channel, FullChannelBlocksSenderUntilReceive) {
+  Channel<int, 2> channel;
+  ProducerTask producer(channel, 3);  // Depth is 2: the third send blocks.
+  Dispatcher dispatcher;
+  dispatcher.Post(producer);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(producer.sent, 2);
+  EXPECT_EQ(channel.size(), 2u);
+
+  ConsumerTask consumer(channel);
+  dispatcher.Post(consumer);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(producer.sent, 3);  // Woken when space freed.
+  EXPECT_EQ(consumer.received, 3);
+  channel.Close();
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+}
+
+// Re-polls PendSend against a full channel on every dispatch, as a task
+// multiplexing the send with another wake source (e.g. a timer) would.
+class RepollingSenderTask : public Task {
+ public:
+  RepollingSenderTask(Channel<int, 2>& channel, int repolls)
+      : channel_(channel), repolls_remaining_(repolls) {}
+
+  bool sent = false;
+
+ private:
+  Poll<> DoPend(Context& context) override {
+    Poll<Status> poll = channel_.PendSend(context, 1);
+    if (poll.IsReady()) {
+      sent = poll.value().ok();
+      return Ready();
+    }
+    if (repolls_remaining_-- > 0) {
+      context.ReEnqueue();  // Simulate another wake source firing.
+    }
+    // Once the re-poll budget is spent, wait solely on the channel waker.
+    return Pending();
+  }
+
+  Channel<int, 2>& channel_;
+  int repolls_remaining_;
+};
+
+TEST(Channel, RepolledSenderDoesNotExhaustWakerTable) {
+  Channel<int, 2> channel;  // kMaxWaitingSenders defaults to 4.
+  ProducerTask filler(channel, 2);
+  Dispatcher dispatcher;
+  dispatcher.Post(filler);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());  // Channel now full.
+
+  // Far more re-polls than waker slots; must not crash or lose the waiter.
+  RepollingSenderTask sender(channel, 32);
+  dispatcher.Post(sender);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+
+  ConsumerTask consumer(channel);
+  dispatcher.Post(consumer);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(sender.sent);  // Woken when space freed, despite the churn.
+  channel.Close();
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+}
+
+}  // namespace
+}  // namespace pw::async2
@@ -143,6 +143,21 @@ void Waker::Wake() && {
   }
 }
 
+void Waker::WakeAll(span<Waker> wakers) {
+  std::lock_guard lock(dispatcher_lock());
+  for (Waker& waker : wakers) {
+    if (waker.task_ != nullptr) {
+      waker.task_->dispatcher_->WakeTask(*waker.task_);
+      waker.RemoveFromTaskWakerListLocked();
+    }
+  }
+}
+
+bool Waker::InternalWakesSameTaskAs(const Waker& other) const {
+  std::lock_guard lock(dispatcher_lock());
+  return task_ != nullptr && task_ == other.task_;
+}
+
 void Waker::InternalCloneInto(Waker& out) & {
   std::lock_guard lock(dispatcher_lock());
   // The `out` waker already points to this task, so no work is necessary.
@@ -229,6 +244,7 @@ NativeDispatcherBase::SleepInfo NativeDispatcherBase::AttemptRequestWake(
   /// Indicate that the ``Dispatcher`` is sleeping and will need a ``DoWake``
   /// call once more work can be done.
   wants_wake_ = true;
+  stats_.sleeps += 1;
   // Once timers are added, this should check them.
   return SleepInfo::Indefinitely();
 }
@@ -274,6 +290,7 @@ NativeDispatcherBase::RunOneTaskResult NativeDispatcherBase::RunOneTask(
       task->state_ = Task::State::kUnposted;
       task->dispatcher_ = nullptr;
       task->RemoveAllWakersLocked();
+      stats_.tasks_completed += 1;
       all_complete = first_woken_ == nullptr && sleeping_ == nullptr;
     }
     task->DoDestroy();
@@ -325,6 +342,7 @@ void NativeDispatcherBase::RemoveWokenTaskLocked(Task& task) {
     last_woken_ = task.prev_;
   }
   RemoveTaskFromList(task);
+  woken_queue_depth_ -= 1;
 }
 
 void NativeDispatcherBase::RemoveSleepingTaskLocked(Task& task) {
@@ -342,6 +360,11 @@ void NativeDispatcherBase::AddTaskToWokenList(Task& task) {
     task.prev_ = last_woken_;
   }
   last_woken_ = &task;
+
+  woken_queue_depth_ += 1;
+  if (woken_queue_depth_ > stats_.max_woken_queue_depth) {
+    stats_.max_woken_queue_depth = woken_queue_depth_;
+  }
 }
 
 void NativeDispatcherBase::AddTaskToSleepingList(Task& task) {
@@ -395,6 +418,8 @@ Task* NativeDispatcherBase::PopWokenTask() {
   first_woken_ = task.next_;
   task.prev_ = nullptr;
   task.next_ = nullptr;
+  woken_queue_depth_ -= 1;
+  stats_.tasks_polled += 1;
   return &task;
 }
 
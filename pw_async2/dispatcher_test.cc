@@ -14,6 +14,10 @@
 
 #include "pw_async2/dispatcher.h"
 
+#include <array>
+
+#include "pw_async2/dispatcher_pool.h"
+
 #include "gtest/gtest.h"
 #include "pw_containers/vector.h"
 
@@ -92,6 +96,85 @@ TEST(Dispatcher, RunUntilStalledDoesNotPendSleepingTask) {
   EXPECT_EQ(task.destroyed, 1);
 }
 
+TEST(Dispatcher, WakeAllWakesEveryTaskWithOneCall) {
+  MockTask task_a;
+  MockTask task_b;
+  Dispatcher dispatcher;
+  dispatcher.Post(task_a);
+  dispatcher.Post(task_b);
+
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(task_a.polled, 1);
+  EXPECT_EQ(task_b.polled, 1);
+
+  task_a.should_complete = true;
+  task_b.should_complete = true;
+  std::array<Waker, 2> wakers = {std::move(task_a.last_waker),
+                                 std::move(task_b.last_waker)};
+  Waker::WakeAll(wakers);
+  // Every waker was consumed.
+  EXPECT_TRUE(wakers[0].IsEmpty());
+  EXPECT_TRUE(wakers[1].IsEmpty());
+
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(task_a.polled, 2);
+  EXPECT_EQ(task_b.polled, 2);
+  EXPECT_EQ(task_a.destroyed, 1);
+  EXPECT_EQ(task_b.destroyed, 1);
+}
+
+TEST(Dispatcher, WakeAllIgnoresEmptyWakers) {
+  std::array<Waker, 2> wakers;  // Never associated with tasks.
+  Waker::WakeAll(wakers);
+  EXPECT_TRUE(wakers[0].IsEmpty());
+  EXPECT_TRUE(wakers[1].IsEmpty());
+}
+
+TEST(Dispatcher, RunQueueStatsCountPollsAndCompletions) {
+  MockTask task_one;
+  MockTask task_two;
+  task_one.should_complete = true;
+  task_two.should_complete = true;
+  Dispatcher dispatcher;
+  dispatcher.Post(task_one);
+  dispatcher.Post(task_two);
+
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+
+  const NativeDispatcherBase::RunQueueStats stats =
+      dispatcher.native().run_queue_stats();
+  EXPECT_EQ(stats.tasks_polled, 2u);
+  EXPECT_EQ(stats.tasks_completed, 2u);
+  EXPECT_GE(stats.max_woken_queue_depth, 2u);
+}
+
+TEST(DispatcherPool, BalancesAndPinsTasks) {
+  Dispatcher dispatcher_a;
+  Dispatcher dispatcher_b;
+  std::array<Dispatcher*, 2> dispatchers = {&dispatcher_a, &dispatcher_b};
+  DispatcherPool pool(dispatchers);
+
+  // Post balances onto the least-loaded dispatcher, so two posts land on
+  // different dispatchers.
+  MockTask task_one;
+  MockTask task_two;
+  MockTask pinned;
+  task_one.should_complete = true;
+  task_two.should_complete = true;
+  pinned.should_complete = true;
+  pool.Post(task_one);
+  pool.Post(task_two);
+  pool.PostTo(pinned, 1);
+
+  EXPECT_TRUE(dispatcher_a.RunUntilStalled().IsReady());
+  EXPECT_TRUE(dispatcher_b.RunUntilStalled().IsReady());
+  EXPECT_EQ(task_one.polled, 1);
+  EXPECT_EQ(task_two.polled, 1);
+  EXPECT_EQ(pinned.polled, 1);
+  EXPECT_EQ(dispatcher_a.native().run_queue_stats().tasks_completed, 1u);
+  EXPECT_EQ(dispatcher_b.native().run_queue_stats().tasks_completed, 2u);
+}
+
 TEST(Dispatcher, RunUntilStalledWithNoTasksReturnsReady) {
   Dispatcher dispatcher;
   EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
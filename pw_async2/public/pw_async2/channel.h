@@ -0,0 +1,151 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_async2/channel.h
+///
+/// Bounded typed channel for inter-task dataflow. ``OnceSender`` carries a
+/// single value; pipelines that stream many values end up hand-rolling
+/// queues with ad-hoc waker handling. ``Channel<T, kDepth>`` is the
+/// sanctioned primitive: a bounded buffer with pend-based send and receive,
+/// multi-producer/single-consumer semantics, and close. Values are moved
+/// through the channel, so ``T = pw::multibuf::MultiBuf`` (or ``OwnedChunk``)
+/// flows zero-copy -- ownership transfers, payload bytes do not.
+///
+/// Backpressure is natural: ``PendSend`` returns ``Pending`` while the
+/// buffer is full and the task is woken when space frees; ``PendReceive``
+/// returns ``Pending`` while empty. After ``Close``, sends fail with
+/// ``FAILED_PRECONDITION`` and receives drain buffered values before
+/// yielding ``std::nullopt``.
+
+#include <optional>
+#include <utility>
+
+#include "pw_assert/assert.h"
+#include "pw_async2/dispatcher.h"
+#include "pw_async2/poll.h"
+#include "pw_containers/inline_deque.h"
+#include "pw_status/status.h"
+#include "pw_sync/interrupt_spin_lock.h"
+
+namespace pw::async2 {
+
+/// A bounded MPSC channel holding up to ``kDepth`` values of ``T``. Up to
+/// ``kMaxWaitingSenders`` *distinct* producer tasks may be blocked on a full
+/// channel at once; a task re-polled while waiting replaces its previous
+/// waker rather than consuming another slot.
+template <typename T, size_t kDepth, size_t kMaxWaitingSenders = 4>
+class Channel {
+ public:
+  Channel() = default;
+
+  Channel(const Channel&) = delete;
+  Channel& operator=(const Channel&) = delete;
+
+  /// Attempts to send ``value``. Returns:
+  ///
+  /// - ``Ready(OkStatus())`` and consumes ``value`` when it was enqueued.
+  /// - ``Ready(FAILED_PRECONDITION)`` when the channel is closed (``value``
+  ///   is untouched).
+  /// - ``Pending()`` when the channel is full; the task is woken when space
+  ///   frees or the channel closes.
+  Poll<Status> PendSend(Context& context, T&& value) {
+    std::lock_guard lock(lock_);
+    if (closed_) {
+      return Ready(Status::FailedPrecondition());
+    }
+    if (queue_.full()) {
+      // A task re-polled while the channel stays full (e.g. one also
+      // multiplexed with a timer) stores a fresh waker on every poll, so
+      // each store must replace the task's previous registration rather
+      // than consume another table slot. Emptied wakers (completed tasks)
+      // are reclaimed the same way, so only distinct waiting tasks occupy
+      // slots and kMaxWaitingSenders bounds concurrent sender *tasks*.
+      Waker staged;
+      PW_ASYNC_STORE_WAKER(context, staged, "Channel full");
+      for (Waker& waker : sender_wakers_) {
+        if (waker.InternalWakesSameTaskAs(staged) || waker.IsEmpty()) {
+          waker = std::move(staged);
+          return Pending();
+        }
+      }
+      PW_ASSERT(!sender_wakers_.full());  // Raise kMaxWaitingSenders.
+      sender_wakers_.push_back(std::move(staged));
+      return Pending();
+    }
+    queue_.push_back(std::move(value));
+    std::move(receiver_waker_).Wake();
+    return Ready(OkStatus());
+  }
+
+  /// Receives the next value. Returns:
+  ///
+  /// - ``Ready(value)`` with the oldest buffered value.
+  /// - ``Ready(std::nullopt)`` when the channel is closed and drained.
+  /// - ``Pending()`` when open and empty; the task is woken on send/close.
+  ///
+  /// Single consumer only.
+  Poll<std::optional<T>> PendReceive(Context& context) {
+    std::lock_guard lock(lock_);
+    if (!queue_.empty()) {
+      std::optional<T> value(std::move(queue_.front()));
+      queue_.pop_front();
+      WakeOneSenderLocked();
+      return Ready(std::move(value));
+    }
+    if (closed_) {
+      return Ready(std::optional<T>(std::nullopt));
+    }
+    PW_ASYNC_STORE_WAKER(context, receiver_waker_, "Channel empty");
+    return Pending();
+  }
+
+  /// Closes the channel. Buffered values remain receivable; subsequent
+  /// sends fail and blocked senders are woken to observe the close.
+  void Close() {
+    std::lock_guard lock(lock_);
+    closed_ = true;
+    std::move(receiver_waker_).Wake();
+    while (!sender_wakers_.empty()) {
+      std::move(sender_wakers_.front()).Wake();
+      sender_wakers_.pop_front();
+    }
+  }
+
+  bool closed() const {
+    std::lock_guard lock(lock_);
+    return closed_;
+  }
+
+  size_t size() const {
+    std::lock_guard lock(lock_);
+    return queue_.size();
+  }
+
+ private:
+  void WakeOneSenderLocked() {
+    if (!sender_wakers_.empty()) {
+      std::move(sender_wakers_.front()).Wake();
+      sender_wakers_.pop_front();
+    }
+  }
+
+  mutable sync::InterruptSpinLock lock_;
+  InlineDeque<T, kDepth> queue_;
+  InlineDeque<Waker, kMaxWaitingSenders> sender_wakers_;
+  Waker receiver_waker_;
+  bool closed_ = false;
+};
+
+}  // namespace pw::async2
@@ -0,0 +1,76 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+
+#include "pw_assert/assert.h"
+#include "pw_async2/dispatcher.h"
+#include "pw_span/span.h"
+
+namespace pw::async2 {
+
+/// Distributes tasks across a pool of dispatchers, typically one per core,
+/// each run by its own thread (e.g. with ``Dispatcher::RunToCompletion``).
+///
+/// A task is pinned to the dispatcher it is posted to for its lifetime, so
+/// its ``Pend`` calls never migrate between cores. ``Post`` balances new
+/// tasks onto the dispatcher with the fewest currently runnable tasks, while
+/// ``PostTo`` gives explicit affinity for tasks that must share a dispatcher
+/// (and may therefore share state without locking).
+class DispatcherPool {
+ public:
+  /// @param[in] dispatchers The dispatchers in the pool. The pointers must
+  /// remain valid for the lifetime of the pool.
+  explicit constexpr DispatcherPool(span<Dispatcher* const> dispatchers)
+      : dispatchers_(dispatchers) {}
+
+  /// Posts a task to the dispatcher with the fewest runnable tasks.
+  void Post(Task& task) {
+    PW_ASSERT(!dispatchers_.empty());
+    Dispatcher* least_loaded = dispatchers_[0];
+    uint32_t least_depth =
+        least_loaded->native().run_queue_stats().woken_queue_depth;
+    for (size_t i = 1; i < dispatchers_.size(); ++i) {
+      const uint32_t depth =
+          dispatchers_[i]->native().run_queue_stats().woken_queue_depth;
+      if (depth < least_depth) {
+        least_loaded = dispatchers_[i];
+        least_depth = depth;
+      }
+    }
+    least_loaded->Post(task);
+  }
+
+  /// Posts a task to the dispatcher at the provided index, pinning related
+  /// tasks to the same dispatcher.
+  void PostTo(Task& task, size_t dispatcher_index) {
+    PW_ASSERT(dispatcher_index < dispatchers_.size());
+    dispatchers_[dispatcher_index]->Post(task);
+  }
+
+  /// The number of dispatchers in the pool.
+  size_t size() const { return dispatchers_.size(); }
+
+  /// Accesses a dispatcher in the pool.
+  Dispatcher& dispatcher(size_t index) {
+    PW_ASSERT(index < dispatchers_.size());
+    return *dispatchers_[index];
+  }
+
+ private:
+  const span<Dispatcher* const> dispatchers_;
+};
+
+}  // namespace pw::async2
@@ -106,9 +106,16 @@ class TimeProvider : public chrono::VirtualClock<Clock> {
   virtual void DoCancel()
       PW_EXCLUSIVE_LOCKS_REQUIRED(internal::time_lock()) = 0;
 
-  // Head of the waiting timers list.
+  // Unordered list of waiting timers. Keeping the list unsorted makes
+  // arming a timer O(1) rather than an O(n) sorted insert; the earliest
+  // deadline is cached in next_wake_ and only recomputed when the timer list
+  // changes in a way that could move it.
   IntrusiveList<TimeFuture<Clock>> futures_
       PW_GUARDED_BY(internal::time_lock());
+
+  // The earliest expiration among futures_; only meaningful when futures_ is
+  // non-empty.
+  typename Clock::time_point next_wake_ PW_GUARDED_BY(internal::time_lock());
 };
 
 /// A timer which can asynchronously wait for time to pass.
@@ -216,18 +223,12 @@ class [[nodiscard]] TimeFuture
       return;
     }
 
-    if (provider_->futures_.empty() ||
-        provider_->futures_.front().expiration_ > expiration_) {
-      provider_->futures_.push_front(*this);
+    const bool was_empty = provider_->futures_.empty();
+    provider_->futures_.push_front(*this);
+    if (was_empty || expiration_ < provider_->next_wake_) {
+      provider_->next_wake_ = expiration_;
       provider_->DoInvokeAt(expiration_);
-      return;
     }
-    auto current = provider_->futures_.begin();
-    while (std::next(current) != provider_->futures_.end() &&
-           std::next(current)->expiration_ < expiration_) {
-      current++;
-    }
-    provider_->futures_.insert_after(current, *this);
   }
 
   void Unlist() PW_LOCKS_EXCLUDED(internal::time_lock()) {
@@ -237,24 +238,32 @@ class [[nodiscard]] TimeFuture
 
   // Removes this timer from the `TimeProvider`'s list (if listed).
   //
-  // If this timer was previously the `head` element of the `TimeProvider`'s
-  // list, the `TimeProvider` will be rescheduled to wake up based on the
-  // new `head`'s expiration time.
+  // If this timer may have carried the earliest expiration, the
+  // `TimeProvider` is rescheduled based on the new earliest timer.
   void UnlistLocked() PW_EXCLUSIVE_LOCKS_REQUIRED(internal::time_lock()) {
     if (this->unlisted()) {
       return;
     }
-    if (&provider_->futures_.front() == this) {
-      provider_->futures_.pop_front();
-      if (provider_->futures_.empty()) {
-        provider_->DoCancel();
-      } else {
-        provider_->DoInvokeAt(provider_->futures_.front().expiration_);
-      }
+    provider_->futures_.remove(*this);
+    if (provider_->futures_.empty()) {
+      provider_->DoCancel();
       return;
     }
-
-    provider_->futures_.remove(*this);
+    if (expiration_ == provider_->next_wake_) {
+      // This timer may have been the earliest; reschedule if the earliest
+      // remaining timer expires later.
+      auto it = provider_->futures_.begin();
+      typename Clock::time_point earliest = it->expiration_;
+      for (++it; it != provider_->futures_.end(); ++it) {
+        if (it->expiration_ < earliest) {
+          earliest = it->expiration_;
+        }
+      }
+      if (earliest != provider_->next_wake_) {
+        provider_->next_wake_ = earliest;
+        provider_->DoInvokeAt(earliest);
+      }
+    }
   }
 
   Waker waker_;
@@ -272,13 +281,28 @@ class [[nodiscard]] TimeFuture
 template <typename Clock>
 void TimeProvider<Clock>::RunExpired(typename Clock::time_point now) {
   std::lock_guard lock(internal::time_lock());
-  while (!futures_.empty()) {
-    if (futures_.front().expiration_ > now) {
-      DoInvokeAt(futures_.front().expiration_);
-      return;
+  // The timer list is unsorted: walk it once, waking every expired timer and
+  // tracking the earliest remaining expiration.
+  bool have_next = false;
+  typename Clock::time_point next = now;
+  auto it = futures_.begin();
+  while (it != futures_.end()) {
+    if (it->expiration_ <= now) {
+      TimeFuture<Clock>& expired = *it;
+      ++it;  // Advance before unlinking; the next node is unaffected.
+      futures_.remove(expired);
+      std::move(expired.waker_).Wake();
+    } else {
+      if (!have_next || it->expiration_ < next) {
+        next = it->expiration_;
+      }
+      have_next = true;
+      ++it;
     }
-    std::move(futures_.front().waker_).Wake();
-    futures_.pop_front();
+  }
+  if (have_next) {
+    next_wake_ = next;
+    DoInvokeAt(next);
   }
 }
 
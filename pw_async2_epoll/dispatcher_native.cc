@@ -119,12 +119,15 @@ Status NativeDispatcher::NativeWaitForWake() {
   for (int i = 0; i < num_events; ++i) {
     epoll_event& event = events[i];
     if (event.data.fd == wait_fd_) {
-      // Consume the wake notification.
-      char unused;
-      ssize_t bytes_read = read(wait_fd_, &unused, 1);
-      PW_CHECK_INT_EQ(
+      // Consume all pending wake notifications in one read, coalescing
+      // DoWake calls that arrived while the dispatcher was busy.
+      char unused[16];
+      ssize_t bytes_read = read(wait_fd_, unused, sizeof(unused));
+      PW_CHECK_INT_GE(
           bytes_read, 1, "Dispatcher failed to read wake notification");
-      PW_DCHECK_INT_EQ(unused, kNotificationSignal);
+      for (ssize_t j = 0; j < bytes_read; ++j) {
+        PW_DCHECK_INT_EQ(unused[j], kNotificationSignal);
+      }
       continue;
     }
 
@@ -17,9 +17,23 @@
 
 #include "pw_assert/assert.h"
 #include "pw_async2/dispatcher_base.h"
+#include "pw_preprocessor/compiler.h"
+
+/// The maximum number of epoll events consumed and dispatched per wakeup.
+/// Raising this lets a single epoll_wait call wake more tasks when many file
+/// descriptors are ready, at the cost of a larger on-stack event array.
+#ifndef PW_ASYNC2_EPOLL_MAX_EVENTS_TO_PROCESS_AT_ONCE
+#define PW_ASYNC2_EPOLL_MAX_EVENTS_TO_PROCESS_AT_ONCE 16
+#endif  // PW_ASYNC2_EPOLL_MAX_EVENTS_TO_PROCESS_AT_ONCE
 
 namespace pw::async2::backend {
 
+// NativeDispatcher is final and is only destroyed through the Dispatcher
+// facade, never through a NativeDispatcherBase pointer (whose destructor is
+// protected), so the non-virtual-destructor warning does not apply.
+PW_MODIFY_DIAGNOSTICS_PUSH();
+PW_MODIFY_DIAGNOSTIC(ignored, "-Wnon-virtual-dtor");
+
 class NativeDispatcher final : public NativeDispatcherBase {
  public:
   NativeDispatcher() { PW_ASSERT_OK(NativeInit()); }
@@ -46,7 +60,8 @@ class NativeDispatcher final : public NativeDispatcherBase {
  private:
   friend class ::pw::async2::Dispatcher;
 
-  static constexpr size_t kMaxEventsToProcessAtOnce = 5;
+  static constexpr size_t kMaxEventsToProcessAtOnce =
+      PW_ASYNC2_EPOLL_MAX_EVENTS_TO_PROCESS_AT_ONCE;
 
   struct ReadWriteWaker {
     Waker read;
@@ -67,4 +82,6 @@ class NativeDispatcher final : public NativeDispatcherBase {
   std::unordered_map<int, ReadWriteWaker> wakers_;
 };
 
+PW_MODIFY_DIAGNOSTICS_POP();
+
 }  // namespace pw::async2::backend
@@ -0,0 +1,79 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#include "pw_async/two_lane_dispatcher.h"
+
+#include "pw_async/fake_dispatcher_fixture.h"
+#include "pw_string/string.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::async {
+namespace {
+
+using TwoLaneDispatcherTest = test::FakeDispatcherFixture;
+
+TEST_F(TwoLaneDispatcherTest, DataRunsBeforeControlWithBoundedPreemption) {
+  TwoLaneDispatcher<8> lanes(dispatcher(), /* max_data_before_control= */ 2);
+
+  InlineString<8> order;
+  Task control_a([&order](Context&, Status) { order.push_back('C'); });
+  Task control_b([&order](Context&, Status) { order.push_back('c'); });
+  Task data_a([&order](Context&, Status) { order.push_back('D'); });
+  Task data_b([&order](Context&, Status) { order.push_back('d'); });
+  Task data_c([&order](Context&, Status) { order.push_back('e'); });
+
+  // Control is posted first, but data must be delivered first; after two
+  // consecutive data tasks one control task is interleaved.
+  lanes.control_lane().Post(control_a);
+  lanes.control_lane().Post(control_b);
+  lanes.data_lane().Post(data_a);
+  lanes.data_lane().Post(data_b);
+  lanes.data_lane().Post(data_c);
+
+  RunUntilIdle();
+  EXPECT_EQ(order, "DdCec");
+}
+
+TEST_F(TwoLaneDispatcherTest, ControlRunsWhenNoDataPending) {
+  TwoLaneDispatcher<4> lanes(dispatcher());
+
+  int control_runs = 0;
+  Task control([&control_runs](Context&, Status) { ++control_runs; });
+  lanes.control_lane().Post(control);
+  RunUntilIdle();
+  EXPECT_EQ(control_runs, 1);
+}
+
+TEST_F(TwoLaneDispatcherTest, CancelRemovesQueuedLaneTask) {
+  TwoLaneDispatcher<4> lanes(dispatcher());
+
+  bool ran = false;
+  Task task([&ran](Context&, Status) { ran = true; });
+  lanes.data_lane().Post(task);
+  EXPECT_TRUE(lanes.data_lane().Cancel(task));
+  RunUntilIdle();
+  EXPECT_FALSE(ran);
+}
+
+TEST_F(TwoLaneDispatcherTest, ContextReportsOwningLane) {
+  TwoLaneDispatcher<4> lanes(dispatcher());
+
+  Dispatcher* seen = nullptr;
+  Task task([&seen](Context& context, Status) { seen = context.dispatcher; });
+  lanes.control_lane().Post(task);
+  RunUntilIdle();
+  EXPECT_EQ(seen, &lanes.control_lane());
+}
+
+}  // namespace
+}  // namespace pw::async
@@ -73,17 +73,6 @@ constexpr uint8_t CharToBits(char ch) {
   return kDecodeTable[ch - kMinValidChar];
 }
 
-constexpr uint8_t Byte0(uint8_t bits0, uint8_t bits1) {
-  return static_cast<uint8_t>(bits0 << 2) | ((bits1 & 0b110000) >> 4);
-}
-constexpr uint8_t Byte1(uint8_t bits1, uint8_t bits2) {
-  return static_cast<uint8_t>((bits1 & 0b001111) << 4) |
-         ((bits2 & 0b111100) >> 2);
-}
-constexpr uint8_t Byte2(uint8_t bits2, uint8_t bits3) {
-  return static_cast<uint8_t>((bits2 & 0b000011) << 6) | bits3;
-}
-
 }  // namespace
 
 extern "C" void pw_Base64Encode(const void* binary_data,
@@ -91,13 +80,17 @@ extern "C" void pw_Base64Encode(const void* binary_data,
                                 char* output) {
   const uint8_t* bytes = static_cast<const uint8_t*>(binary_data);
 
-  // Encode groups of 3 source bytes into 4 output characters.
+  // Encode groups of 3 source bytes into 4 output characters. Each group is
+  // assembled into one 24-bit word so the four table lookups are simple
+  // shifts and masks of a register instead of per-byte bit splicing.
   size_t remaining = binary_size_bytes;
   for (; remaining >= 3u; remaining -= 3u, bytes += 3) {
-    *output++ = BitGroup0Char(bytes[0]);
-    *output++ = BitGroup1Char(bytes[0], bytes[1]);
-    *output++ = BitGroup2Char(bytes[1], bytes[2]);
-    *output++ = BitGroup3Char(bytes[2]);
+    const uint32_t group = (static_cast<uint32_t>(bytes[0]) << 16) |
+                           (static_cast<uint32_t>(bytes[1]) << 8) | bytes[2];
+    *output++ = kEncodeTable[(group >> 18) & 0b111111];
+    *output++ = kEncodeTable[(group >> 12) & 0b111111];
+    *output++ = kEncodeTable[(group >> 6) & 0b111111];
+    *output++ = kEncodeTable[group & 0b111111];
   }
 
   // If the source data length isn't a multiple of 3, pad the end with either 1
@@ -123,16 +116,19 @@ extern "C" size_t pw_Base64Decode(const char* base64,
     return 0;
   }
 
+  // Decode groups of 4 characters into one 24-bit word, then store its three
+  // bytes, rather than splicing bit fields per output byte.
   uint8_t* binary = static_cast<uint8_t*>(output);
   for (size_t ch = 0; ch < base64_size_bytes; ch += kEncodedGroupSize) {
-    const uint8_t char0 = CharToBits(base64[ch + 0]);
-    const uint8_t char1 = CharToBits(base64[ch + 1]);
-    const uint8_t char2 = CharToBits(base64[ch + 2]);
-    const uint8_t char3 = CharToBits(base64[ch + 3]);
-
-    *binary++ = Byte0(char0, char1);
-    *binary++ = Byte1(char1, char2);
-    *binary++ = Byte2(char2, char3);
+    const uint32_t group =
+        (static_cast<uint32_t>(CharToBits(base64[ch + 0])) << 18) |
+        (static_cast<uint32_t>(CharToBits(base64[ch + 1])) << 12) |
+        (static_cast<uint32_t>(CharToBits(base64[ch + 2])) << 6) |
+        CharToBits(base64[ch + 3]);
+
+    *binary++ = static_cast<uint8_t>(group >> 16);
+    *binary++ = static_cast<uint8_t>(group >> 8);
+    *binary++ = static_cast<uint8_t>(group);
   }
 
   size_t pad = 0;
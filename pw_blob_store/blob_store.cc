@@ -88,6 +88,24 @@ Status BlobStore::LoadMetadata() {
     return Status::NotFound();
   }
 
+#if PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY
+  // Trust the metadata for now; the checksum is verified incrementally as the
+  // blob is read. Only sanity-check what can be checked without a scan.
+  if (metadata.v1_metadata.data_size_bytes > MaxDataSizeBytes() ||
+      (checksum_algo_ == nullptr && metadata.v1_metadata.checksum != 0)) {
+    PW_LOG_ERROR("BlobStore init - Invalidating blob with invalid metadata");
+    Invalidate().IgnoreError();
+    return Status::DataLoss();
+  }
+  metadata_checksum_ = metadata.v1_metadata.checksum;
+  lazy_verify_pending_ = (checksum_algo_ != nullptr) &&
+                         (metadata.v1_metadata.data_size_bytes > 0);
+  lazy_verify_failed_ = false;
+  verified_bytes_ = 0;
+  if (lazy_verify_pending_) {
+    checksum_algo_->Reset();
+  }
+#else
   if (!ValidateChecksum(metadata.v1_metadata.data_size_bytes,
                         metadata.v1_metadata.checksum)
            .ok()) {
@@ -98,6 +116,7 @@ Status BlobStore::LoadMetadata() {
     Invalidate().IgnoreError();
     return Status::DataLoss();
   }
+#endif  // PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY
 
   write_address_ = metadata.v1_metadata.data_size_bytes;
   flash_address_ = metadata.v1_metadata.data_size_bytes;
@@ -124,6 +143,16 @@ Status BlobStore::OpenWrite() {
 
   writer_open_ = true;
 
+  // The writer reuses the checksum algorithm, so any in-progress lazy
+  // verification is abandoned.
+  lazy_verify_pending_ = false;
+
+  // Select the active accumulation buffer: the first half in double-buffered
+  // mode, or the whole buffer otherwise.
+  write_buffer_ = DoubleBuffered()
+                      ? write_buffer_storage_.first(flash_write_size_bytes_)
+                      : write_buffer_storage_;
+
   // Clear any existing contents. Invalidate return status can be safely be
   // ignored, only KVS::Delete can result in an error and that KVS entry will
   // overwriten on write Close.
@@ -423,18 +452,59 @@ Status BlobStore::FlushFinalPartialChunk() {
   return CommitToFlash(remaining_bytes, bytes_in_buffer);
 }
 
+Status BlobStore::AwaitAsyncWrite() {
+  if (!async_write_pending_) {
+    return OkStatus();
+  }
+  async_write_pending_ = false;
+  Status status = partition_.AwaitWriteCompletion();
+  if (!status.ok()) {
+    valid_data_ = false;
+  }
+  return status;
+}
+
 Status BlobStore::CommitToFlash(ConstByteSpan source, size_t data_bytes) {
   if (data_bytes == 0) {
     data_bytes = source.size_bytes();
   }
 
   flash_erased_ = false;
-  StatusWithSize result = partition_.Write(flash_address_, source);
+
+  // Wait for the previous chunk to finish programming before starting the
+  // next one.
+  if (!AwaitAsyncWrite().ok()) {
+    return Status::DataLoss();
+  }
+
+  // In double-buffered mode, commits from the write buffer program the flash
+  // asynchronously while accumulation switches to the other half of the
+  // buffer. Commits directly from caller data stay synchronous, since the
+  // source span is not owned by the blob store.
+  const bool pipeline_write =
+      DoubleBuffered() && !write_buffer_.empty() &&
+      source.data() == write_buffer_.data();
+
+  StatusWithSize result;
+  if (pipeline_write) {
+    result = partition_.StartWrite(flash_address_, source);
+    async_write_pending_ = true;
+  } else {
+    result = partition_.Write(flash_address_, source);
+  }
   flash_address_ += data_bytes;
   if (checksum_algo_ != nullptr) {
     checksum_algo_->Update(source.first(data_bytes));
   }
 
+  if (pipeline_write) {
+    write_buffer_ =
+        (write_buffer_.data() == write_buffer_storage_.data())
+            ? write_buffer_storage_.subspan(flash_write_size_bytes_,
+                                            flash_write_size_bytes_)
+            : write_buffer_storage_.first(flash_write_size_bytes_);
+  }
+
   if (!result.status().ok()) {
     valid_data_ = false;
   }
@@ -456,6 +526,7 @@ size_t BlobStore::WriteBufferBytesFree() const {
 }
 
 Status BlobStore::EraseIfNeeded() {
+  PW_TRY(AwaitAsyncWrite());
   if (flash_address_ == 0) {
     // Always just erase. Erase is smart enough to only erase if needed.
     return Erase();
@@ -467,6 +538,9 @@ StatusWithSize BlobStore::Read(size_t offset, ByteSpan dest) const {
   if (!HasData()) {
     return StatusWithSize::FailedPrecondition();
   }
+  if (lazy_verify_failed_) {
+    return StatusWithSize::DataLoss();
+  }
   if (offset >= ReadableDataBytes()) {
     return StatusWithSize::OutOfRange();
   }
@@ -474,13 +548,63 @@ StatusWithSize BlobStore::Read(size_t offset, ByteSpan dest) const {
   size_t available_bytes = ReadableDataBytes() - offset;
   size_t read_size = std::min(available_bytes, dest.size_bytes());
 
-  return partition_.Read(offset, dest.first(read_size));
+  StatusWithSize result = partition_.Read(offset, dest.first(read_size));
+
+  if (lazy_verify_pending_ && result.ok()) {
+    // Hash any bytes skipped over, then the newly read bytes past the
+    // verified prefix. AdvanceLazyVerify finalizes the verification when the
+    // end of the blob is reached.
+    if (offset > verified_bytes_) {
+      PW_TRY_WITH_SIZE(AdvanceLazyVerify(offset));
+    }
+    const size_t read_end = offset + read_size;
+    if (read_end > verified_bytes_) {
+      checksum_algo_->Update(
+          dest.subspan(verified_bytes_ - offset, read_end - verified_bytes_));
+      verified_bytes_ = read_end;
+    }
+    PW_TRY_WITH_SIZE(AdvanceLazyVerify(verified_bytes_));
+  }
+
+  return result;
+}
+
+Status BlobStore::AdvanceLazyVerify(size_t target_offset) const {
+  constexpr size_t kReadBufferSizeBytes = 32;
+  std::array<std::byte, kReadBufferSizeBytes> buffer;
+
+  while (verified_bytes_ < target_offset) {
+    const size_t read_size =
+        std::min(target_offset - verified_bytes_, buffer.size());
+    PW_TRY(partition_.Read(verified_bytes_, span(buffer).first(read_size)));
+    checksum_algo_->Update(buffer.data(), read_size);
+    verified_bytes_ += read_size;
+  }
+
+  if (verified_bytes_ == ReadableDataBytes()) {
+    lazy_verify_pending_ = false;
+    const internal::ChecksumValue expected = metadata_checksum_;
+    if (!checksum_algo_->Verify(as_bytes(span(&expected, 1))).ok()) {
+      PW_LOG_ERROR("Blob checksum mismatch detected during lazy verification");
+      lazy_verify_failed_ = true;
+      return Status::DataLoss();
+    }
+    PW_LOG_DEBUG("Blob lazily verified successfully");
+  }
+  return OkStatus();
 }
 
 Result<ConstByteSpan> BlobStore::GetMemoryMappedBlob() const {
   if (!HasData()) {
     return Status::FailedPrecondition();
   }
+  if (lazy_verify_failed_) {
+    return Status::DataLoss();
+  }
+  if (lazy_verify_pending_) {
+    // Never hand out an unverified span; finish the verification now.
+    PW_TRY(AdvanceLazyVerify(ReadableDataBytes()));
+  }
 
   std::byte* mcu_address = partition_.PartitionAddressToMcuAddress(0);
   if (mcu_address == nullptr) {
@@ -495,6 +619,8 @@ size_t BlobStore::ReadableDataBytes() const {
 }
 
 Status BlobStore::Erase() {
+  PW_TRY(AwaitAsyncWrite());
+
   // If already erased our work here is done.
   if (flash_erased_) {
     // The write buffer might already have bytes when this call happens, due to
@@ -526,6 +652,10 @@ Status BlobStore::Erase() {
 }
 
 Status BlobStore::Invalidate() {
+  lazy_verify_pending_ = false;
+  lazy_verify_failed_ = false;
+  verified_bytes_ = 0;
+
   // Blob data is considered valid if the flash is erased. Even though
   // there are 0 bytes written, they are valid.
   valid_data_ = flash_erased_;
@@ -541,6 +671,7 @@ Status BlobStore::Invalidate() {
 
 Status BlobStore::ValidateChecksum(size_t blob_size_bytes,
                                    ChecksumValue expected) {
+  PW_TRY(AwaitAsyncWrite());
   if (blob_size_bytes == 0) {
     PW_LOG_INFO("Blob unable to validate checksum of an empty blob");
     return Status::Unavailable();
@@ -760,6 +891,10 @@ Status BlobStore::BlobWriter::Close() {
     }
     PW_DCHECK(store_.WriteBufferEmpty());
 
+    // Ensure the final chunk has finished programming before the blob is
+    // validated and its metadata written.
+    PW_TRY(store_.AwaitAsyncWrite());
+
     if (!WriteMetadata().ok()) {
       return Status::DataLoss();
     }
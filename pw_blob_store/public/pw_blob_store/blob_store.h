@@ -16,6 +16,7 @@
 #include <cstddef>
 
 #include "pw_assert/assert.h"
+#include "pw_blob_store/internal/config.h"
 #include "pw_blob_store/internal/metadata_format.h"
 #include "pw_bytes/span.h"
 #include "pw_kvs/checksum.h"
@@ -436,6 +437,7 @@ class BlobStore {
         partition_(partition),
         checksum_algo_(checksum_algo),
         kvs_(kvs),
+        write_buffer_storage_(write_buffer),
         write_buffer_(write_buffer),
         flash_write_size_bytes_(flash_write_size_bytes),
         initialized_(false),
@@ -575,6 +577,20 @@ class BlobStore {
 
   Status EraseIfNeeded();
 
+  // True if writes are pipelined through the two halves of the write buffer.
+  bool DoubleBuffered() const {
+    return partition_.supports_async_write() &&
+           write_buffer_storage_.size_bytes() >= 2 * flash_write_size_bytes_;
+  }
+
+  // Waits for an outstanding asynchronous flash write, if any.
+  Status AwaitAsyncWrite();
+
+  // Feeds blob bytes [verified_bytes_, target_offset) from flash into the
+  // checksum and, on reaching the end of the blob, verifies it against the
+  // stored metadata checksum. Used for lazy verification.
+  Status AdvanceLazyVerify(size_t target_offset) const;
+
   // Read valid data. Attempts to read the lesser of output.size_bytes() or
   // available bytes worth of data. Returns:
   //
@@ -636,8 +652,30 @@ class BlobStore {
   // checksum_algo_ of nullptr indicates no checksum algorithm.
   kvs::ChecksumAlgorithm* const checksum_algo_;
   sync::Borrowable<kvs::KeyValueStore> kvs_;
+  // The full caller-provided write buffer. When the partition supports
+  // asynchronous writes and the buffer holds at least two flash write sizes,
+  // it is used as two ping-pong halves so the next chunk can accumulate while
+  // the previous one programs.
+  const ByteSpan write_buffer_storage_;
+
+  // The active accumulation buffer: all of write_buffer_storage_, or the
+  // currently-filling half in double-buffered mode.
   ByteSpan write_buffer_;
 
+  // True while a write started with FlashPartition::StartWrite is
+  // outstanding.
+  bool async_write_pending_ = false;
+
+  // Lazy checksum verification state, used when
+  // PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY is enabled. The prefix of the
+  // blob that has been hashed so far is tracked per store, so interleaved
+  // readers share progress. Mutable because verification advances during
+  // const reads.
+  mutable bool lazy_verify_pending_ = false;
+  mutable bool lazy_verify_failed_ = false;
+  mutable size_t verified_bytes_ = 0;
+  internal::ChecksumValue metadata_checksum_ = 0;
+
   // Size in bytes of flash write operations. This should be chosen to balance
   // optimal write size and required buffer size. Must be GE flash write
   // alignment, LE flash sector size.
@@ -0,0 +1,27 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+// When enabled, BlobStore::Init trusts the stored metadata instead of walking
+// the entire committed blob through the checksum algorithm, and verification
+// runs incrementally alongside reads: each sequentially read byte is fed into
+// the checksum, and the read that reaches the end of the blob fails with
+// DATA_LOSS if the checksum does not match. Reads that skip ahead hash the
+// skipped bytes from flash first, and GetMemoryMappedBlob() verifies whatever
+// remains before returning, so data is never consumed unverified. This trades
+// boot/open latency for a deferred failure: a corrupt blob is discovered
+// during the first full read instead of at Init.
+#ifndef PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY
+#define PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY 0
+#endif  // PW_BLOB_STORE_CONFIG_LAZY_CHECKSUM_VERIFY
@@ -0,0 +1,68 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+// Boot-time breakdown instrumentation. Implementations of the pw_boot hooks
+// (pw_boot_PreStaticMemoryInit, pw_boot_PreMainInit, ...) and early
+// pw_system init code call pw_boot_RecordStage with a raw timestamp (cycle
+// counter or early timer) to build a timeline of where boot time goes. The
+// table is statically allocated with no initialization dependencies, so it is
+// usable from the first hook onward; place it in a persistent-RAM section
+// (e.g. with PW_PLACE_IN_SECTION) to make the breakdown of the *previous*
+// boot readable after a crash or watchdog reset.
+//
+// This header is C-compatible, matching the pw_boot hook interface.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Maximum number of boot stages recorded.
+#ifndef PW_BOOT_TIMELINE_MAX_STAGES
+#define PW_BOOT_TIMELINE_MAX_STAGES 16
+#endif  // PW_BOOT_TIMELINE_MAX_STAGES
+
+typedef struct {
+  // Caller-chosen stage identifier (e.g. a tokenized name).
+  uint32_t stage_id;
+  // Raw timestamp in whatever unit the caller's time source provides.
+  uint32_t timestamp;
+} pw_boot_StageRecord;
+
+typedef struct {
+  uint32_t count;
+  pw_boot_StageRecord stages[PW_BOOT_TIMELINE_MAX_STAGES];
+} pw_boot_Timeline;
+
+// The timeline table. Defined by the application, typically placed in a
+// persistent-RAM or noinit section so it survives resets; zero `count` during
+// cold boot (or consume and reset it) before recording.
+extern pw_boot_Timeline pw_boot_timeline;
+
+// Records a stage timestamp. Safe from the earliest boot hooks: no
+// initialization, allocation, or locking. Stages beyond the table capacity
+// are dropped.
+static inline void pw_boot_RecordStage(uint32_t stage_id, uint32_t timestamp) {
+  if (pw_boot_timeline.count < PW_BOOT_TIMELINE_MAX_STAGES) {
+    pw_boot_timeline.stages[pw_boot_timeline.count].stage_id = stage_id;
+    pw_boot_timeline.stages[pw_boot_timeline.count].timestamp = timestamp;
+    pw_boot_timeline.count += 1;
+  }
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
@@ -53,6 +53,7 @@
 
 #include "pw_boot/boot.h"
 #include "pw_boot_cortex_m/boot.h"
+#include "pw_boot_cortex_m/early_copy.h"
 #include "pw_preprocessor/arch.h"
 #include "pw_preprocessor/compiler.h"
 
@@ -78,6 +79,12 @@ extern uint8_t _pw_zero_init_ram_end;
 // Functions called as part of firmware initialization.
 void __libc_init_array(void);
 
+// Default (empty) early-copy list; applications with profiled-hot sections
+// staged in TCM override both symbols (see early_copy.h).
+PW_WEAK const pw_boot_EarlyCopyRegion pw_boot_early_copy_table[1] = {
+    {NULL, NULL, 0}};
+PW_WEAK const size_t pw_boot_early_copy_region_count = 0;
+
 // WARNING: Be EXTREMELY careful when running code before this function
 // completes. The context before this function violates the C spec
 // (Section 6.7.8, paragraph 10 for example, which requires uninitialized static
@@ -92,6 +99,14 @@ void StaticMemoryInit(void) {
   memset(&_pw_zero_init_ram_start,
          0,
          &_pw_zero_init_ram_end - &_pw_zero_init_ram_start);
+
+  // Copy profiled-hot code/data into fast memory (ITCM/DTCM) so the rest of
+  // boot executes it from TCM rather than cold XIP flash. See early_copy.h.
+  for (size_t i = 0; i < pw_boot_early_copy_region_count; i++) {
+    memcpy(pw_boot_early_copy_table[i].destination,
+           pw_boot_early_copy_table[i].source,
+           pw_boot_early_copy_table[i].size);
+  }
 }
 
 // WARNING: This code is run immediately upon boot, and performs initialization
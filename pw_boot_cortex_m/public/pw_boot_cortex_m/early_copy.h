@@ -0,0 +1,64 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+// Profile-guided early copy of hot code/data into fast memory.
+//
+// Manual ITCM/DTCM placement is all-or-nothing: either a whole library is
+// linked into TCM or it executes from cold XIP flash. This mechanism gives
+// profile-guided granularity. Functions and data identified as boot-hot
+// (e.g. from a pw_boot timeline profile) are annotated with the section
+// macros below; the linker script collects those sections into TCM regions
+// with load addresses in flash, and the application lists each region in
+// pw_boot_early_copy_table. StaticMemoryInit() copies every listed region
+// into place immediately after .data/.bss initialization -- before static
+// constructors and main() -- so the profiled-hot init paths already execute
+// from TCM during boot.
+//
+// This header is C-compatible, matching the pw_boot hook interface.
+
+#include <stddef.h>
+
+#include "pw_preprocessor/compiler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// One region to copy from its flash load address into fast memory.
+typedef struct {
+  // Destination in ITCM/DTCM (the section's virtual address).
+  void* destination;
+  // Source in flash (the section's load address, e.g. LOADADDR() in the
+  // linker script).
+  const void* source;
+  // Bytes to copy.
+  size_t size;
+} pw_boot_EarlyCopyRegion;
+
+// The copy list, defined by the application (often generated alongside the
+// linker script from a boot profile). Weak empty defaults are provided, so
+// targets without TCM staging need no definitions.
+extern const pw_boot_EarlyCopyRegion pw_boot_early_copy_table[];
+extern const size_t pw_boot_early_copy_region_count;
+
+// Annotations for profiled-hot code/data. The linker script places these
+// sections in ITCM/DTCM with flash load addresses and exports the
+// boundary/load symbols used to build the copy table.
+#define PW_BOOT_HOT_TEXT PW_KEEP_IN_SECTION(".pw_boot_hot_text")
+#define PW_BOOT_HOT_DATA PW_KEEP_IN_SECTION(".pw_boot_hot_data")
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
@@ -0,0 +1,94 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_bytes/search.h
+///
+/// Byte search and comparison utilities over spans. These route through the
+/// libc `memchr`/`memcmp` kernels, which are vectorized or word-at-a-time on
+/// every supported toolchain, instead of the byte-at-a-time loops that tend
+/// to be hand-written at call sites (protocol scanners, delimiter searches,
+/// buffer diffing).
+
+#include <cstddef>
+#include <cstring>
+
+#include "pw_bytes/span.h"
+
+namespace pw::bytes {
+
+/// Returned by the find functions when no match exists.
+inline constexpr size_t npos = static_cast<size_t>(-1);
+
+/// Finds the first occurrence of `value`, returning its offset or `npos`.
+inline size_t FindByte(ConstByteSpan haystack, std::byte value) {
+  if (haystack.empty()) {
+    return npos;
+  }
+  const void* match =
+      std::memchr(haystack.data(), static_cast<int>(value), haystack.size());
+  return match == nullptr
+             ? npos
+             : static_cast<size_t>(static_cast<const std::byte*>(match) -
+                                   haystack.data());
+}
+
+/// Finds the first occurrence of the byte sequence `needle`, returning its
+/// offset or `npos`. An empty needle matches at offset 0. Candidate positions
+/// are located with `memchr` on the first needle byte and confirmed with
+/// `memcmp`, so the common no-match and sparse-match cases run at libc scan
+/// speed.
+inline size_t FindBytes(ConstByteSpan haystack, ConstByteSpan needle) {
+  if (needle.empty()) {
+    return 0;
+  }
+  if (needle.size() > haystack.size()) {
+    return npos;
+  }
+  ConstByteSpan remaining = haystack;
+  while (remaining.size() >= needle.size()) {
+    const size_t candidate = FindByte(
+        remaining.first(remaining.size() - needle.size() + 1), needle[0]);
+    if (candidate == npos) {
+      return npos;
+    }
+    if (std::memcmp(remaining.data() + candidate,
+                    needle.data(),
+                    needle.size()) == 0) {
+      return static_cast<size_t>(remaining.data() + candidate -
+                                 haystack.data());
+    }
+    remaining = remaining.subspan(candidate + 1);
+  }
+  return npos;
+}
+
+/// True if `haystack` contains `value`.
+inline bool Contains(ConstByteSpan haystack, std::byte value) {
+  return FindByte(haystack, value) != npos;
+}
+
+/// True if `haystack` contains the byte sequence `needle`.
+inline bool Contains(ConstByteSpan haystack, ConstByteSpan needle) {
+  return FindBytes(haystack, needle) != npos;
+}
+
+/// True if the spans hold equal bytes.
+inline bool Equal(ConstByteSpan lhs, ConstByteSpan rhs) {
+  return lhs.size() == rhs.size() &&
+         (lhs.empty() ||
+          std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+}  // namespace pw::bytes
@@ -0,0 +1,63 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_bytes/search.h"
+
+#include "pw_bytes/array.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::bytes {
+namespace {
+
+constexpr auto kData = bytes::String("finding a needle in a haystack");
+
+TEST(FindByte, FindsAndReportsMisses) {
+  EXPECT_EQ(FindByte(kData, std::byte{'f'}), 0u);
+  EXPECT_EQ(FindByte(kData, std::byte{'n'}), 2u);
+  EXPECT_EQ(FindByte(kData, std::byte{'k'}), kData.size() - 1);
+  EXPECT_EQ(FindByte(kData, std::byte{'z'}), npos);
+  EXPECT_EQ(FindByte(ConstByteSpan(), std::byte{'a'}), npos);
+}
+
+TEST(FindBytes, FindsSequences) {
+  EXPECT_EQ(FindBytes(kData, bytes::String("needle")), 10u);
+  EXPECT_EQ(FindBytes(kData, bytes::String("finding")), 0u);
+  EXPECT_EQ(FindBytes(kData, bytes::String("haystack")), 22u);
+  EXPECT_EQ(FindBytes(kData, bytes::String("needles")), npos);
+  EXPECT_EQ(FindBytes(kData, ConstByteSpan()), 0u);
+  EXPECT_EQ(FindBytes(bytes::String("ab"), bytes::String("abc")), npos);
+}
+
+TEST(FindBytes, RepeatedFirstBytes) {
+  constexpr auto kRepeats = bytes::String("aaabaaabaabaaaab");
+  EXPECT_EQ(FindBytes(kRepeats, bytes::String("aaaab")), 11u);
+  EXPECT_EQ(FindBytes(kRepeats, bytes::String("aab")), 1u);
+}
+
+TEST(Contains, ByteAndSequence) {
+  EXPECT_TRUE(Contains(kData, std::byte{'y'}));
+  EXPECT_FALSE(Contains(kData, std::byte{'!'}));
+  EXPECT_TRUE(Contains(kData, bytes::String(" a ")));
+  EXPECT_FALSE(Contains(kData, bytes::String("AA")));
+}
+
+TEST(Equal, ComparesSpans) {
+  EXPECT_TRUE(Equal(kData, kData));
+  EXPECT_TRUE(Equal(ConstByteSpan(), ConstByteSpan()));
+  EXPECT_FALSE(Equal(kData, ConstByteSpan(kData).subspan(1)));
+  EXPECT_FALSE(Equal(bytes::String("abc"), bytes::String("abd")));
+}
+
+}  // namespace
+}  // namespace pw::bytes
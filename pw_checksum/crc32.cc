@@ -15,6 +15,7 @@
 #include "pw_checksum/crc32.h"
 
 #include <array>
+#include <cstring>
 
 namespace pw::checksum {
 namespace {
@@ -49,6 +50,25 @@ constexpr std::array<uint32_t, (1 << kBits)> GenerateCrc32Table() {
   return table;
 }
 
+// Generates the lookup tables for a slice-by-N CRC32 implementation. Table 0
+// is the regular byte-at-a-time table; table k gives the CRC contribution of
+// a byte that is k positions ahead in the input.
+template <std::size_t kSlices, uint32_t kPolynomial>
+constexpr std::array<std::array<uint32_t, 256>, kSlices>
+GenerateCrc32SliceTables() {
+  std::array<std::array<uint32_t, 256>, kSlices> tables{};
+  for (uint32_t i = 0; i < 256; i++) {
+    tables[0][i] = Crc32ProcessDataChunk<8, kPolynomial>(i);
+  }
+  for (std::size_t slice = 1; slice < kSlices; slice++) {
+    for (uint32_t i = 0; i < 256; i++) {
+      tables[slice][i] = (tables[slice - 1][i] >> 8) ^
+                         tables[0][tables[slice - 1][i] & 0xFFu];
+    }
+  }
+  return tables;
+}
+
 // Reversed polynomial for the commonly used CRC32 variant. See:
 // https://en.wikipedia.org/wiki/Cyclic_redundancy_check#Polynomial_representations_of_cyclic_redundancy_checks
 constexpr uint32_t kCrc32Polynomial = 0xEDB88320;
@@ -69,6 +89,50 @@ extern "C" uint32_t _pw_checksum_InternalCrc32EightBit(const void* data,
   return state;
 }
 
+extern "C" uint32_t _pw_checksum_InternalCrc32SliceBy8(const void* data,
+                                                       size_t size_bytes,
+                                                       uint32_t state) {
+  static constexpr std::array<std::array<uint32_t, 256>, 8> kCrc32Tables =
+      GenerateCrc32SliceTables<8, kCrc32Polynomial>();
+  const uint8_t* data_bytes = static_cast<const uint8_t*>(data);
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // Align to an 8-byte boundary so the word loads below are aligned.
+  while (size_bytes != 0 &&
+         (reinterpret_cast<uintptr_t>(data_bytes) & 7u) != 0) {
+    state = kCrc32Tables[0][(state ^ *data_bytes++) & 0xFFu] ^ (state >> 8);
+    size_bytes--;
+  }
+
+  while (size_bytes >= 8) {
+    uint32_t first_word;
+    uint32_t second_word;
+    std::memcpy(&first_word, data_bytes, sizeof(first_word));
+    std::memcpy(&second_word, data_bytes + 4, sizeof(second_word));
+    first_word ^= state;
+
+    state = kCrc32Tables[7][first_word & 0xFFu] ^
+            kCrc32Tables[6][(first_word >> 8) & 0xFFu] ^
+            kCrc32Tables[5][(first_word >> 16) & 0xFFu] ^
+            kCrc32Tables[4][first_word >> 24] ^
+            kCrc32Tables[3][second_word & 0xFFu] ^
+            kCrc32Tables[2][(second_word >> 8) & 0xFFu] ^
+            kCrc32Tables[1][(second_word >> 16) & 0xFFu] ^
+            kCrc32Tables[0][second_word >> 24];
+
+    data_bytes += 8;
+    size_bytes -= 8;
+  }
+#endif  // little-endian
+
+  // Remaining bytes (everything, on big-endian targets) one at a time.
+  for (size_t i = 0; i < size_bytes; ++i) {
+    state = kCrc32Tables[0][(state ^ data_bytes[i]) & 0xFFu] ^ (state >> 8);
+  }
+
+  return state;
+}
+
 extern "C" uint32_t _pw_checksum_InternalCrc32FourBit(const void* data,
                                                       size_t size_bytes,
                                                       uint32_t state) {
@@ -41,6 +41,8 @@ constexpr uint32_t kStringCrc = 0x9EC87F88;
 
 TEST(Crc32, Empty) {
   EXPECT_EQ(Crc32::Calculate(span<std::byte>()), PW_CHECKSUM_EMPTY_CRC32);
+  EXPECT_EQ(Crc32SliceBy8::Calculate(span<std::byte>()),
+            PW_CHECKSUM_EMPTY_CRC32);
   EXPECT_EQ(Crc32EightBit::Calculate(span<std::byte>()),
             PW_CHECKSUM_EMPTY_CRC32);
   EXPECT_EQ(Crc32FourBit::Calculate(span<std::byte>()),
@@ -50,6 +52,7 @@ TEST(Crc32, Empty) {
 
 TEST(Crc32, Buffer) {
   EXPECT_EQ(Crc32::Calculate(as_bytes(span(kBytes))), kBufferCrc);
+  EXPECT_EQ(Crc32SliceBy8::Calculate(as_bytes(span(kBytes))), kBufferCrc);
   EXPECT_EQ(Crc32EightBit::Calculate(as_bytes(span(kBytes))), kBufferCrc);
   EXPECT_EQ(Crc32FourBit::Calculate(as_bytes(span(kBytes))), kBufferCrc);
   EXPECT_EQ(Crc32OneBit::Calculate(as_bytes(span(kBytes))), kBufferCrc);
@@ -57,6 +60,7 @@ TEST(Crc32, Buffer) {
 
 TEST(Crc32, String) {
   EXPECT_EQ(Crc32::Calculate(as_bytes(span(kString))), kStringCrc);
+  EXPECT_EQ(Crc32SliceBy8::Calculate(as_bytes(span(kString))), kStringCrc);
   EXPECT_EQ(Crc32EightBit::Calculate(as_bytes(span(kString))), kStringCrc);
   EXPECT_EQ(Crc32FourBit::Calculate(as_bytes(span(kString))), kStringCrc);
   EXPECT_EQ(Crc32OneBit::Calculate(as_bytes(span(kString))), kStringCrc);
@@ -73,6 +77,7 @@ void TestByByte() {
 
 TEST(Crc32Class, ByteByByte) {
   TestByByte<Crc32>();
+  TestByByte<Crc32SliceBy8>();
   TestByByte<Crc32EightBit>();
   TestByByte<Crc32FourBit>();
   TestByByte<Crc32OneBit>();
@@ -87,6 +92,7 @@ void TestBuffer() {
 
 TEST(Crc32Class, Buffer) {
   TestBuffer<Crc32>();
+  TestBuffer<Crc32SliceBy8>();
   TestBuffer<Crc32EightBit>();
   TestBuffer<Crc32FourBit>();
   TestBuffer<Crc32OneBit>();
@@ -102,6 +108,7 @@ void TestBufferAppend() {
 
 TEST(Crc32Class, BufferAppend) {
   TestBufferAppend<Crc32>();
+  TestBufferAppend<Crc32SliceBy8>();
   TestBufferAppend<Crc32EightBit>();
   TestBufferAppend<Crc32FourBit>();
   TestBufferAppend<Crc32OneBit>();
@@ -114,8 +121,19 @@ void TestString() {
   EXPECT_EQ(crc32.value(), kStringCrc);
 }
 
+TEST(Crc32Class, SliceBy8_UnalignedOffsets) {
+  // Exercise the slice-by-8 alignment prologue by starting at every offset
+  // within a word.
+  const auto data = as_bytes(span(kString));
+  for (size_t offset = 0; offset < 8; ++offset) {
+    EXPECT_EQ(Crc32SliceBy8::Calculate(data.subspan(offset)),
+              Crc32EightBit::Calculate(data.subspan(offset)));
+  }
+}
+
 TEST(Crc32Class, String) {
   TestString<Crc32>();
+  TestString<Crc32SliceBy8>();
   TestString<Crc32EightBit>();
   TestString<Crc32FourBit>();
   TestString<Crc32OneBit>();
@@ -46,12 +46,32 @@ uint32_t _pw_checksum_InternalCrc32OneBit(const void* data,
                                           size_t size_bytes,
                                           uint32_t state);
 
-#if PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_8BITS
+// Slice-by-8 implementation that processes 8 bytes per iteration with eight
+// 256-entry lookup tables (8 KiB). The fastest software variant for large
+// buffers.
+uint32_t _pw_checksum_InternalCrc32SliceBy8(const void* data,
+                                            size_t size_bytes,
+                                            uint32_t state);
+
+// Implemented by the platform when PW_CHECKSUM_CRC32_DEFAULT_IMPL is
+// PW_CHECKSUM_CRC32_CUSTOM, e.g. with a hardware CRC unit or the ARMv8 CRC32
+// instructions. The function updates the raw (non-finalized) CRC32 state for
+// the standard reflected polynomial 0xEDB88320; it receives and returns the
+// state without the final inversion applied.
+uint32_t pw_checksum_InternalCrc32Custom(const void* data,
+                                         size_t size_bytes,
+                                         uint32_t state);
+
+#if PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_SLICE8
+#define _pw_checksum_InternalCrc32 _pw_checksum_InternalCrc32SliceBy8
+#elif PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_8BITS
 #define _pw_checksum_InternalCrc32 _pw_checksum_InternalCrc32EightBit
 #elif PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_4BITS
 #define _pw_checksum_InternalCrc32 _pw_checksum_InternalCrc32FourBit
 #elif PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_1BITS
 #define _pw_checksum_InternalCrc32 _pw_checksum_InternalCrc32OneBit
+#elif PW_CHECKSUM_CRC32_DEFAULT_IMPL == PW_CHECKSUM_CRC32_CUSTOM
+#define _pw_checksum_InternalCrc32 pw_checksum_InternalCrc32Custom
 #endif
 
 // Calculates the CRC32 for the provided data.
@@ -113,6 +133,7 @@ class Crc32Impl {
 };
 
 using Crc32 = Crc32Impl<_pw_checksum_InternalCrc32>;
+using Crc32SliceBy8 = Crc32Impl<_pw_checksum_InternalCrc32SliceBy8>;
 using Crc32EightBit = Crc32Impl<_pw_checksum_InternalCrc32EightBit>;
 using Crc32FourBit = Crc32Impl<_pw_checksum_InternalCrc32FourBit>;
 using Crc32OneBit = Crc32Impl<_pw_checksum_InternalCrc32OneBit>;
@@ -88,12 +88,23 @@ class LogStore(logging.Handler):
                 project_file=False, project_user_file=False, user_file=False
             )
         self.prefs = prefs
+        # Only allow this many log lines in memory; older lines are evicted
+        # ring-buffer style as new ones arrive.
+        self.max_history_size: int = 1000000
+
         # Log storage deque for fast addition and deletion from the beginning
-        # and end of the iterable.
-        self.logs: collections.deque = collections.deque()
+        # and end of the iterable. Bounded so long-running high-rate sessions
+        # ingest indefinitely with flat memory instead of growing until the
+        # host swaps.
+        self.logs: collections.deque = collections.deque(
+            maxlen=self.max_history_size
+        )
 
-        # Only allow this many log lines in memory.
-        self.max_history_size: int = 1000000
+        # Number of lines evicted from the front of the deque after it
+        # filled. get_total_count() stays monotonic across evictions, and
+        # absolute line index i (while still retained) lives at
+        # self.logs[i - self.evicted_count].
+        self.evicted_count: int = 0
 
         # Counts of logs per python logger name
         self.channel_counts: dict[str, int] = {}
@@ -143,7 +154,8 @@ class LogStore(logging.Handler):
 
     def clear_logs(self):
         """Erase all stored pane lines."""
-        self.logs = collections.deque()
+        self.logs = collections.deque(maxlen=self.max_history_size)
+        self.evicted_count = 0
         self.channel_counts = {}
         self.channel_formatted_prefix_widths = {}
         self.line_index = 0
@@ -158,8 +170,13 @@ class LogStore(logging.Handler):
         )
 
     def get_total_count(self):
-        """Total size of the logs store."""
-        return len(self.logs)
+        """Total number of logs ingested, including evicted lines.
+
+        Monotonically increasing, so index-delta consumers keep seeing new
+        entries after the deque fills; subtract evicted_count to index into
+        self.logs.
+        """
+        return self.evicted_count + len(self.logs)
 
     def get_last_log_index(self):
         """Last valid index of the logs."""
@@ -214,7 +231,12 @@ class LogStore(logging.Handler):
         # Format incoming log line.
         formatted_log = self.format(record)
         ansi_stripped_log = strip_ansi(formatted_log)
-        # Save this log.
+        # Save this log; appending to a full deque evicts the oldest line.
+        if (
+            self.logs.maxlen is not None
+            and len(self.logs) == self.logs.maxlen
+        ):
+            self.evicted_count += 1
         self.logs.append(
             LogLine(
                 record=record,
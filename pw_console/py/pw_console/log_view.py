@@ -202,12 +202,17 @@ class LogView:
                 await asyncio.sleep(0.5)
 
             _start_log_index, log_source = self._get_log_lines()
+            # Indices are absolute line numbers; the log store deque evicts
+            # old lines once full, so translate and skip past anything this
+            # client can no longer be served.
+            evicted = 0 if self.filtering_on else self.log_store.evicted_count
             log_index_range = range(
-                self._last_served_websocket_index + 1, self.get_total_count()
+                max(self._last_served_websocket_index + 1, evicted),
+                self.get_total_count(),
             )
 
             for i in log_index_range:
-                log_text = formatter(log_source[i])
+                log_text = formatter(log_source[i - evicted])
                 await websocket.send(log_text)
                 self._last_served_websocket_index = i
 
@@ -498,18 +503,16 @@ class LogView:
 
     async def filter_past_logs(self):
         """Filter past log lines."""
-        starting_index = self.log_store.get_last_log_index()
-        ending_index = -1
-
-        # From the end of the log store to the beginning.
-        for i in range(starting_index, ending_index, -1):
+        # Iterate the deque directly: absolute indices shift as the full log
+        # store evicts from the front.
+        for scanned, log in enumerate(reversed(self.log_store.logs)):
             # Is this log a match?
-            if self.filter_scan(self.log_store.logs[i]):
+            if self.filter_scan(log):
                 # Add to the beginning of the deque.
-                self.filtered_logs.appendleft(self.log_store.logs[i])
+                self.filtered_logs.appendleft(log)
             # TODO(tonymd): Tune these values.
             # Pause every 100 lines or so
-            if i % 100 == 0:
+            if scanned % 100 == 0:
                 await asyncio.sleep(0.1)
 
     def set_log_pane(self, log_pane: LogPane):
@@ -592,18 +595,24 @@ class LogView:
         or scroll.
         """
         latest_total = self.log_store.get_total_count()
+        # Indices are absolute line numbers; translate to deque offsets and
+        # skip lines already evicted from the full log store.
+        evicted = self.log_store.evicted_count
+        new_log_range = range(
+            max(self._last_log_store_index, evicted), latest_total
+        )
 
         if self.filtering_on:
             # Scan newly arived log lines
-            for i in range(self._last_log_store_index, latest_total):
-                if self.filter_scan(self.log_store.logs[i]):
-                    self.filtered_logs.append(self.log_store.logs[i])
+            for i in new_log_range:
+                if self.filter_scan(self.log_store.logs[i - evicted]):
+                    self.filtered_logs.append(self.log_store.logs[i - evicted])
 
         if self.search_filter:
             last_matched_log: int | None = None
             # Scan newly arived log lines
-            for i in range(self._last_log_store_index, latest_total):
-                if self.search_filter.matches(self.log_store.logs[i]):
+            for i in new_log_range:
+                if self.search_filter.matches(self.log_store.logs[i - evicted]):
                     self.save_search_matched_line(i)
                     last_matched_log = i
             if last_matched_log and self.follow_search_match:
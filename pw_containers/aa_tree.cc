@@ -23,15 +23,14 @@ void GenericAATree::SetRoot(AATreeItem* item) {
   root_ = item;
 }
 
-size_t GenericAATree::size() const {
-  return empty() ? 0 : root_->GetTreeSize();
-}
+size_t GenericAATree::size() const { return size_; }
 
 void GenericAATree::clear() {
   if (root_ != nullptr) {
     root_->Clear();
     SetRoot(nullptr);
   }
+  size_ = 0;
 }
 
 GenericAATree::iterator GenericAATree::erase_one(AATreeItem& item) {
@@ -40,6 +39,7 @@ GenericAATree::iterator GenericAATree::erase_one(AATreeItem& item) {
   }
   AATreeItem* next = item.GetSuccessor();
   SetRoot(item.Unmap());
+  size_ -= 1;
   return iterator(&root_, next);
 }
 
@@ -54,6 +54,7 @@ GenericAATree::iterator GenericAATree::erase_range(AATreeItem& first,
 
 void GenericAATree::swap(GenericAATree& other) {
   std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
 }
 
 }  // namespace pw::containers::internal
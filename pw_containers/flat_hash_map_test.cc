@@ -0,0 +1,91 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_containers/flat_hash_map.h"
+
+#include <cstddef>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::containers {
+namespace {
+
+constexpr FlatHashMap<int, char, 5> kMap({{
+    {1, 'a'},
+    {100, 'b'},
+    {-4, 'c'},
+    {0, 'd'},
+    {99999, 'e'},
+}});
+
+static_assert(kMap.size() == 5);
+static_assert(!kMap.empty());
+static_assert(kMap.contains(1));
+static_assert(kMap.contains(-4));
+static_assert(!kMap.contains(2));
+static_assert(kMap.at(100) == 'b');
+static_assert(kMap.find(12345) == kMap.end());
+
+TEST(FlatHashMap, Find_ExistingAndMissingKeys) {
+  EXPECT_EQ(kMap.find(1)->second, 'a');
+  EXPECT_EQ(kMap.find(100)->second, 'b');
+  EXPECT_EQ(kMap.find(-4)->second, 'c');
+  EXPECT_EQ(kMap.find(0)->second, 'd');
+  EXPECT_EQ(kMap.find(99999)->second, 'e');
+
+  EXPECT_EQ(kMap.find(3), kMap.end());
+  EXPECT_EQ(kMap.find(-100), kMap.end());
+}
+
+TEST(FlatHashMap, At_ReturnsValues) {
+  EXPECT_EQ(kMap.at(0), 'd');
+  EXPECT_EQ(kMap.at(99999), 'e');
+}
+
+TEST(FlatHashMap, Iteration_VisitsAllItems) {
+  size_t count = 0;
+  for (const auto& item : kMap) {
+    EXPECT_EQ(kMap.at(item.first), item.second);
+    count += 1;
+  }
+  EXPECT_EQ(count, kMap.size());
+}
+
+TEST(FlatHashMap, MutableValues) {
+  FlatHashMap<uint32_t, int, 2> map({{{7u, 1}, {8u, 2}}});
+  map.at(7u) = 10;
+  EXPECT_EQ(map.at(7u), 10);
+  EXPECT_EQ(map.at(8u), 2);
+}
+
+TEST(FlatHashMap, CollidingKeys_AllFound) {
+  // Keys chosen to collide modulo small slot counts; linear probing must
+  // still find every entry.
+  FlatHashMap<uint32_t, int, 4, 8> map(
+      {{{0u, 0}, {8u, 1}, {16u, 2}, {24u, 3}}});
+  for (uint32_t i = 0; i < 4; ++i) {
+    ASSERT_TRUE(map.contains(i * 8));
+    EXPECT_EQ(map.at(i * 8), static_cast<int>(i));
+  }
+  EXPECT_FALSE(map.contains(32u));
+}
+
+TEST(FlatHashMap, PairDeduction) {
+  FlatHashMap map(Pair<int, int>{1, 10}, Pair<int, int>{2, 20});
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.at(2), 20);
+}
+
+}  // namespace
+}  // namespace pw::containers
@@ -31,6 +31,63 @@ using test::CopyOnly;
 using test::Counter;
 using test::MoveOnly;
 
+TEST(InlineDeque, Append_CopiesAcrossWrap) {
+  InlineDeque<std::byte, 8> deque;
+
+  // Advance head and tail so an append wraps the storage end.
+  for (int i = 0; i < 5; ++i) {
+    deque.push_back(std::byte(0xee));
+  }
+  for (int i = 0; i < 5; ++i) {
+    deque.pop_front();
+  }
+
+  constexpr std::array<std::byte, 6> kValues = {std::byte(0),
+                                                std::byte(1),
+                                                std::byte(2),
+                                                std::byte(3),
+                                                std::byte(4),
+                                                std::byte(5)};
+  deque.append(kValues);
+  ASSERT_EQ(deque.size(), kValues.size());
+  for (size_t i = 0; i < kValues.size(); ++i) {
+    EXPECT_EQ(deque[i], kValues[i]);
+  }
+
+  std::array<std::byte, 8> out = {};
+  EXPECT_EQ(deque.pop_front_into(out), kValues.size());
+  EXPECT_TRUE(deque.empty());
+  for (size_t i = 0; i < kValues.size(); ++i) {
+    EXPECT_EQ(out[i], kValues[i]);
+  }
+}
+
+TEST(InlineDeque, PopFrontInto_PartialFill) {
+  InlineDeque<uint16_t, 4> deque;
+  deque.append(std::array<uint16_t, 3>{10, 20, 30});
+
+  std::array<uint16_t, 2> out = {};
+  EXPECT_EQ(deque.pop_front_into(out), 2u);
+  EXPECT_EQ(out[0], 10u);
+  EXPECT_EQ(out[1], 20u);
+  EXPECT_EQ(deque.size(), 1u);
+  EXPECT_EQ(deque.front(), 30u);
+
+  std::array<uint16_t, 2> rest = {};
+  EXPECT_EQ(deque.pop_front_into(rest), 1u);
+  EXPECT_EQ(rest[0], 30u);
+  EXPECT_EQ(deque.pop_front_into(rest), 0u);
+}
+
+TEST(InlineDeque, Append_NonTrivialType) {
+  InlineDeque<CopyOnly, 6> deque;
+  const std::array<CopyOnly, 2> values = {CopyOnly(5), CopyOnly(6)};
+  deque.append(span(values));
+  ASSERT_EQ(deque.size(), 2u);
+  EXPECT_EQ(deque[0].value, 5);
+  EXPECT_EQ(deque[1].value, 6);
+}
+
 TEST(InlineDeque, Construct_Sized) {
   InlineDeque<int, 3> deque;
   EXPECT_TRUE(deque.empty());
@@ -0,0 +1,67 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_containers/mpmc_queue.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::containers {
+namespace {
+
+TEST(MpmcQueue, PushPopFifoOrder) {
+  MpmcQueue<int, 4> queue;
+  EXPECT_TRUE(queue.empty());
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.TryPush(i));
+  }
+  EXPECT_FALSE(queue.TryPush(99));  // Full.
+  EXPECT_EQ(queue.size(), 4u);
+
+  for (int i = 0; i < 4; ++i) {
+    int value = -1;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, i);
+  }
+  int value;
+  EXPECT_FALSE(queue.TryPop(value));  // Empty.
+}
+
+TEST(MpmcQueue, WrapsAroundRepeatedly) {
+  MpmcQueue<uint32_t, 2> queue;
+  for (uint32_t i = 0; i < 100; ++i) {
+    ASSERT_TRUE(queue.TryPush(i));
+    uint32_t value = 0;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueue, InterleavedPushPop) {
+  MpmcQueue<int, 8> queue;
+  ASSERT_TRUE(queue.TryPush(1));
+  ASSERT_TRUE(queue.TryPush(2));
+  int value = 0;
+  ASSERT_TRUE(queue.TryPop(value));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(queue.TryPush(3));
+  ASSERT_TRUE(queue.TryPop(value));
+  EXPECT_EQ(value, 2);
+  ASSERT_TRUE(queue.TryPop(value));
+  EXPECT_EQ(value, 3);
+}
+
+}  // namespace
+}  // namespace pw::containers
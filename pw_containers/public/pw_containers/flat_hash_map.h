@@ -0,0 +1,172 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "pw_assert/assert.h"
+#include "pw_containers/flat_map.h"
+
+namespace pw::containers {
+
+namespace internal {
+
+// Returns the smallest power of two that is at least twice the item count,
+// used to size the default FlatHashMap slot table at most half full.
+constexpr size_t DefaultFlatHashMapSlotCount(size_t items) {
+  size_t slots = 2;
+  while (slots < 2 * items) {
+    slots *= 2;
+  }
+  return slots;
+}
+
+}  // namespace internal
+
+// Default hash for FlatHashMap keys. Integral and enum keys are mixed with a
+// Fibonacci multiplier so clustered key values spread across the table.
+struct FlatHashMapIntegerHash {
+  template <typename Key>
+  constexpr size_t operator()(const Key& key) const {
+    static_assert(std::is_integral_v<Key> || std::is_enum_v<Key>,
+                  "FlatHashMap's default hash supports only integral and enum "
+                  "keys; provide a custom hash functor for other key types");
+    return static_cast<size_t>(static_cast<uint64_t>(key) *
+                               UINT64_C(0x9E3779B97F4A7C15));
+  }
+};
+
+/// A fixed-size, constexpr-constructible associative container with O(1)
+/// average lookup, as an alternative to the binary-searched `FlatMap` for
+/// lookup tables that are queried at high rates. Items are stored densely for
+/// iteration, and lookups go through an open-addressed (linearly probed) slot
+/// table built at construction time, so a `find()` typically touches a single
+/// cache line of the slot table plus the matching item.
+///
+/// Keys must be unique. Like `FlatMap`, the contents are fixed at
+/// construction; values of non-const maps may be modified through `at()`.
+///
+/// `kNumSlots` must be a power of two larger than `kArraySize`; the default
+/// keeps the table at most half full.
+template <typename Key,
+          typename Value,
+          size_t kArraySize,
+          size_t kNumSlots = internal::DefaultFlatHashMapSlotCount(kArraySize),
+          typename Hash = FlatHashMapIntegerHash>
+class FlatHashMap {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = Pair<key_type, mapped_type>;
+  using size_type = size_t;
+  using container_type = typename std::array<value_type, kArraySize>;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+
+  static_assert((kNumSlots & (kNumSlots - 1)) == 0,
+                "kNumSlots must be a power of two");
+  static_assert(kNumSlots > kArraySize,
+                "kNumSlots must be larger than the number of items");
+
+  constexpr FlatHashMap(const std::array<value_type, kArraySize>& items)
+      : items_(items), slots_{} {
+    for (size_type i = 0; i < kNumSlots; ++i) {
+      slots_[i] = kEmptySlot;
+    }
+    for (size_type i = 0; i < kArraySize; ++i) {
+      size_type slot = Hash()(items_[i].first) & (kNumSlots - 1);
+      while (slots_[slot] != kEmptySlot) {
+        slot = (slot + 1) & (kNumSlots - 1);
+      }
+      slots_[slot] = static_cast<SlotIndex>(i);
+    }
+  }
+
+  template <typename... Items>
+  constexpr FlatHashMap(const Items&... items) : FlatHashMap(std::array{
+                                                     items...}) {}
+
+  // Capacity.
+  constexpr size_type size() const { return kArraySize; }
+  constexpr size_type max_size() const { return kArraySize; }
+  constexpr bool empty() const { return kArraySize == 0; }
+
+  // Element access.
+
+  /// Accesses the value associated with a key. Crashes if the key is not in
+  /// the map.
+  constexpr mapped_type& at(const key_type& key) {
+    const iterator it = find(key);
+    PW_ASSERT(it != end());
+    return it->second;
+  }
+
+  constexpr const mapped_type& at(const key_type& key) const {
+    const const_iterator it = find(key);
+    PW_ASSERT(it != end());
+    return it->second;
+  }
+
+  // Lookup.
+  constexpr bool contains(const key_type& key) const {
+    return find(key) != end();
+  }
+
+  constexpr iterator find(const key_type& key) {
+    return items_.begin() + FindIndex(key);
+  }
+
+  constexpr const_iterator find(const key_type& key) const {
+    return items_.begin() + FindIndex(key);
+  }
+
+  // Iterators iterate the items in their original, unsorted order.
+  constexpr iterator begin() { return items_.begin(); }
+  constexpr const_iterator begin() const { return items_.begin(); }
+  constexpr const_iterator cbegin() const { return items_.cbegin(); }
+  constexpr iterator end() { return items_.end(); }
+  constexpr const_iterator end() const { return items_.end(); }
+  constexpr const_iterator cend() const { return items_.cend(); }
+
+ private:
+  using SlotIndex =
+      std::conditional_t<(kArraySize < 0xFF), uint8_t,
+                         std::conditional_t<(kArraySize < 0xFFFF), uint16_t,
+                                            uint32_t>>;
+  static constexpr SlotIndex kEmptySlot = static_cast<SlotIndex>(-1);
+
+  // Probes the slot table for the key; returns kArraySize if not found.
+  constexpr size_type FindIndex(const key_type& key) const {
+    size_type slot = Hash()(key) & (kNumSlots - 1);
+    while (slots_[slot] != kEmptySlot) {
+      if (items_[slots_[slot]].first == key) {
+        return slots_[slot];
+      }
+      slot = (slot + 1) & (kNumSlots - 1);
+    }
+    return kArraySize;
+  }
+
+  container_type items_;
+  std::array<SlotIndex, kNumSlots> slots_;
+};
+
+template <typename T1, typename T2, typename... Items>
+FlatHashMap(const Pair<T1, T2>& item1, const Items&... items)
+    -> FlatHashMap<T1, T2, 1 + sizeof...(items)>;
+
+}  // namespace pw::containers
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
@@ -475,6 +476,18 @@ class BasicInlineDeque<ValueType,
 
   void pop_front();
 
+  /// Appends a span of values to the back. For trivially copyable types the
+  /// values are copied with at most two copies (one if the destination range
+  /// does not wrap), instead of per-element index math. Crashes if the values
+  /// do not fit.
+  void append(span<const value_type> values);
+
+  /// Removes up to `out.size()` values from the front, copying them into
+  /// `out` with at most two copies for trivially copyable types. Returns the
+  /// number of values copied, which is less than `out.size()` only if the
+  /// deque had fewer values.
+  size_type pop_front_into(span<value_type> out);
+
   void resize(size_type new_size) { resize(new_size, value_type()); }
 
   void resize(size_type new_size, const value_type& value);
@@ -630,6 +643,56 @@ void BasicInlineDeque<ValueType, SizeType>::pop_front() {
   --count_;
 }
 
+template <typename ValueType, typename SizeType>
+void BasicInlineDeque<ValueType, SizeType>::append(
+    span<const value_type> values) {
+  PW_ASSERT(values.size() <= static_cast<size_t>(max_size() - size()));
+  if (values.empty()) {
+    return;
+  }
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    const size_t first = std::min<size_t>(values.size(), capacity() - tail_);
+    std::memcpy(&data()[tail_], values.data(), first * sizeof(value_type));
+    if (values.size() > first) {
+      std::memcpy(&data()[0],
+                  values.data() + first,
+                  (values.size() - first) * sizeof(value_type));
+    }
+    tail_ = static_cast<size_type>((tail_ + values.size()) % capacity());
+    count_ = static_cast<size_type>(count_ + values.size());
+  } else {
+    for (const value_type& value : values) {
+      emplace_back(value);
+    }
+  }
+}
+
+template <typename ValueType, typename SizeType>
+typename BasicInlineDeque<ValueType, SizeType>::size_type
+BasicInlineDeque<ValueType, SizeType>::pop_front_into(span<value_type> out) {
+  const size_t count = std::min<size_t>(size(), out.size());
+  if (count == 0) {
+    return 0;
+  }
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    const size_t first = std::min<size_t>(count, capacity() - head_);
+    std::memcpy(out.data(), &data()[head_], first * sizeof(value_type));
+    if (count > first) {
+      std::memcpy(out.data() + first,
+                  &data()[0],
+                  (count - first) * sizeof(value_type));
+    }
+    head_ = static_cast<size_type>((head_ + count) % capacity());
+    count_ = static_cast<size_type>(count_ - count);
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = std::move(front());
+      pop_front();
+    }
+  }
+  return static_cast<size_type>(count);
+}
+
 template <typename ValueType, typename SizeType>
 void BasicInlineDeque<ValueType, SizeType>::resize(size_type new_size,
                                                    const value_type& value) {
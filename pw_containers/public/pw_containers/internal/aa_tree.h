@@ -112,6 +112,13 @@ class GenericAATree {
   /// Root of the tree. Only null if the tree is empty.
   AATreeItem* root_ = nullptr;
 
+ protected:
+  // Number of items in the tree, maintained by insert/erase so size() is O(1)
+  // instead of a full tree walk. All removals go through erase_one().
+  size_t size_ = 0;
+
+ private:
+
   /// Indicates whether the tree requires unique keys.
   ///
   /// This is a const member rather than a template parameter for 3 reasons:
@@ -275,11 +282,13 @@ std::pair<GenericAATree::iterator, bool> AATree<K, V>::insert(
   item.SetLevel(1);
   if (empty()) {
     SetRoot(&item);
+    size_ = 1;
     return std::make_pair(iterator(&root_, &item), true);
   }
   AATreeItem* duplicate = nullptr;
   SetRoot(InsertImpl(*root_, item, duplicate));
   if (duplicate == nullptr) {
+    size_ += 1;
     return std::make_pair(iterator(&root_, &item), true);
   }
   item.Reset();
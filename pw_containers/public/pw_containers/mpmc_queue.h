@@ -0,0 +1,123 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace pw::containers {
+
+/// A bounded, lock-free multi-producer multi-consumer queue.
+///
+/// Uses the per-slot sequence number scheme (Vyukov): producers and consumers
+/// each claim a slot with a single compare-exchange and then operate on
+/// independent slots, so there is no lock and no contention between a
+/// producer and a consumer except when the queue is empty or full. Push and
+/// pop never block and are safe from any context, including interrupts and
+/// multiple cores.
+///
+/// `T` must be trivially copyable, and `kCapacity` a power of two.
+template <typename T, size_t kCapacity>
+class MpmcQueue {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MpmcQueue requires a trivially copyable type");
+  static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0,
+                "kCapacity must be a power of two");
+
+  constexpr MpmcQueue() : head_(0), tail_(0) {
+    for (size_t i = 0; i < kCapacity; ++i) {
+      slots_[i].sequence.store(static_cast<uint32_t>(i),
+                               std::memory_order_relaxed);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  /// Attempts to enqueue a value. Returns false if the queue is full.
+  bool TryPush(const T& value) {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[tail & (kCapacity - 1)];
+      const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const int32_t difference =
+          static_cast<int32_t>(sequence) - static_cast<int32_t>(tail);
+      if (difference == 0) {
+        if (tail_.compare_exchange_weak(
+                tail, tail + 1, std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.sequence.store(tail + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;  // Full.
+      } else {
+        tail = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Attempts to dequeue a value. Returns false if the queue is empty.
+  bool TryPop(T& out) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[head & (kCapacity - 1)];
+      const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const int32_t difference =
+          static_cast<int32_t>(sequence) - static_cast<int32_t>(head + 1);
+      if (difference == 0) {
+        if (head_.compare_exchange_weak(
+                head, head + 1, std::memory_order_relaxed)) {
+          out = slot.value;
+          slot.sequence.store(head + kCapacity, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;  // Empty.
+      } else {
+        head = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Approximate number of queued elements; exact only when quiescent.
+  size_t size() const {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    return tail >= head ? tail - head : 0;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  static constexpr size_t capacity() { return kCapacity; }
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    T value;
+  };
+
+  static constexpr size_t kCacheLineSize = 64;
+
+  // The head and tail indices are kept on separate cache lines so producers
+  // and consumers do not interfere except through the slots themselves.
+  alignas(kCacheLineSize) std::atomic<uint32_t> head_;
+  alignas(kCacheLineSize) std::atomic<uint32_t> tail_;
+  alignas(kCacheLineSize) Slot slots_[kCapacity];
+};
+
+}  // namespace pw::containers
@@ -19,6 +19,7 @@
 #include "pw_bytes/span.h"
 #include "pw_crypto/sha256_backend.h"
 #include "pw_log/log.h"
+#include "pw_span/span.h"
 #include "pw_status/status.h"
 #include "pw_status/try.h"
 #include "pw_stream/stream.h"
@@ -89,6 +90,18 @@ class Sha256 {
     return *this;
   }
 
+  /// Feeds a batch of scattered buffers to the running hasher in order, as
+  /// if `Update()` were called for each. This lets non-contiguous messages
+  /// (e.g. a header, payload, and trailer) be hashed with one call, and
+  /// gives backends with hardware acceleration a single call site to
+  /// amortize their per-operation setup across.
+  Sha256& Update(span<const ConstByteSpan> data_pieces) {
+    for (const ConstByteSpan& piece : data_pieces) {
+      Update(piece);
+    }
+    return *this;
+  }
+
   /// Finishes the hashing session and outputs the final digest in the
   /// first `kDigestSizeBytes` of `out_digest`. `out_digest` must be at least
   /// `kDigestSizeBytes` long.
@@ -163,6 +176,36 @@ inline Status Hash(ConstByteSpan message, ByteSpan out_digest) {
   return Sha256().Update(message).Final(out_digest);
 }
 
+/// Calculates the SHA256 digest over the concatenation of a batch of
+/// scattered buffers, e.g. message pieces assembled without copying.
+inline Status Hash(span<const ConstByteSpan> message_pieces,
+                   ByteSpan out_digest) {
+  return Sha256().Update(message_pieces).Final(out_digest);
+}
+
+/// Variant of the reader-based `Hash` that consumes the input through a
+/// caller-provided scratch buffer, so large inputs (e.g. multi-megabyte OTA
+/// payloads on flash) are read in scratch-sized chunks instead of
+/// digest-sized (32-byte) reads.
+inline Status Hash(stream::Reader& reader,
+                   ByteSpan out_digest,
+                   ByteSpan scratch) {
+  if (out_digest.size() < kDigestSizeBytes || scratch.empty()) {
+    return Status::InvalidArgument();
+  }
+
+  Sha256 sha256;
+  while (true) {
+    Result<ByteSpan> res = reader.Read(scratch);
+    if (res.status().IsOutOfRange()) {
+      break;
+    }
+    PW_TRY(res.status());
+    sha256.Update(res.value());
+  }
+  return sha256.Final(out_digest);
+}
+
 inline Status Hash(stream::Reader& reader, ByteSpan out_digest) {
   if (out_digest.size() < kDigestSizeBytes) {
     return Status::InvalidArgument();
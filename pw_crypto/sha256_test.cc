@@ -14,6 +14,8 @@
 
 #include "pw_crypto/sha256.h"
 
+#include <array>
+
 #include <cstring>
 
 #include "pw_stream/memory_stream.h"
@@ -45,6 +47,16 @@ TEST(Hash, ComputesCorrectDigest) {
             std::memcmp(digest, SHA256_HASH_OF_HELLO_PIGWEED, sizeof(digest)));
 }
 
+TEST(Hash, ComputesCorrectDigestFromScatteredPieces) {
+  std::byte digest[kDigestSizeBytes];
+
+  const std::array<ConstByteSpan, 3> pieces = {
+      AS_BYTES("Hello"), AS_BYTES(", Pig"), AS_BYTES("weed!")};
+  PW_TEST_ASSERT_OK(Hash(pieces, digest));
+  ASSERT_EQ(0,
+            std::memcmp(digest, SHA256_HASH_OF_HELLO_PIGWEED, sizeof(digest)));
+}
+
 TEST(Hash, ComputesCorrectDigestFromReader) {
   std::byte digest[kDigestSizeBytes];
   ConstByteSpan message = AS_BYTES("Hello, Pigweed!");
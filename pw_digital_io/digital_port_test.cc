@@ -0,0 +1,128 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_digital_io/digital_port.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::digital_io {
+namespace {
+
+// A port backed by a single register-like word, as a masked-write GPIO bank
+// backend would be.
+class FakePort : public DigitalPort {
+ public:
+  constexpr FakePort() : DigitalPort(8) {}
+
+  uint32_t register_value() const { return register_value_; }
+
+  void SimulateEdge(uint32_t line, State state, uint64_t timestamp) {
+    if ((event_mask_ & (1u << line)) != 0 && handler_ != nullptr) {
+      handler_(PortEvent{.line = line, .state = state, .timestamp = timestamp});
+    }
+  }
+
+ private:
+  Status DoSetStates(uint32_t mask, uint32_t values) override {
+    register_value_ = (register_value_ & ~mask) | values;
+    return OkStatus();
+  }
+
+  Result<uint32_t> DoGetStates(uint32_t mask) override {
+    return register_value_ & mask;
+  }
+
+  Status DoSetEventHandler(uint32_t mask,
+                           InterruptTrigger,
+                           PortEventHandler&& handler) override {
+    event_mask_ = mask;
+    handler_ = std::move(handler);
+    return OkStatus();
+  }
+
+  uint32_t register_value_ = 0;
+  uint32_t event_mask_ = 0;
+  PortEventHandler handler_;
+};
+
+TEST(DigitalPortTest, SetStatesTouchesOnlyMaskedLines) {
+  FakePort port;
+  EXPECT_EQ(port.SetStates(0b1111'0000, 0b1010'0000), OkStatus());
+  EXPECT_EQ(port.register_value(), 0b1010'0000u);
+
+  // Lines outside the mask keep their values.
+  EXPECT_EQ(port.SetStates(0b0000'1111, 0b0000'0101), OkStatus());
+  EXPECT_EQ(port.register_value(), 0b1010'0101u);
+}
+
+TEST(DigitalPortTest, SetStatesIgnoresValueBitsOutsideMask) {
+  FakePort port;
+  EXPECT_EQ(port.SetStates(0b0000'0001, 0b1111'1111), OkStatus());
+  EXPECT_EQ(port.register_value(), 0b0000'0001u);
+}
+
+TEST(DigitalPortTest, GetStatesReturnsMaskedBank) {
+  FakePort port;
+  ASSERT_EQ(port.SetStates(0xFF, 0b1100'0011), OkStatus());
+
+  Result<uint32_t> states = port.GetStates(0b0000'1111);
+  ASSERT_EQ(states.status(), OkStatus());
+  EXPECT_EQ(states.value(), 0b0000'0011u);
+}
+
+TEST(DigitalPortTest, EventHandlerReceivesTimestampedEdges) {
+  FakePort port;
+  struct {
+    PortEvent last{};
+    int events = 0;
+  } captured;
+  ASSERT_EQ(port.SetEventHandler(0b0000'0110,
+                                 InterruptTrigger::kBothEdges,
+                                 [&captured](const PortEvent& event) {
+                                   captured.last = event;
+                                   ++captured.events;
+                                 }),
+            OkStatus());
+
+  port.SimulateEdge(1, State::kActive, 12345);
+  ASSERT_EQ(captured.events, 1);
+  EXPECT_EQ(captured.last.line, 1u);
+  EXPECT_EQ(captured.last.state, State::kActive);
+  EXPECT_EQ(captured.last.timestamp, 12345u);
+
+  // Lines outside the event mask do not fire.
+  port.SimulateEdge(0, State::kActive, 12346);
+  EXPECT_EQ(captured.events, 1);
+}
+
+TEST(DigitalPortTest, EventHandlerDefaultsToUnimplemented) {
+  // A backend that only overrides the state accessors reports Unimplemented
+  // for event configuration.
+  class StatesOnlyPort : public DigitalPort {
+   public:
+    constexpr StatesOnlyPort() : DigitalPort(4) {}
+
+   private:
+    Status DoSetStates(uint32_t, uint32_t) override { return OkStatus(); }
+    Result<uint32_t> DoGetStates(uint32_t) override { return 0; }
+  };
+
+  StatesOnlyPort port;
+  EXPECT_EQ(port.SetEventHandler(
+                0x1, InterruptTrigger::kActivatingEdge, [](const PortEvent&) {}),
+            Status::Unimplemented());
+}
+
+}  // namespace
+}  // namespace pw::digital_io
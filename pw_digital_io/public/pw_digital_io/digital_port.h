@@ -0,0 +1,111 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+
+#include "pw_digital_io/digital_io.h"
+#include "pw_function/function.h"
+#include "pw_result/result.h"
+#include "pw_status/status.h"
+
+namespace pw::digital_io {
+
+/// An edge event observed on one line of a `DigitalPort`, with the hardware
+/// timestamp of the transition.
+struct PortEvent {
+  /// Zero-based line index within the port.
+  uint32_t line;
+  /// The line's state after the transition.
+  State state;
+  /// Hardware timestamp of the edge. The unit and epoch are backend-defined
+  /// (typically a free-running microsecond or cycle counter latched by the
+  /// GPIO block); backends must document what they provide. Timestamps from
+  /// the same port are mutually comparable.
+  uint64_t timestamp;
+};
+
+/// Handler invoked for port edge events. As with `InterruptHandler`, it is
+/// backend-specific whether the handler runs in interrupt context.
+using PortEventHandler = ::pw::Function<void(const PortEvent& event)>;
+
+/// A bank of up to 32 digital lines that are read and written together.
+///
+/// `DigitalIn`/`DigitalOut` operate one line at a time, with a virtual call
+/// per operation; driving an 8-line parallel bus that way costs eight
+/// dispatches per cycle. A `DigitalPort` exposes the underlying GPIO bank
+/// directly: `SetStates` updates any subset of lines with one call, which
+/// single-register-write hardware implements as one store, and `GetStates`
+/// samples the whole bank coherently.
+///
+/// Line semantics match `DigitalIoOptional`: states are logical
+/// (polarity-mapped by the backend), and access from multiple threads must be
+/// externally synchronized.
+class DigitalPort {
+ public:
+  virtual ~DigitalPort() = default;
+
+  /// The number of lines in this port. Line indices and mask bits range over
+  /// `[0, line_count())`.
+  uint32_t line_count() const { return line_count_; }
+
+  /// Sets every line selected by `mask` to the corresponding bit of
+  /// `values`; lines outside `mask` are unchanged. Bit `n` corresponds to
+  /// line `n`, with a set bit meaning `State::kActive`.
+  ///
+  /// Backends for banks with atomic set/clear or masked-write registers
+  /// implement this as a single register write.
+  Status SetStates(uint32_t mask, uint32_t values) {
+    return DoSetStates(mask, values & mask);
+  }
+
+  /// Returns the states of all lines selected by `mask` as a bitmask,
+  /// sampled coherently (one read of the port where hardware allows). Bits
+  /// outside `mask` are zero.
+  Result<uint32_t> GetStates(uint32_t mask) { return DoGetStates(mask); }
+
+  /// Configures a handler for edge events on the lines selected by `mask`,
+  /// replacing any previous configuration. Events carry the line index, the
+  /// new state, and a hardware timestamp of the edge, so edge-time
+  /// measurement does not depend on handler scheduling latency. Pass an
+  /// empty mask or a null handler to clear.
+  Status SetEventHandler(uint32_t mask,
+                         InterruptTrigger trigger,
+                         PortEventHandler&& handler) {
+    return DoSetEventHandler(mask, trigger, std::move(handler));
+  }
+
+ protected:
+  explicit constexpr DigitalPort(uint32_t line_count)
+      : line_count_(line_count) {}
+
+ private:
+  /// Backend implementation of `SetStates`. `values` has been masked; only
+  /// bits within `mask` are set.
+  virtual Status DoSetStates(uint32_t mask, uint32_t values) = 0;
+
+  virtual Result<uint32_t> DoGetStates(uint32_t mask) = 0;
+
+  /// Backend implementation of `SetEventHandler`. Backends without edge
+  /// timestamping or event support return `pw::Status::Unimplemented()`.
+  virtual Status DoSetEventHandler(uint32_t /*mask*/,
+                                   InterruptTrigger /*trigger*/,
+                                   PortEventHandler&& /*handler*/) {
+    return Status::Unimplemented();
+  }
+
+  uint32_t line_count_;
+};
+
+}  // namespace pw::digital_io
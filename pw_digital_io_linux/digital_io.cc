@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include <linux/gpio.h>
 
+#include <array>
 #include <memory>
 
 #include "log_errno.h"
@@ -27,6 +28,7 @@
 #include "pw_log/log.h"
 #include "pw_result/result.h"
 #include "pw_status/status.h"
+#include "pw_status/try.h"
 
 // NOTE: Currently only the v1 userspace ABI is supported.
 // TODO: https://pwbug.dev/328268007 - Add support for v2.
@@ -136,6 +138,91 @@ Result<OwnedFd> LinuxDigitalIoChip::Impl::GetLineEventHandle(
   return OwnedFd(req.fd);
 }
 
+Result<internal::OwnedFd> LinuxDigitalIoChip::Impl::GetMultiLineHandle(
+    span<const uint32_t> offsets, uint32_t flags, uint32_t default_values) {
+  if (offsets.empty() || offsets.size() > 32 ||
+      offsets.size() > GPIOHANDLES_MAX) {
+    return Status::InvalidArgument();
+  }
+  struct gpiohandle_request req = {
+      .flags = flags,
+      .consumer_label = "pw_digital_io_linux",
+      .lines = static_cast<uint32_t>(offsets.size()),
+      .fd = -1,
+  };
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    req.lineoffsets[i] = offsets[i];
+    req.default_values[i] = (default_values >> i) & 1u;
+  }
+  if (fd_.ioctl(GPIO_GET_LINEHANDLE_IOCTL, &req) < 0) {
+    LOG_ERROR_WITH_ERRNO("GPIO_GET_LINEHANDLE_IOCTL failed:", errno);
+    return Status::Internal();
+  }
+  if (req.fd < 0) {
+    return Status::Internal();
+  }
+  return OwnedFd(req.fd);
+}
+
+Result<LinuxDigitalPort> LinuxDigitalIoChip::GetInputPort(
+    span<const uint32_t> offsets, Polarity polarity) {
+  if (!impl_) {
+    return Status::FailedPrecondition();
+  }
+  const LinuxInputConfig config(/* gpio_index= */ 0, polarity);
+  PW_TRY_ASSIGN(OwnedFd fd,
+                impl_->GetMultiLineHandle(offsets, config.GetFlags(), 0));
+  return LinuxDigitalPort(
+      std::move(fd), static_cast<uint32_t>(offsets.size()), 0);
+}
+
+Result<LinuxDigitalPort> LinuxDigitalIoChip::GetOutputPort(
+    span<const uint32_t> offsets, Polarity polarity, uint32_t default_values) {
+  if (!impl_) {
+    return Status::FailedPrecondition();
+  }
+  const LinuxOutputConfig config(
+      /* gpio_index= */ 0, polarity, State::kInactive);
+  PW_TRY_ASSIGN(
+      OwnedFd fd,
+      impl_->GetMultiLineHandle(offsets, config.GetFlags(), default_values));
+  return LinuxDigitalPort(
+      std::move(fd), static_cast<uint32_t>(offsets.size()), default_values);
+}
+
+//
+// LinuxDigitalPort
+//
+
+Status LinuxDigitalPort::DoSetStates(uint32_t mask, uint32_t values) {
+  output_shadow_ = (output_shadow_ & ~mask) | values;
+
+  struct gpiohandle_data req = {};
+  for (uint32_t i = 0; i < line_count(); ++i) {
+    req.values[i] = (output_shadow_ >> i) & 1u;
+  }
+  if (fd_.ioctl(GPIOHANDLE_SET_LINE_VALUES_IOCTL, &req) < 0) {
+    LOG_ERROR_WITH_ERRNO("GPIOHANDLE_SET_LINE_VALUES_IOCTL failed:", errno);
+    return Status::Internal();
+  }
+  return OkStatus();
+}
+
+Result<uint32_t> LinuxDigitalPort::DoGetStates(uint32_t mask) {
+  struct gpiohandle_data req = {};
+  if (fd_.ioctl(GPIOHANDLE_GET_LINE_VALUES_IOCTL, &req) < 0) {
+    LOG_ERROR_WITH_ERRNO("GPIOHANDLE_GET_LINE_VALUES_IOCTL failed:", errno);
+    return Status::Internal();
+  }
+  uint32_t states = 0;
+  for (uint32_t i = 0; i < line_count(); ++i) {
+    if (req.values[i]) {
+      states |= 1u << i;
+    }
+  }
+  return states & mask;
+}
+
 Result<LinuxDigitalInInterrupt> LinuxDigitalIoChip::GetInterruptLine(
     const LinuxInputConfig& config,
     std::shared_ptr<LinuxGpioNotifier> notifier) {
@@ -307,7 +394,12 @@ Status LinuxDigitalInInterrupt::Impl::DoSetInterruptHandler(
 void LinuxDigitalInInterrupt::Impl::HandleEvents() {
   InterruptHandler saved_handler{};
   uint32_t current_handler_generation{};
-  State state{};
+  // The kernel queues events while the handler runs; drain them in one read
+  // so a burst of edges costs one syscall rather than one per event.
+  std::array<struct gpioevent_data, 16> events;
+  size_t event_count = 0;
+  std::array<State, events.size()> states{};
+  size_t state_count = 0;
 
   {
     std::lock_guard lock(mutex_);
@@ -318,35 +410,41 @@ void LinuxDigitalInInterrupt::Impl::HandleEvents() {
       return;
     }
 
-    // Consume the event from the event handle.
+    // Consume all queued events from the event handle with one read.
     errno = 0;
-    struct gpioevent_data event;
-    ssize_t nread = fd_.read(&event, sizeof(event));
-    if (nread < static_cast<ssize_t>(sizeof(event))) {
+    ssize_t nread = fd_.read(events.data(), sizeof(events));
+    if (nread < static_cast<ssize_t>(sizeof(events[0]))) {
       LOG_ERROR_WITH_ERRNO("Failed to read from line event handle:", errno);
       return;
     }
-
-    PW_LOG_DEBUG("Got GPIO event: timestamp=%llu, id=%s",
-                 static_cast<unsigned long long>(event.timestamp),
-                 event.id == GPIOEVENT_EVENT_RISING_EDGE    ? "RISING_EDGE"
-                 : event.id == GPIOEVENT_EVENT_FALLING_EDGE ? "FALLING_EDGE"
-                                                            : "<unknown>");
-
-    // Note that polarity (ACTIVE_LOW) is already accounted for
-    // by the kernel; see gpiod_get_value_cansleep().
-    switch (event.id) {
-      case GPIOEVENT_EVENT_RISING_EDGE:
-        // "RISING_EDGE" always means inactive -> active.
-        state = State::kActive;
-        break;
-      case GPIOEVENT_EVENT_FALLING_EDGE:
-        // "FALLING_EDGE" always means active -> inactive.
-        state = State::kInactive;
-        break;
-      default:
-        PW_LOG_ERROR("Unexpected event.id = %u", event.id);
-        return;
+    event_count = static_cast<size_t>(nread) / sizeof(events[0]);
+
+    for (size_t i = 0; i < event_count; ++i) {
+      const struct gpioevent_data& event = events[i];
+      PW_LOG_DEBUG("Got GPIO event: timestamp=%llu, id=%s",
+                   static_cast<unsigned long long>(event.timestamp),
+                   event.id == GPIOEVENT_EVENT_RISING_EDGE    ? "RISING_EDGE"
+                   : event.id == GPIOEVENT_EVENT_FALLING_EDGE ? "FALLING_EDGE"
+                                                              : "<unknown>");
+
+      // Note that polarity (ACTIVE_LOW) is already accounted for
+      // by the kernel; see gpiod_get_value_cansleep().
+      switch (event.id) {
+        case GPIOEVENT_EVENT_RISING_EDGE:
+          // "RISING_EDGE" always means inactive -> active.
+          states[state_count++] = State::kActive;
+          break;
+        case GPIOEVENT_EVENT_FALLING_EDGE:
+          // "FALLING_EDGE" always means active -> inactive.
+          states[state_count++] = State::kInactive;
+          break;
+        default:
+          PW_LOG_ERROR("Unexpected event.id = %u", event.id);
+          break;
+      }
+    }
+    if (state_count == 0) {
+      return;
     }
 
     // Borrow the handler while we handle the interrupt, so we can invoked it
@@ -355,9 +453,12 @@ void LinuxDigitalInInterrupt::Impl::HandleEvents() {
     current_handler_generation = handler_generation_;
   }
 
-  // Invoke the handler without holding the mutex.
+  // Invoke the handler without holding the mutex, once per drained event in
+  // arrival order.
   if (saved_handler) {
-    saved_handler(state);
+    for (size_t i = 0; i < state_count; ++i) {
+      saved_handler(states[i]);
+    }
   }
 
   // Restore the saved handler.
@@ -18,10 +18,12 @@
 #include <memory>
 
 #include "pw_digital_io/digital_io.h"
+#include "pw_digital_io/digital_port.h"
 #include "pw_digital_io/polarity.h"
 #include "pw_digital_io_linux/internal/owned_fd.h"
 #include "pw_digital_io_linux/notifier.h"
 #include "pw_result/result.h"
+#include "pw_span/span.h"
 #include "pw_sync/lock_annotations.h"
 #include "pw_sync/mutex.h"
 
@@ -56,12 +58,14 @@ struct LinuxOutputConfig final : LinuxConfig {
 class LinuxDigitalInInterrupt;
 class LinuxDigitalIn;
 class LinuxDigitalOut;
+class LinuxDigitalPort;
 
 /// Represents an open handle to a Linux GPIO chip (e.g. /dev/gpiochip0).
 class LinuxDigitalIoChip final {
   friend class LinuxDigitalInInterrupt;
   friend class LinuxDigitalIn;
   friend class LinuxDigitalOut;
+  friend class LinuxDigitalPort;
   using OwnedFd = internal::OwnedFd;
 
  private:
@@ -78,6 +82,13 @@ class LinuxDigitalIoChip final {
                                        uint32_t handle_flags,
                                        uint32_t event_flags);
 
+    // Requests one line handle covering all of `offsets`, so the whole group
+    // is read or written with a single ioctl. `default_values` provides the
+    // initial level of output line `i` in bit `i`.
+    Result<OwnedFd> GetMultiLineHandle(span<const uint32_t> offsets,
+                                       uint32_t flags,
+                                       uint32_t default_values);
+
    private:
     OwnedFd fd_;
   };
@@ -98,6 +109,17 @@ class LinuxDigitalIoChip final {
   Result<LinuxDigitalIn> GetInputLine(const LinuxInputConfig& config);
 
   Result<LinuxDigitalOut> GetOutputLine(const LinuxOutputConfig& config);
+
+  /// Requests all of `offsets` as inputs in one kernel line request; see
+  /// `LinuxDigitalPort`. The polarity applies to every line in the port.
+  Result<LinuxDigitalPort> GetInputPort(span<const uint32_t> offsets,
+                                        Polarity polarity);
+
+  /// Requests all of `offsets` as outputs in one kernel line request. Bit `i`
+  /// of `default_values` is the initial logical state of line `i`.
+  Result<LinuxDigitalPort> GetOutputPort(span<const uint32_t> offsets,
+                                         Polarity polarity,
+                                         uint32_t default_values = 0);
 };
 
 class LinuxDigitalInInterrupt final : public DigitalInInterrupt {
@@ -246,4 +268,40 @@ class LinuxDigitalOut final : public DigitalInOut {
   internal::OwnedFd fd_;
 };
 
+/// A group of up to 32 lines on one chip, covered by a single kernel line
+/// request. `GetStates`/`SetStates` each issue exactly one ioctl regardless
+/// of how many lines are selected, so polling N lines costs one syscall
+/// instead of N. Line index `i` within the port is `offsets[i]` as passed to
+/// `GetInputPort`/`GetOutputPort`.
+///
+/// Edge-event streaming is not available through a port: the v1 GPIO
+/// userspace ABI only supports per-line event handles, so `SetEventHandler`
+/// reports `Unimplemented`. (The v2 ABI lifts this; see the note at the top
+/// of digital_io.cc.)
+class LinuxDigitalPort final : public DigitalPort {
+  friend class LinuxDigitalIoChip;
+
+ public:
+  LinuxDigitalPort(const LinuxDigitalPort&) = delete;
+  LinuxDigitalPort& operator=(const LinuxDigitalPort&) = delete;
+  LinuxDigitalPort(LinuxDigitalPort&&) = default;
+  LinuxDigitalPort& operator=(LinuxDigitalPort&&) = default;
+
+ private:
+  explicit LinuxDigitalPort(internal::OwnedFd fd,
+                            uint32_t line_count,
+                            uint32_t initial_values)
+      : DigitalPort(line_count),
+        fd_(std::move(fd)),
+        output_shadow_(initial_values) {}
+
+  Status DoSetStates(uint32_t mask, uint32_t values) override;
+  Result<uint32_t> DoGetStates(uint32_t mask) override;
+
+  internal::OwnedFd fd_;
+  // The v1 set-values ioctl writes every line in the handle, so the last
+  // written value of each line is shadowed to honor the mask semantics.
+  uint32_t output_shadow_;
+};
+
 }  // namespace pw::digital_io
@@ -0,0 +1,105 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_display/pixel_kernels.h"
+
+#include <array>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::display {
+namespace {
+
+// Scalar reference blend, channel by channel.
+ColorRgb565 ReferenceBlend(ColorRgb565 fg, ColorRgb565 bg, uint32_t alpha32) {
+  const uint32_t fg_r = (fg >> 11) & 0x1F;
+  const uint32_t fg_g = (fg >> 5) & 0x3F;
+  const uint32_t fg_b = fg & 0x1F;
+  const uint32_t bg_r = (bg >> 11) & 0x1F;
+  const uint32_t bg_g = (bg >> 5) & 0x3F;
+  const uint32_t bg_b = bg & 0x1F;
+  const uint32_t r = bg_r + (((fg_r - bg_r) * alpha32) >> 5);
+  const uint32_t g = bg_g + (((fg_g - bg_g) * alpha32) >> 5);
+  const uint32_t b = bg_b + (((fg_b - bg_b) * alpha32) >> 5);
+  return static_cast<ColorRgb565>((r << 11) | (g << 5) | b);
+}
+
+TEST(PixelKernels, BlendMatchesScalarReference) {
+  constexpr std::array<ColorRgb565, 4> kColors = {
+      EncodeRgb565(255, 0, 0),
+      EncodeRgb565(0, 255, 0),
+      EncodeRgb565(12, 34, 56),
+      EncodeRgb565(200, 150, 100),
+  };
+  for (ColorRgb565 fg : kColors) {
+    for (ColorRgb565 bg : kColors) {
+      for (uint32_t alpha : {0u, 7u, 16u, 31u, 32u}) {
+        EXPECT_EQ(BlendRgb565(fg, bg, alpha), ReferenceBlend(fg, bg, alpha))
+            << "fg=" << fg << " bg=" << bg << " alpha=" << alpha;
+      }
+    }
+  }
+}
+
+TEST(PixelKernels, BlendEndpoints) {
+  const ColorRgb565 fg = EncodeRgb565(255, 255, 255);
+  const ColorRgb565 bg = EncodeRgb565(0, 0, 0);
+  EXPECT_EQ(BlendRgb565(fg, bg, 0), bg);
+  EXPECT_EQ(BlendRgb565(fg, bg, 32), fg);
+}
+
+TEST(PixelKernels, FillHandlesUnalignedEdges) {
+  alignas(4) std::array<ColorRgb565, 9> buffer = {};
+  const ColorRgb565 color = EncodeRgb565(10, 20, 30);
+
+  // Start one pixel in, so the kernel must handle the odd head and tail.
+  FillRgb565(span(buffer).subspan(1, 7), color);
+  EXPECT_EQ(buffer[0], 0u);
+  for (size_t i = 1; i <= 7; ++i) {
+    EXPECT_EQ(buffer[i], color);
+  }
+  EXPECT_EQ(buffer[8], 0u);
+}
+
+TEST(PixelKernels, BlitAndBlendBlit) {
+  std::array<ColorRgb565, 4> source = {1, 2, 3, 4};
+  std::array<ColorRgb565, 4> destination = {};
+  BlitRgb565(source, destination);
+  EXPECT_EQ(destination, source);
+
+  // Full alpha replaces; zero alpha preserves.
+  std::array<ColorRgb565, 4> overlay = {9, 9, 9, 9};
+  BlitBlendRgb565(overlay, destination, 32);
+  EXPECT_EQ(destination, overlay);
+  BlitBlendRgb565(source, destination, 0);
+  EXPECT_EQ(destination, overlay);
+}
+
+TEST(PixelKernels, Rotate90) {
+  // 3x2 image:
+  //   1 2 3
+  //   4 5 6
+  const std::array<ColorRgb565, 6> source = {1, 2, 3, 4, 5, 6};
+  std::array<ColorRgb565, 6> destination = {};
+  Rotate90Rgb565(source, /* width= */ 3, /* height= */ 2, destination);
+  // Rotated clockwise (2x3):
+  //   4 1
+  //   5 2
+  //   6 3
+  const std::array<ColorRgb565, 6> expected = {4, 1, 5, 2, 6, 3};
+  EXPECT_EQ(destination, expected);
+}
+
+}  // namespace
+}  // namespace pw::display
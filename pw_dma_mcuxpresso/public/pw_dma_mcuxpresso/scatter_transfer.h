@@ -0,0 +1,118 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+
+#include "fsl_dma.h"
+#include "pw_dma_mcuxpresso/dma.h"
+#include "pw_multibuf/multibuf.h"
+#include "pw_status/status.h"
+
+namespace pw::dma {
+
+// Chained (linked-descriptor) DMA transfer built from a MultiBuf's chunks.
+//
+// Streaming a MultiBuf to a peripheral one chunk at a time costs one
+// completion interrupt plus a channel reconfiguration per chunk. This helper
+// instead builds a hardware descriptor chain covering every chunk -- the DMA
+// engine follows the links itself -- and raises a single interrupt when the
+// final descriptor completes.
+//
+// Like McuxpressoDmaChannel, instances are referenced by the hardware while
+// a transfer is in flight: the object (and the MultiBuf's chunks) must
+// remain valid until the completion callback runs.
+template <size_t kMaxChunks>
+class McuxpressoScatterTransfer {
+ public:
+  explicit McuxpressoScatterTransfer(McuxpressoDmaChannel& channel)
+      : channel_(channel) {}
+
+  McuxpressoScatterTransfer(const McuxpressoScatterTransfer&) = delete;
+  McuxpressoScatterTransfer& operator=(const McuxpressoScatterTransfer&) =
+      delete;
+
+  // Builds and submits a memory-to-peripheral chain that writes every chunk
+  // of `buffer`, in order, to the fixed peripheral data register
+  // `peripheral_dest` with `transfer_width` byte accesses. `callback` is
+  // invoked (from the DMA interrupt) once, when the whole chain has
+  // completed.
+  //
+  // Returns INVALID_ARGUMENT if `buffer` has no chunks, a chunk's size is
+  // not a multiple of the transfer width, or the chunk count exceeds
+  // kMaxChunks. The channel must be initialized and idle.
+  Status SubmitWrite(const multibuf::MultiBuf& buffer,
+                     volatile void* peripheral_dest,
+                     uint8_t transfer_width,
+                     dma_callback callback,
+                     void* user_data) {
+    size_t count = 0;
+    for (const auto& chunk : buffer.Chunks()) {
+      if (count >= kMaxChunks || chunk.size() == 0 ||
+          chunk.size() % transfer_width != 0) {
+        return Status::InvalidArgument();
+      }
+      chunks_[count] = {chunk.data(), chunk.size()};
+      ++count;
+    }
+    if (count == 0) {
+      return Status::InvalidArgument();
+    }
+
+    // Build the chain back to front so each descriptor can link to the next.
+    // Only the final descriptor raises an interrupt (intA); intermediate
+    // descriptors reload the next link with no software involvement.
+    for (size_t i = count; i-- > 0;) {
+      const bool last = i == count - 1;
+      dma_xfercfg_t xfercfg = {};
+      xfercfg.valid = true;
+      xfercfg.reload = !last;
+      xfercfg.swtrig = false;
+      xfercfg.clrtrig = false;
+      xfercfg.intA = last;
+      xfercfg.intB = false;
+      xfercfg.byteWidth = transfer_width;
+      xfercfg.srcInc = 1;
+      xfercfg.dstInc = 0;
+      xfercfg.transferCount =
+          static_cast<uint16_t>(chunks_[i].size / transfer_width);
+      DMA_CreateDescriptor(&descriptors_[i],
+                           &xfercfg,
+                           const_cast<void*>(chunks_[i].data),
+                           const_cast<void*>(
+                               static_cast<volatile const void*>(
+                                   peripheral_dest)),
+                           last ? nullptr : &descriptors_[i + 1]);
+    }
+
+    DMA_SetCallback(channel_.handle(), callback, user_data);
+    DMA_SubmitChannelDescriptor(channel_.handle(), &descriptors_[0]);
+    DMA_StartTransfer(channel_.handle());
+    return OkStatus();
+  }
+
+ private:
+  struct ChunkView {
+    const void* data;
+    size_t size;
+  };
+
+  McuxpressoDmaChannel& channel_;
+  ChunkView chunks_[kMaxChunks];
+  // The DMA engine dereferences descriptor links directly; the SDK requires
+  // 16-byte alignment.
+  alignas(16) dma_descriptor_t descriptors_[kMaxChunks];
+};
+
+}  // namespace pw::dma
@@ -100,6 +100,15 @@ class ElfReader {
   /// @endrst
   Result<std::vector<std::byte>> ReadSection(std::string_view name);
 
+  /// Copies a section with the given name to a writer, streaming it through
+  /// a small fixed buffer instead of loading the whole section into memory.
+  /// Use this for large sections (e.g. token databases or embedded blobs)
+  /// where `ReadSection`'s full-section vector is too costly.
+  ///
+  /// @returns The number of bytes copied, NOT_FOUND if no such section
+  /// exists, or errors from the underlying streams.
+  StatusWithSize CopySection(std::string_view name, stream::Writer& output);
+
  private:
   internal::ElfReaderImpls impl_;
 
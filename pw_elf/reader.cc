@@ -14,6 +14,8 @@
 
 #include "pw_elf/reader.h"
 
+#include <array>
+
 #include "pw_bytes/endian.h"
 #include "pw_log/log.h"
 #include "pw_status/try.h"
@@ -116,6 +118,29 @@ Result<std::vector<std::byte>> ElfReader::ReadSection(std::string_view name) {
   return data;
 }
 
+StatusWithSize ElfReader::CopySection(std::string_view name,
+                                      stream::Writer& output) {
+  StatusWithSize section = SeekToSection(name);
+  if (!section.ok()) {
+    return section;
+  }
+
+  std::array<std::byte, 128> buffer;
+  size_t remaining = section.size();
+  while (remaining > 0) {
+    const size_t chunk = std::min(remaining, buffer.size());
+    const auto read_span = span(buffer).first(chunk);
+    if (const auto read = stream().ReadExact(read_span); !read.ok()) {
+      return StatusWithSize(read.status(), section.size() - remaining);
+    }
+    if (Status status = output.Write(read_span); !status.ok()) {
+      return StatusWithSize(status, section.size() - remaining);
+    }
+    remaining -= chunk;
+  }
+  return StatusWithSize(section.size());
+}
+
 namespace internal {
 
 // TODO(jrreinhart): Move to pw_stream
@@ -0,0 +1,55 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_function/function_ref.h"
+
+#include <array>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw {
+namespace {
+
+static_assert(std::is_trivially_destructible_v<FunctionRef<void()>>);
+static_assert(std::is_trivially_copyable_v<FunctionRef<void()>>);
+static_assert(sizeof(FunctionRef<int(int)>) == 2 * sizeof(void*));
+
+int Double(int value) { return value * 2; }
+
+int Apply(FunctionRef<int(int)> operation, int value) {
+  return operation(value);
+}
+
+TEST(FunctionRef, InvokesFreeFunction) {
+  EXPECT_EQ(Apply(Double, 10), 20);
+}
+
+TEST(FunctionRef, InvokesCapturingLambda) {
+  // The captured state can be arbitrarily large; FunctionRef does not copy.
+  std::array<int, 32> offsets;
+  offsets.fill(5);
+  EXPECT_EQ(Apply([&offsets](int value) { return value + offsets[0]; }, 1), 6);
+}
+
+TEST(FunctionRef, InvokesMutableState) {
+  int count = 0;
+  FunctionRef<void()> increment = [&count] { count += 1; };
+  increment();
+  FunctionRef<void()> copy = increment;  // Trivial copy refers to the same
+  copy();                                // callable.
+  EXPECT_EQ(count, 2);
+}
+
+}  // namespace
+}  // namespace pw
@@ -0,0 +1,75 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace pw {
+
+template <typename Signature>
+class FunctionRef;
+
+/// A non-owning reference to a callable, for callbacks that are invoked
+/// before the call returns (e.g. `ForEach`-style visitors and comparison
+/// functions).
+///
+/// Unlike `pw::Function`, a `FunctionRef` is two words, trivially copyable
+/// and trivially destructible, never allocates, and has no size limit on the
+/// referenced callable -- there is no operations table, just a bound call.
+/// This makes it the fast-path callback type on hot paths where `Function`'s
+/// ownership and its destructor dispatch are unnecessary.
+///
+/// As with `std::function_ref` (C++26) and `absl::FunctionRef`, the
+/// referenced callable must outlive the `FunctionRef`; never store one beyond
+/// the call that received it.
+template <typename Return, typename... Args>
+class FunctionRef<Return(Args...)> {
+ public:
+  /// Binds any callable (lambda, function object, function pointer).
+  template <
+      typename Callable,
+      typename = std::enable_if_t<
+          !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Callable>>,
+                          FunctionRef> &&
+          std::is_invocable_r_v<Return, Callable&, Args...>>>
+  constexpr FunctionRef(Callable&& callable) noexcept
+      : target_(const_cast<void*>(
+            static_cast<const void*>(std::addressof(callable)))),
+        invoke_([](void* target, Args... args) -> Return {
+          return (*static_cast<std::remove_reference_t<Callable>*>(target))(
+              std::forward<Args>(args)...);
+        }) {}
+
+  /// Binds a plain function.
+  constexpr FunctionRef(Return (*function)(Args...)) noexcept
+      : target_(reinterpret_cast<void*>(function)),
+        invoke_([](void* target, Args... args) -> Return {
+          return reinterpret_cast<Return (*)(Args...)>(target)(
+              std::forward<Args>(args)...);
+        }) {}
+
+  constexpr FunctionRef(const FunctionRef&) noexcept = default;
+  constexpr FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+  Return operator()(Args... args) const {
+    return invoke_(target_, std::forward<Args>(args)...);
+  }
+
+ private:
+  void* target_;
+  Return (*invoke_)(void*, Args...);
+};
+
+}  // namespace pw
@@ -317,24 +317,55 @@ Status Connection::SharedState::SendData(StreamId stream_id,
   prefix.PutUint8(0);
   prefix.PutUint32(message_size, endian::big);
 
-  // Write FrameHeader
-  if (!chunk->ClaimPrefix(sizeof(WireFrameHeader))) {
-    return Status::ResourceExhausted();
-  }
+  if (chunk.size() <= max_data_frame_payload_) {
+    // Single-frame fast path: prepend the frame header in place.
+    if (!chunk->ClaimPrefix(sizeof(WireFrameHeader))) {
+      return Status::ResourceExhausted();
+    }
 
-  WireFrameHeader frame(FrameHeader{
-      .payload_length =
-          static_cast<uint32_t>(message_size + kLengthPrefixedMessageHdrSize),
-      .type = FrameType::DATA,
-      .flags = 0,
-      .stream_id = stream_id,
-  });
-  ConstByteSpan frame_span = AsBytes(frame);
-  std::copy(frame_span.begin(), frame_span.end(), chunk->begin());
+    WireFrameHeader frame(FrameHeader{
+        .payload_length =
+            static_cast<uint32_t>(message_size + kLengthPrefixedMessageHdrSize),
+        .type = FrameType::DATA,
+        .flags = 0,
+        .stream_id = stream_id,
+    });
+    ConstByteSpan frame_span = AsBytes(frame);
+    std::copy(frame_span.begin(), frame_span.end(), chunk->begin());
+
+    auto buffer = multibuf::MultiBuf::FromChunk(std::move(chunk));
+    send_queue_.QueueSend(std::move(buffer));
+    return OkStatus();
+  }
 
-  auto buffer = multibuf::MultiBuf::FromChunk(std::move(chunk));
-  send_queue_.QueueSend(std::move(buffer));
-  return OkStatus();
+  // Adaptive path: the message exceeds the connection's current DATA frame
+  // payload limit (see set_max_data_frame_payload), so stream it across
+  // several smaller DATA frames. The Length-Prefixed-Message header written
+  // above covers the whole message; HTTP/2 DATA frames are just a byte
+  // stream, so the split is invisible to the peer's gRPC layer.
+  multibuf::OwnedChunk remaining = std::move(chunk);
+  while (true) {
+    const size_t segment_size =
+        std::min<size_t>(remaining.size(), max_data_frame_payload_);
+    WireFrameHeader frame(FrameHeader{
+        .payload_length = static_cast<uint32_t>(segment_size),
+        .type = FrameType::DATA,
+        .flags = 0,
+        .stream_id = stream_id,
+    });
+    PW_TRY(SendBytes(AsBytes(frame)));
+
+    if (segment_size == remaining.size()) {
+      send_queue_.QueueSend(multibuf::MultiBuf::FromChunk(std::move(remaining)));
+      return OkStatus();
+    }
+    std::optional<multibuf::OwnedChunk> segment =
+        remaining->TakePrefix(segment_size);
+    if (!segment.has_value()) {
+      return Status::ResourceExhausted();
+    }
+    send_queue_.QueueSend(multibuf::MultiBuf::FromChunk(std::move(*segment)));
+  }
 }
 
 // RFC 9113 §6.2
@@ -39,7 +39,17 @@ enum class Http2Error : uint32_t;
 
 // Parameters of this implementation.
 // RFC 9113 §5.1.2
-inline constexpr uint32_t kMaxConcurrentStreams = 16;
+//
+// The maximum number of concurrently multiplexed streams per connection.
+// Each stream costs a Stream slot (send window, response queue) in every
+// Connection. Configurable since busy gateways multiplex many unary calls
+// over one connection.
+#ifndef PW_GRPC_MAX_CONCURRENT_STREAMS
+#define PW_GRPC_MAX_CONCURRENT_STREAMS 16
+#endif  // PW_GRPC_MAX_CONCURRENT_STREAMS
+
+inline constexpr uint32_t kMaxConcurrentStreams =
+    PW_GRPC_MAX_CONCURRENT_STREAMS;
 
 // RFC 9113 §4.2 and §6.5.2
 inline constexpr uint32_t kMaxFramePayloadSize = 16384;
@@ -145,6 +155,17 @@ class Connection {
     return writer_.SendResponseMessage(stream_id, message);
   }
 
+  // Sets the maximum DATA frame payload size used for responses on this
+  // connection, clamped to [64, internal::kMaxFramePayloadSize]. Thread
+  // safe. Intended to be driven by an application link-quality callback
+  // (RTT/loss feedback): shrinking frames under loss limits how much goodput
+  // a lost TCP segment invalidates on constrained links, and the limit may
+  // be raised again as the link recovers. Messages larger than the limit are
+  // streamed across multiple DATA frames, which HTTP/2 permits.
+  void set_max_data_frame_payload(uint32_t payload_bytes) {
+    LockState()->set_max_data_frame_payload(payload_bytes);
+  }
+
   // Completes an RPC with the given status code. Thread safe. Pigweed status
   // codes happen to align exactly with grpc status codes. Compare:
   // https://grpc.github.io/grpc/core/md_doc_statuscodes.html
@@ -273,6 +294,12 @@ class Connection {
 
     int32_t connection_send_window() const { return connection_send_window_; }
 
+    void set_max_data_frame_payload(uint32_t payload_bytes) {
+      max_data_frame_payload_ =
+          std::min(std::max(payload_bytes, kMinDataFramePayload),
+                   internal::kMaxFramePayloadSize);
+    }
+
    private:
     // Called whenever there is new data to send or a WINDOW_UPDATE message has
     // increased a send window. Should attempt to drain any queued data across
@@ -289,7 +316,10 @@ class Connection {
 
     // Stream state
     std::array<Stream, internal::kMaxConcurrentStreams> streams_{};
+    static constexpr uint32_t kMinDataFramePayload = 64;
+
     int32_t connection_send_window_ = kDefaultInitialWindowSize;
+    uint32_t max_data_frame_payload_ = internal::kMaxFramePayloadSize;
 
     // Allocator for fragmented grpc message reassembly
     allocator::Allocator* message_assembly_allocator_;
@@ -0,0 +1,111 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_hdlc/decode_in_place.h"
+
+#include <cstring>
+
+#include "pw_bytes/endian.h"
+#include "pw_checksum/crc32.h"
+#include "pw_hdlc/internal/protocol.h"
+
+using std::byte;
+
+namespace pw::hdlc {
+namespace {
+
+// Locates `value` within data[offset, end), or returns `end`.
+size_t Find(ConstByteSpan data, size_t offset, size_t end, byte value) {
+  const void* match =
+      std::memchr(data.data() + offset, static_cast<int>(value), end - offset);
+  return match == nullptr
+             ? end
+             : static_cast<size_t>(static_cast<const byte*>(match) -
+                                   data.data());
+}
+
+}  // namespace
+
+Result<Frame> DecodeNextFrameInPlace(ByteSpan data, size_t& offset) {
+  while (true) {
+    // A frame begins at a flag. Bytes before the first flag are either
+    // inter-frame garbage (reported as DATA_LOSS by the incremental decoder)
+    // or the head of a frame whose opening flag was in a previous buffer;
+    // in-place decoding cannot distinguish these, so they are treated as the
+    // start of a (possibly partial) frame only once a closing flag is seen.
+    const size_t open = Find(data, offset, data.size(), kFlag);
+    if (open == data.size()) {
+      // No flag at all: everything from offset on may be a partial frame.
+      return Status::Unavailable();
+    }
+    if (open != offset) {
+      // Garbage (or a headless partial frame) before the flag; skip it and
+      // report the loss, as the incremental decoder does.
+      offset = open;
+      return Status::DataLoss();
+    }
+
+    const size_t content = offset + 1;
+    const size_t close = Find(data, content, data.size(), kFlag);
+    if (close == data.size()) {
+      // The frame's closing flag has not arrived; leave the bytes untouched.
+      return Status::Unavailable();
+    }
+
+    if (close == content) {
+      // Repeated flags delimit empty frames, which are not an error.
+      offset = close;
+      continue;
+    }
+
+    // Unescape data[content, close) in place. Unescaping removes bytes, so
+    // the write cursor trails the read cursor and nothing is overwritten
+    // before it is read.
+    size_t write = content;
+    bool valid = true;
+    for (size_t read = content; read < close; ++read) {
+      if (data[read] == kEscape) {
+        ++read;
+        if (read == close || data[read] == kEscape) {
+          // An escape directly before the closing flag, or two escapes in a
+          // row, invalidates the frame.
+          valid = false;
+          break;
+        }
+        data[write++] = Escape(data[read]);
+      } else {
+        data[write++] = data[read];
+      }
+    }
+
+    offset = close;  // The closing flag opens the next frame.
+
+    const size_t size = write - content;
+    if (!valid || size < Frame::kMinContentSizeBytes) {
+      return Status::DataLoss();
+    }
+
+    const ConstByteSpan frame_content = data.subspan(content, size);
+    const uint32_t expected_fcs = bytes::ReadInOrder<uint32_t>(
+        endian::little, frame_content.data() + size - kFcsSize);
+    if (checksum::Crc32::Calculate(
+            frame_content.first(size - kFcsSize)) != expected_fcs) {
+      return Status::DataLoss();
+    }
+
+    return Frame::Parse(frame_content);
+  }
+}
+
+}  // namespace pw::hdlc
@@ -0,0 +1,149 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_hdlc/decode_in_place.h"
+
+#include <array>
+#include <cstring>
+
+#include "pw_hdlc/encoder.h"
+#include "pw_stream/memory_stream.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::hdlc {
+namespace {
+
+// Encodes a UI frame into `out`, returning the encoded bytes.
+ByteSpan EncodeFrame(uint64_t address, ConstByteSpan payload, ByteSpan out) {
+  stream::MemoryWriter writer(out);
+  PW_ASSERT(WriteUIFrame(address, payload, writer).ok());
+  return out.first(writer.bytes_written());
+}
+
+TEST(DecodeInPlace, DecodesSingleFrameViewingInputBuffer) {
+  std::array<std::byte, 64> buffer;
+  constexpr std::array<char, 5> kPayload = {'h', 'e', 'l', 'l', 'o'};
+  const ByteSpan encoded =
+      EncodeFrame(0x6a, as_bytes(span(kPayload)), buffer);
+
+  size_t offset = 0;
+  const Result<Frame> frame = DecodeNextFrameInPlace(encoded, offset);
+  ASSERT_EQ(frame.status(), OkStatus());
+  EXPECT_EQ(frame->address(), 0x6au);
+  ASSERT_EQ(frame->data().size(), kPayload.size());
+  EXPECT_EQ(std::memcmp(frame->data().data(), kPayload.data(), 5), 0);
+
+  // The frame data views the input buffer -- no copy was made.
+  EXPECT_GE(frame->data().data(), encoded.data());
+  EXPECT_LT(frame->data().data(), encoded.data() + encoded.size());
+}
+
+TEST(DecodeInPlace, DecodesMultipleFramesAndReportsConsumed) {
+  std::array<std::byte, 128> buffer;
+  std::array<std::byte, 64> scratch;
+  constexpr std::array<char, 3> kOne = {'o', 'n', 'e'};
+  constexpr std::array<char, 3> kTwo = {'t', 'w', 'o'};
+
+  const ByteSpan first = EncodeFrame(1, as_bytes(span(kOne)), buffer);
+  const ByteSpan second = EncodeFrame(
+      2, as_bytes(span(kTwo)), ByteSpan(buffer).subspan(first.size()));
+  const ByteSpan both = ByteSpan(buffer).first(first.size() + second.size());
+  static_cast<void>(scratch);
+
+  int frames = 0;
+  uint64_t last_address = 0;
+  const size_t consumed = DecodeFramesInPlace(
+      both, [&frames, &last_address](const Result<Frame>& frame) {
+        ASSERT_EQ(frame.status(), OkStatus());
+        ++frames;
+        last_address = frame->address();
+      });
+  EXPECT_EQ(frames, 2);
+  EXPECT_EQ(last_address, 2u);
+  // Everything but the final closing flag (retained as the next opening
+  // delimiter) is consumed.
+  EXPECT_EQ(consumed, both.size() - 1);
+}
+
+TEST(DecodeInPlace, PartialFrameIsLeftForNextBuffer) {
+  std::array<std::byte, 64> buffer;
+  constexpr std::array<char, 4> kData = {'d', 'a', 't', 'a'};
+  const ByteSpan encoded = EncodeFrame(3, as_bytes(span(kData)), buffer);
+
+  // Truncate mid-frame: no complete frame can be decoded.
+  const ByteSpan truncated = encoded.first(encoded.size() - 3);
+  int frames = 0;
+  const size_t consumed = DecodeFramesInPlace(
+      truncated, [&frames](const Result<Frame>&) { ++frames; });
+  EXPECT_EQ(frames, 0);
+  EXPECT_EQ(consumed, 0u);  // All bytes belong to the partial frame.
+}
+
+TEST(DecodeInPlace, UnescapesEscapedPayloadInPlace) {
+  std::array<std::byte, 64> buffer;
+  // 0x7e and 0x7d must be escaped on the wire.
+  constexpr std::array<char, 3> kPayload = {'\x7e', '\x7d', 'x'};
+  const ByteSpan encoded = EncodeFrame(4, as_bytes(span(kPayload)), buffer);
+
+  size_t offset = 0;
+  const Result<Frame> frame = DecodeNextFrameInPlace(encoded, offset);
+  ASSERT_EQ(frame.status(), OkStatus());
+  ASSERT_EQ(frame->data().size(), kPayload.size());
+  EXPECT_EQ(std::memcmp(frame->data().data(), kPayload.data(), 3), 0);
+}
+
+TEST(DecodeInPlace, CorruptFrameReportsDataLossAndContinues) {
+  std::array<std::byte, 128> buffer;
+  constexpr std::array<char, 3> kOk = {'y', 'e', 's'};
+  const ByteSpan bad = EncodeFrame(5, as_bytes(span(kOk)), buffer);
+  bad[3] ^= std::byte{0xff};  // Corrupt the payload; the FCS now mismatches.
+  const ByteSpan good = EncodeFrame(
+      6, as_bytes(span(kOk)), ByteSpan(buffer).subspan(bad.size()));
+  const ByteSpan both = ByteSpan(buffer).first(bad.size() + good.size());
+
+  int ok_frames = 0;
+  int errors = 0;
+  DecodeFramesInPlace(both,
+                      [&ok_frames, &errors](const Result<Frame>& frame) {
+                        if (frame.ok()) {
+                          ++ok_frames;
+                        } else {
+                          EXPECT_EQ(frame.status(), Status::DataLoss());
+                          ++errors;
+                        }
+                      });
+  EXPECT_EQ(ok_frames, 1);
+  EXPECT_EQ(errors, 1);
+}
+
+TEST(DecodeInPlace, GarbageBeforeFrameIsSkippedWithDataLoss) {
+  std::array<std::byte, 64> buffer;
+  buffer[0] = std::byte{0xaa};
+  buffer[1] = std::byte{0xbb};
+  constexpr std::array<char, 2> kData = {'o', 'k'};
+  const ByteSpan encoded =
+      EncodeFrame(7, as_bytes(span(kData)), ByteSpan(buffer).subspan(2));
+  const ByteSpan with_garbage = ByteSpan(buffer).first(2 + encoded.size());
+
+  size_t offset = 0;
+  EXPECT_EQ(DecodeNextFrameInPlace(with_garbage, offset).status(),
+            Status::DataLoss());
+  EXPECT_EQ(offset, 2u);  // Skipped to the opening flag.
+  const Result<Frame> frame = DecodeNextFrameInPlace(with_garbage, offset);
+  ASSERT_EQ(frame.status(), OkStatus());
+  EXPECT_EQ(frame->address(), 7u);
+}
+
+}  // namespace
+}  // namespace pw::hdlc
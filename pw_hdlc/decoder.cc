@@ -14,6 +14,9 @@
 
 #include "pw_hdlc/decoder.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "pw_assert/check.h"
 #include "pw_bytes/endian.h"
 #include "pw_hdlc/internal/protocol.h"
@@ -100,6 +103,44 @@ Result<Frame> Decoder::Process(const byte new_byte) {
   PW_CRASH("Bad decoder state");
 }
 
+Result<Frame> Decoder::ProcessBulk(ConstByteSpan data,
+                                   size_t& bytes_processed) {
+  size_t offset = 0;
+  while (offset < data.size()) {
+    // While inside a frame, scan ahead for the next byte that requires the
+    // state machine (a flag or escape) and append the clean run before it in
+    // one block.
+    if (state_ == State::kFrame) {
+      const byte* start = data.data() + offset;
+      const size_t remaining = data.size() - offset;
+      const void* flag = std::memchr(start, int(kFlag), remaining);
+      const size_t run_limit =
+          flag == nullptr ? remaining
+                          : static_cast<size_t>(static_cast<const byte*>(flag) -
+                                                start);
+      const void* escape = std::memchr(start, int(kEscape), run_limit);
+      const size_t run =
+          escape == nullptr
+              ? run_limit
+              : static_cast<size_t>(static_cast<const byte*>(escape) - start);
+      if (run != 0) {
+        AppendRun(ConstByteSpan(start, run));
+        offset += run;
+        continue;
+      }
+    }
+
+    const Result<Frame> result = Process(data[offset]);
+    offset += 1;
+    if (result.status() != Status::Unavailable()) {
+      bytes_processed = offset;
+      return result;
+    }
+  }
+  bytes_processed = data.size();
+  return Status::Unavailable();
+}
+
 void Decoder::AppendByte(byte new_byte) {
   if (current_frame_size_ < max_size()) {
     buffer_[current_frame_size_] = new_byte;
@@ -118,6 +159,51 @@ void Decoder::AppendByte(byte new_byte) {
   current_frame_size_ += 1;
 }
 
+void Decoder::AppendRun(ConstByteSpan run) {
+  const size_t lag = last_read_bytes_.size();
+
+  // Copy the run into the frame buffer. Bytes that do not fit are dropped;
+  // overflow is detected from current_frame_size_, as in AppendByte.
+  if (current_frame_size_ < max_size()) {
+    std::memcpy(&buffer_[current_frame_size_],
+                run.data(),
+                std::min(run.size(), max_size() - current_frame_size_));
+  }
+
+  const size_t in_ring = std::min(current_frame_size_, lag);
+  const size_t oldest = (last_read_bytes_index_ + lag - in_ring) % lag;
+
+  // Bytes pushed out of the lag window go into the running checksum, oldest
+  // first: first from the ring, then directly from the run.
+  const size_t to_evict =
+      current_frame_size_ + run.size() > lag
+          ? std::min(run.size(), current_frame_size_ + run.size() - lag)
+          : 0;
+  const size_t from_ring = std::min(to_evict, in_ring);
+  for (size_t i = 0; i < from_ring; ++i) {
+    fcs_.Update(last_read_bytes_[(oldest + i) % lag]);
+  }
+  if (to_evict > from_ring) {
+    fcs_.Update(run.first(to_evict - from_ring));
+  }
+
+  // Rebuild the lag ring with the final bytes of the run.
+  if (run.size() >= lag) {
+    for (size_t i = 0; i < lag; ++i) {
+      last_read_bytes_[i] = run[run.size() - lag + i];
+    }
+    last_read_bytes_index_ = 0;
+  } else {
+    for (const byte b : run) {
+      last_read_bytes_[last_read_bytes_index_] = b;
+      last_read_bytes_index_ =
+          (last_read_bytes_index_ + 1) % last_read_bytes_.size();
+    }
+  }
+
+  current_frame_size_ += run.size();
+}
+
 Status Decoder::CheckFrame() const {
   // Empty frames are not an error; repeated flag characters are okay.
   if (current_frame_size_ == 0u) {
@@ -85,6 +85,63 @@ TEST(Decoder, Clear) {
   EXPECT_EQ(OkStatus(), status);
 }
 
+TEST(Decoder, ProcessBulk_MatchesPerByteDecoding) {
+  // Two valid frames with an escaped byte in the second, plus trailing
+  // garbage between frames.
+  static constexpr auto kStream = bytes::String(
+      "~1234\xa3\xe0\xe3\x9b~"
+      "junk"
+      "~1234\xa3\xe0\xe3\x9b~");
+
+  // Decode the stream with the per-byte state machine.
+  DecoderBuffer<16> byte_decoder;
+  std::array<Status, 8> expected_statuses;
+  size_t expected = 0;
+  for (byte b : kStream) {
+    Result<Frame> result = byte_decoder.Process(b);
+    if (result.status() != Status::Unavailable()) {
+      ASSERT_LT(expected, expected_statuses.size());
+      expected_statuses[expected++] = result.status();
+    }
+  }
+
+  // Decode the same stream in bulk, at every possible chunk split, and expect
+  // the same sequence of statuses.
+  for (size_t split = 0; split <= kStream.size(); ++split) {
+    DecoderBuffer<16> bulk_decoder;
+    std::array<Status, 8> statuses;
+    size_t produced = 0;
+    auto callback = [&statuses, &produced](const Result<Frame>& result) {
+      ASSERT_LT(produced, statuses.size());
+      statuses[produced++] = result.status();
+    };
+    bulk_decoder.Process(span(kStream).first(split), callback);
+    bulk_decoder.Process(span(kStream).subspan(split), callback);
+
+    ASSERT_EQ(expected, produced);
+    for (size_t i = 0; i < produced; ++i) {
+      ASSERT_EQ(expected_statuses[i], statuses[i]);
+    }
+  }
+}
+
+TEST(Decoder, ProcessBulk_DecodesFrameAndReportsBytesProcessed) {
+  DecoderBuffer<16> decoder;
+  static constexpr auto kStream =
+      bytes::String("~1234\xa3\xe0\xe3\x9b~~1234\xa3\xe0\xe3\x9b~");
+
+  size_t bytes_processed = 0;
+  auto result = decoder.ProcessBulk(kStream, bytes_processed);
+  ASSERT_EQ(OkStatus(), result.status());
+  EXPECT_EQ(result.value().data().size(), 2u);
+  EXPECT_EQ(10u, bytes_processed);
+
+  result = decoder.ProcessBulk(span(kStream).subspan(bytes_processed),
+                               bytes_processed);
+  ASSERT_EQ(OkStatus(), result.status());
+  EXPECT_EQ(result.value().data().size(), 2u);
+}
+
 TEST(Decoder, ExactFit) {
   DecoderBuffer<8> decoder;
 
@@ -0,0 +1,67 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_hdlc/encoder_multibuf.h"
+
+#include <optional>
+#include <utility>
+
+#include "pw_hdlc/encoder.h"
+#include "pw_multibuf/stream.h"
+#include "pw_stream/null_stream.h"
+
+namespace pw::hdlc {
+
+Status WriteUIFrame(uint64_t address,
+                    const multibuf::MultiBuf& payload,
+                    stream::Writer& writer) {
+  Encoder encoder(writer);
+  if (Status status = encoder.StartUnnumberedFrame(address); !status.ok()) {
+    return status;
+  }
+  for (const multibuf::Chunk& chunk : payload.Chunks()) {
+    if (Status status = encoder.WriteData(chunk); !status.ok()) {
+      return status;
+    }
+  }
+  return encoder.FinishFrame();
+}
+
+Result<multibuf::MultiBuf> EncodeUIFrame(
+    uint64_t address,
+    const multibuf::MultiBuf& payload,
+    multibuf::MultiBufAllocator& allocator) {
+  // Dry-run the encoder to find the exact encoded size, which depends on how
+  // many payload bytes need escaping.
+  stream::CountingNullStream null_stream;
+  if (Status status = WriteUIFrame(address, payload, null_stream);
+      !status.ok()) {
+    return status;
+  }
+  const size_t encoded_size = null_stream.bytes_written();
+
+  std::optional<multibuf::MultiBuf> frame = allocator.Allocate(encoded_size);
+  if (!frame.has_value()) {
+    return Status::ResourceExhausted();
+  }
+
+  multibuf::Stream frame_stream(*frame);
+  if (Status status = WriteUIFrame(address, payload, frame_stream);
+      !status.ok()) {
+    return status;
+  }
+  return std::move(*frame);
+}
+
+}  // namespace pw::hdlc
@@ -0,0 +1,82 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_hdlc/encoder_multibuf.h"
+
+#include <array>
+#include <cstddef>
+
+#include "pw_hdlc/decoder.h"
+#include "pw_hdlc/internal/protocol.h"
+#include "pw_multibuf/simple_allocator_for_test.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::hdlc {
+namespace {
+
+using std::byte;
+
+constexpr uint64_t kAddress = 0x3a;
+
+TEST(EncodeUIFrame, RoundTripsThroughDecoder) {
+  multibuf::test::SimpleAllocatorForTest<> allocator;
+
+  // Payload containing bytes that need escaping.
+  multibuf::MultiBuf payload = allocator.BufWith(
+      {byte{0x01}, kFlag, byte{0x02}, kEscape, byte{0x03}});
+
+  Result<multibuf::MultiBuf> frame =
+      EncodeUIFrame(kAddress, payload, allocator);
+  ASSERT_EQ(OkStatus(), frame.status());
+
+  // The decoder must reproduce the original payload from the encoded bytes.
+  DecoderBuffer<64> decoder;
+  Result<Frame> decoded = Status::Unavailable();
+  for (byte b : *frame) {
+    auto result = decoder.Process(b);
+    if (result.status() != Status::Unavailable()) {
+      decoded = result;
+    }
+  }
+  ASSERT_EQ(OkStatus(), decoded.status());
+  EXPECT_EQ(decoded.value().address(), kAddress);
+  ASSERT_EQ(decoded.value().data().size(), payload.size());
+  size_t i = 0;
+  for (byte b : payload) {
+    EXPECT_EQ(decoded.value().data()[i++], b);
+  }
+}
+
+TEST(EncodeUIFrame, EmptyPayload) {
+  multibuf::test::SimpleAllocatorForTest<> allocator;
+  multibuf::MultiBuf payload;
+
+  Result<multibuf::MultiBuf> frame =
+      EncodeUIFrame(kAddress, payload, allocator);
+  ASSERT_EQ(OkStatus(), frame.status());
+  // Flag + address + control + FCS + flag.
+  EXPECT_EQ(frame->size(), 8u);
+}
+
+TEST(EncodeUIFrame, AllocatorTooSmall) {
+  // Data area too small to hold the payload plus an encoded frame.
+  multibuf::test::SimpleAllocatorForTest<8, 1024> allocator;
+  multibuf::MultiBuf payload = allocator.BufWith({byte{0x01}, byte{0x02}});
+
+  EXPECT_EQ(Status::ResourceExhausted(),
+            EncodeUIFrame(kAddress, payload, allocator).status());
+}
+
+}  // namespace
+}  // namespace pw::hdlc
@@ -0,0 +1,107 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_hdlc/multi_frame_decoder.h"
+
+#include <array>
+#include <cstring>
+
+#include "pw_containers/vector.h"
+#include "pw_hdlc/encoder.h"
+#include "pw_stream/memory_stream.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::hdlc {
+namespace {
+
+// Encodes a UI frame with a single-character payload repeated `len` times.
+ByteSpan EncodeFrame(char fill, size_t len, ByteSpan out) {
+  std::array<char, 16> payload;
+  std::memset(payload.data(), fill, len);
+  stream::MemoryWriter writer(out);
+  PW_ASSERT(
+      WriteUIFrame(1, as_bytes(span(payload.data(), len)), writer).ok());
+  return out.first(writer.bytes_written());
+}
+
+TEST(MultiFrameDecoder, BackToBackFramesRemainValidSimultaneously) {
+  MultiFrameDecoder<4, 64> decoder;
+  std::array<std::byte, 128> wire;
+  size_t wire_used = 0;
+  for (char c : {'a', 'b', 'c'}) {
+    wire_used +=
+        EncodeFrame(c, 4, ByteSpan(wire).subspan(wire_used)).size();
+  }
+
+  Vector<PooledFrame, 4> frames;
+  decoder.Process(ByteSpan(wire).first(wire_used),
+                  [&frames](const PooledFrame& frame) {
+                    frames.push_back(frame);
+                  });
+  ASSERT_EQ(frames.size(), 3u);
+  EXPECT_EQ(decoder.frames_decoded(), 3u);
+
+  // All three frames' payloads are live at once, each in its own buffer.
+  EXPECT_EQ(static_cast<char>(frames[0].frame.data()[0]), 'a');
+  EXPECT_EQ(static_cast<char>(frames[1].frame.data()[0]), 'b');
+  EXPECT_EQ(static_cast<char>(frames[2].frame.data()[0]), 'c');
+  EXPECT_EQ(decoder.buffers_in_use(), 4u);  // 3 held + decode target.
+
+  for (const PooledFrame& frame : frames) {
+    decoder.Release(frame.token);
+  }
+  EXPECT_EQ(decoder.buffers_in_use(), 1u);  // Only the decode target.
+}
+
+TEST(MultiFrameDecoder, PoolExhaustionDropsAndCounts) {
+  MultiFrameDecoder<2, 64> decoder;
+  std::array<std::byte, 128> wire;
+  size_t wire_used = 0;
+  for (char c : {'x', 'y'}) {
+    wire_used +=
+        EncodeFrame(c, 4, ByteSpan(wire).subspan(wire_used)).size();
+  }
+
+  int delivered = 0;
+  uint8_t held_token = 0;
+  decoder.Process(ByteSpan(wire).first(wire_used),
+                  [&delivered, &held_token](const PooledFrame& frame) {
+                    held_token = frame.token;
+                    ++delivered;  // Never released: pool exhausts.
+                  });
+  EXPECT_EQ(delivered, 1);
+  EXPECT_EQ(decoder.dropped_frames(), 1u);
+
+  // Releasing restores delivery.
+  decoder.Release(held_token);
+  wire_used = EncodeFrame('z', 4, wire).size();
+  decoder.Process(ByteSpan(wire).first(wire_used),
+                  [&delivered](const PooledFrame&) { ++delivered; });
+  EXPECT_EQ(delivered, 2);
+}
+
+TEST(MultiFrameDecoder, CorruptFrameCountsDecodeError) {
+  MultiFrameDecoder<2, 64> decoder;
+  std::array<std::byte, 64> wire;
+  const ByteSpan encoded = EncodeFrame('q', 4, wire);
+  wire[2] ^= std::byte{0xff};  // Corrupt the payload.
+
+  int delivered = 0;
+  decoder.Process(encoded, [&delivered](const PooledFrame&) { ++delivered; });
+  EXPECT_EQ(delivered, 0);
+  EXPECT_EQ(decoder.decode_errors(), 1u);
+}
+
+}  // namespace
+}  // namespace pw::hdlc
@@ -0,0 +1,81 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_hdlc/decode_in_place.h
+///
+/// In-place HDLC decoding for DMA receive paths. The incremental `Decoder`
+/// copies every frame byte into its own buffer, so a DMA ring feeding it
+/// pays two copies before a packet reaches pw_rpc. These functions instead
+/// unescape frames *within* the received region -- unescaping only ever
+/// shrinks data, so the write cursor never passes the read cursor -- and
+/// yield `Frame` objects that view the DMA buffer directly. The RX path is
+/// then DMA -> frame with no intermediate copy at all.
+///
+/// Only frames wholly contained in the buffer can be decoded in place; a
+/// trailing partial frame is left untouched, and its offset is reported so
+/// the caller can carry those bytes into the next region (or feed them to an
+/// incremental `Decoder` as the fallback).
+
+#include <utility>
+
+#include "pw_bytes/span.h"
+#include "pw_hdlc/decoder.h"
+#include "pw_result/result.h"
+
+namespace pw::hdlc {
+
+/// Decodes the next complete frame within `data`, starting at `offset`,
+/// unescaping it in place.
+///
+/// On success, the returned `Frame` views unescaped bytes inside `data`; it
+/// is valid until the caller reuses the buffer. `offset` is advanced past
+/// the frame's closing flag position (the flag itself is retained as the
+/// next frame's opening delimiter, matching `Decoder`'s behavior).
+///
+/// @returns @rst
+///
+/// .. pw-status-codes::
+///
+///    OK: A frame was decoded; ``offset`` points at its closing flag.
+///
+///    UNAVAILABLE: No complete frame remains. ``offset`` points at the
+///    trailing partial frame (or ``data.size()``); the caller carries those
+///    bytes into the next buffer.
+///
+///    DATA_LOSS: A malformed or corrupt frame was skipped; decoding may
+///    continue at the updated ``offset``.
+///
+/// @endrst
+Result<Frame> DecodeNextFrameInPlace(ByteSpan data, size_t& offset);
+
+/// Decodes every complete frame in `data` in place, invoking `callback` with
+/// each `Result<Frame>` that is not `UNAVAILABLE` (mirroring
+/// `Decoder::Process`). Returns the number of bytes consumed; bytes from the
+/// returned offset onward belong to a trailing partial frame and must be
+/// carried into the next buffer by the caller.
+template <typename F, typename... Args>
+size_t DecodeFramesInPlace(ByteSpan data, F&& callback, Args&&... args) {
+  size_t offset = 0;
+  while (offset < data.size()) {
+    auto result = DecodeNextFrameInPlace(data, offset);
+    if (result.status() == Status::Unavailable()) {
+      break;
+    }
+    callback(std::forward<Args>(args)..., result);
+  }
+  return offset;
+}
+
+}  // namespace pw::hdlc
@@ -110,12 +110,25 @@ class Decoder {
                : max_frame_size - 2;
   }
 
+  /// @brief Processes a span of data in bulk, returning when a byte completes
+  /// a frame or produces an error, or when all of the data is consumed.
+  ///
+  /// Runs of bytes that need no unescaping are located by scanning for the
+  /// flag and escape bytes and appended to the frame in blocks, which is much
+  /// faster than pushing each byte through the state machine. Sets
+  /// `bytes_processed` to the number of bytes consumed from `data`; when a
+  /// non-``UNAVAILABLE`` status is returned, decoding should continue with the
+  /// remaining data. The returned statuses match `Process()`.
+  Result<Frame> ProcessBulk(ConstByteSpan data, size_t& bytes_processed);
+
   /// @brief Processes a span of data and calls the provided callback with each
   /// frame or error.
   template <typename F, typename... Args>
   void Process(ConstByteSpan data, F&& callback, Args&&... args) {
-    for (std::byte b : data) {
-      auto result = Process(b);
+    while (!data.empty()) {
+      size_t bytes_processed = 0;
+      auto result = ProcessBulk(data, bytes_processed);
+      data = data.subspan(bytes_processed);
       if (result.status() != Status::Unavailable()) {
         callback(std::forward<Args>(args)..., result);
       }
@@ -125,6 +138,17 @@ class Decoder {
   // Returns the maximum size of the Decoder's frame buffer.
   size_t max_size() const { return buffer_.size(); }
 
+  // Replaces the decoder's frame buffer, returning the previous one. Only
+  // valid between frames (no partial frame may be buffered); used by pooled
+  // decoding to rotate buffers so a completed frame stays valid while the
+  // next one decodes.
+  ByteSpan ExchangeBuffer(ByteSpan new_buffer) {
+    PW_DASSERT(current_frame_size_ == 0);
+    ByteSpan previous = buffer_;
+    buffer_ = new_buffer;
+    return previous;
+  }
+
   // Clears and resets the decoder.
   void Clear() {
     state_ = State::kInterFrame;
@@ -147,6 +171,10 @@ class Decoder {
 
   void AppendByte(std::byte new_byte);
 
+  // Appends a run of bytes that need no unescaping to the current frame,
+  // equivalent to calling AppendByte for each byte.
+  void AppendRun(ConstByteSpan run);
+
   Status CheckFrame() const;
 
   bool VerifyFrameCheckSequence() const;
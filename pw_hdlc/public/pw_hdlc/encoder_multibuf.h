@@ -0,0 +1,58 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+
+#include "pw_multibuf/allocator.h"
+#include "pw_multibuf/multibuf.h"
+#include "pw_result/result.h"
+#include "pw_status/status.h"
+#include "pw_stream/stream.h"
+
+namespace pw::hdlc {
+
+/// @brief Writes an HDLC unnumbered information frame (UI frame) with a
+/// scattered payload to the provided ``pw::stream`` writer.
+///
+/// The payload chunks are encoded in order without being copied into an
+/// intermediate contiguous buffer.
+Status WriteUIFrame(uint64_t address,
+                    const multibuf::MultiBuf& payload,
+                    stream::Writer& writer);
+
+/// @brief Encodes an HDLC UI frame into chunks allocated from ``allocator``.
+///
+/// The frame is written scatter-gather style directly into the allocated
+/// chunks, which may be non-contiguous; no intermediate frame buffer is used,
+/// so each payload byte is copied exactly once while it is escaped. The
+/// returned ``MultiBuf`` is exactly the encoded frame size.
+///
+/// @returns @rst
+///
+/// .. pw-status-codes::
+///
+///    OK: The frame was encoded into the returned ``MultiBuf``.
+///
+///    RESOURCE_EXHAUSTED: ``allocator`` could not provide enough space
+///    for the encoded frame.
+///
+///    INVALID_ARGUMENT: ``address`` could not be encoded.
+///
+/// @endrst
+Result<multibuf::MultiBuf> EncodeUIFrame(uint64_t address,
+                                         const multibuf::MultiBuf& payload,
+                                         multibuf::MultiBufAllocator& allocator);
+
+}  // namespace pw::hdlc
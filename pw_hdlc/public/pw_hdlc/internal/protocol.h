@@ -62,6 +62,17 @@ inline constexpr size_t kFcsSize = sizeof(uint32_t);
 inline constexpr varint::Format kAddressFormat =
     varint::Format::kOneTerminatedLeastSignificant;
 
+// The first on-the-wire byte of an encoded address. For addresses up to 127
+// the address is a single byte (the value shifted left once, with the
+// terminating 1 in the least significant bit), so it is also the complete
+// byte following the opening flag. Multi-drop buses can program UART
+// address-match / wake-on-address hardware with this value to filter frames
+// for other drops without waking the CPU.
+constexpr std::byte FirstAddressByte(uint64_t address) {
+  return static_cast<std::byte>(((address & 0x7Fu) << 1) |
+                                (address < 0x80u ? 1u : 0u));
+}
+
 constexpr bool NeedsEscaping(std::byte b) {
   return (b == kFlag || b == kEscape);
 }
@@ -0,0 +1,137 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+// Pooled multi-frame HDLC decoding with link-quality metrics. A
+// DecoderBuffer holds exactly one frame, so frame N must be fully consumed
+// before frame N+1 can decode -- slow RPC dispatch stalls the UART ring.
+// MultiFrameDecoder rotates through a pool of frame buffers instead: each
+// completed frame is handed out with a token and remains valid until
+// released, while decoding continues immediately into the next pooled
+// buffer. Decode errors and pool exhaustion are counted via pw_metric, so
+// link quality is observable numerically.
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "pw_bytes/span.h"
+#include "pw_hdlc/decoder.h"
+#include "pw_metric/metric.h"
+#include "pw_result/result.h"
+
+namespace pw::hdlc {
+
+// A decoded frame handed out by MultiFrameDecoder. The frame's data remains
+// valid until the token is passed to Release().
+struct PooledFrame {
+  Frame frame;
+  uint8_t token;
+};
+
+// Decodes HDLC frames into a rotating pool of `kFrameCount` buffers of
+// `kFrameSizeBytes` each (sized per DecoderBuffer's rules).
+template <size_t kFrameCount, size_t kFrameSizeBytes>
+class MultiFrameDecoder {
+ public:
+  static_assert(kFrameCount >= 2, "A pool of one frame cannot pipeline");
+  static_assert(kFrameSizeBytes >= Frame::kMinContentSizeBytes);
+
+  MultiFrameDecoder() : decoder_(buffers_[0]) { in_use_[0] = true; }
+
+  // Processes `data`, invoking `callback(PooledFrame)` for each completed
+  // frame. The callback's frame stays valid until Release(token); decoding
+  // of subsequent frames continues into other pooled buffers immediately.
+  // If every buffer is held when a frame completes, the frame is dropped
+  // (counted) and its buffer reused.
+  template <typename F>
+  void Process(ConstByteSpan data, F&& callback) {
+    while (!data.empty()) {
+      size_t bytes_processed = 0;
+      const Result<Frame> result = decoder_.ProcessBulk(data, bytes_processed);
+      data = data.subspan(bytes_processed);
+
+      if (result.status() == Status::Unavailable()) {
+        continue;  // No frame completed yet.
+      }
+      if (!result.ok()) {
+        // CRC failures, resyncs on garbage, and oversized frames.
+        if (result.status() == Status::ResourceExhausted()) {
+          oversized_frames_.Increment();
+        } else {
+          decode_errors_.Increment();
+        }
+        continue;
+      }
+
+      const int free_index = FindFreeBuffer();
+      if (free_index < 0) {
+        // Every buffer is held by a consumer: drop this frame and keep
+        // decoding into the same buffer.
+        dropped_frames_.Increment();
+        continue;
+      }
+
+      const uint8_t token = current_buffer_;
+      in_use_[static_cast<size_t>(free_index)] = true;
+      current_buffer_ = static_cast<uint8_t>(free_index);
+      decoder_.ExchangeBuffer(buffers_[static_cast<size_t>(free_index)]);
+
+      frames_decoded_.Increment();
+      callback(PooledFrame{.frame = result.value(), .token = token});
+    }
+  }
+
+  // Returns a frame's buffer to the pool.
+  void Release(uint8_t token) { in_use_[token] = false; }
+
+  // Buffers currently held by consumers (including the decode target).
+  size_t buffers_in_use() const {
+    size_t count = 0;
+    for (bool used : in_use_) {
+      count += used ? 1 : 0;
+    }
+    return count;
+  }
+
+  const metric::Group& metrics() const { return metrics_; }
+  uint32_t frames_decoded() const { return frames_decoded_.value(); }
+  uint32_t decode_errors() const { return decode_errors_.value(); }
+  uint32_t dropped_frames() const { return dropped_frames_.value(); }
+  uint32_t oversized_frames() const { return oversized_frames_.value(); }
+
+ private:
+  int FindFreeBuffer() const {
+    for (size_t i = 0; i < kFrameCount; ++i) {
+      if (!in_use_[i]) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  std::array<std::array<std::byte, kFrameSizeBytes>, kFrameCount> buffers_ =
+      {};
+  std::array<bool, kFrameCount> in_use_ = {};
+  uint8_t current_buffer_ = 0;
+  Decoder decoder_;
+
+  PW_METRIC_GROUP(metrics_, "pw::hdlc::MultiFrameDecoder");
+  PW_METRIC(metrics_, frames_decoded_, "frames_decoded", 0u);
+  PW_METRIC(metrics_, decode_errors_, "decode_errors", 0u);
+  PW_METRIC(metrics_, dropped_frames_, "dropped_frames", 0u);
+  PW_METRIC(metrics_, oversized_frames_, "oversized_frames", 0u);
+};
+
+}  // namespace pw::hdlc
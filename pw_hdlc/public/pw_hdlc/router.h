@@ -160,6 +160,11 @@ class Router final {
   /// ``receive_address`` or nullptr if no such entry is found.
   ChannelData* FindChannelForReceiveAddress(uint64_t receive_address);
 
+  // Index of the channel that matched the previous incoming frame; incoming
+  // traffic is bursty per address, so this usually avoids the list scan.
+  // Invalidated implicitly by bounds/address checks when channels change.
+  size_t last_receive_channel_index_ = 0;
+
   /// Decodes and writes buffers from ``io_channel_`` and writes them into
   /// the corresponding channel.
   void DecodeAndWriteIncoming(pw::async2::Context& cx);
@@ -20,6 +20,7 @@
 
 #include "pw_hdlc/encoder.h"
 #include "pw_log/log.h"
+#include "pw_hdlc/encoder_multibuf.h"
 #include "pw_multibuf/multibuf.h"
 #include "pw_multibuf/stream.h"
 #include "pw_result/result.h"
@@ -39,27 +40,11 @@ using ::pw::stream::CountingNullStream;
 
 namespace {
 
-/// HDLC encodes the contents of ``payload`` to ``writer``.
-Status WriteMultiBufUIFrame(uint64_t address,
-                            const MultiBuf& payload,
-                            stream::Writer& writer) {
-  Encoder encoder(writer);
-  if (Status status = encoder.StartUnnumberedFrame(address); !status.ok()) {
-    return status;
-  }
-  for (const Chunk& chunk : payload.Chunks()) {
-    if (Status status = encoder.WriteData(chunk); !status.ok()) {
-      return status;
-    }
-  }
-  return encoder.FinishFrame();
-}
-
 /// Calculates the size of ``payload`` once HDLC-encoded.
 Result<size_t> CalculateSizeOnceEncoded(uint64_t address,
                                         const MultiBuf& payload) {
   CountingNullStream null_stream;
-  Status encode_status = WriteMultiBufUIFrame(address, payload, null_stream);
+  Status encode_status = WriteUIFrame(address, payload, null_stream);
   if (!encode_status.ok()) {
     return encode_status;
   }
@@ -132,8 +117,17 @@ Status Router::RemoveChannel(DatagramReaderWriter& channel,
 
 Router::ChannelData* Router::FindChannelForReceiveAddress(
     uint64_t receive_address) {
+  // Incoming frames arrive in per-address bursts, so check the channel that
+  // matched the previous frame before scanning the channel list.
+  if (last_receive_channel_index_ < channel_datas_.size() &&
+      channel_datas_[last_receive_channel_index_].receive_address ==
+          receive_address) {
+    return &channel_datas_[last_receive_channel_index_];
+  }
   for (auto& channel : channel_datas_) {
     if (channel.receive_address == receive_address) {
+      last_receive_channel_index_ =
+          static_cast<size_t>(&channel - channel_datas_.data());
       return &channel;
     }
   }
@@ -293,10 +287,11 @@ void Router::WriteOutgoingMessages(Context& cx) {
       continue;
     }
     MultiBuf write_buffer = std::move(**maybe_write_buffer);
+    pw::multibuf::Stream frame_stream(write_buffer);
     Status encode_status =
-        WriteMultiBufUIFrame(target_address,
-                             buffer_to_encode_and_send_->buffer,
-                             pw::multibuf::Stream(write_buffer));
+        WriteUIFrame(target_address,
+                     buffer_to_encode_and_send_->buffer,
+                     frame_stream);
     buffer_to_encode_and_send_ = std::nullopt;
     if (!encode_status.ok()) {
       PW_LOG_ERROR(
@@ -37,6 +37,9 @@ constexpr const std::string_view kAsciiHeader("Text");
 // Minimum number of hex characters to use when displaying dump offset.
 constexpr const size_t kMinOffsetChars = 4;
 
+// Table for byte-to-hex conversion in the line formatting loop.
+constexpr const char kNibbleChars[] = "0123456789abcdef";
+
 char PrintableChar(std::byte b) {
   if (std::isprint(std::to_integer<char>(b)) == 0) {
     return '.';
@@ -172,7 +175,13 @@ Status FormattedHexDumper::DumpLine() {
   for (size_t i = 0; i < bytes_in_line; ++i) {
     // Early loop termination for when bytes_remaining <
     // bytes_per_line.
-    builder << source_data_[i];
+    //
+    // Emit both hex characters from a lookup table rather than routing each
+    // byte through the generic ToString conversion.
+    const uint8_t value = std::to_integer<uint8_t>(source_data_[i]);
+    const char hex_chars[2] = {kNibbleChars[value >> 4],
+                               kNibbleChars[value & 0xF]};
+    builder.append(std::string_view(hex_chars, 2));
     AddGroupingByte(i, flags, builder);
   }
   // Add padding spaces to ensure lines are aligned.
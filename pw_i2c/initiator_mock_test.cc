@@ -32,6 +32,36 @@ namespace {
 
 constexpr auto kI2cTransactionTimeout = chrono::SystemClock::for_at_least(2ms);
 
+TEST(Transaction, BatchedTransfer) {
+  static constexpr Address kAddress1 = Address::SevenBit<0x01>();
+  static constexpr Address kAddress2 = Address::SevenBit<0x02>();
+  constexpr auto kExpectWrite = bytes::Array<0x42>();
+  constexpr auto kExpectRead = bytes::Array<7, 8, 9>();
+
+  auto expected_transactions = MakeExpectedTransactionArray(
+      {WriteTransaction(
+           OkStatus(), kAddress1, kExpectWrite, kI2cTransactionTimeout),
+       ReadTransaction(
+           OkStatus(), kAddress2, kExpectRead, kI2cTransactionTimeout)});
+
+  MockInitiator mocked_i2c(expected_transactions);
+
+  std::array<std::byte, kExpectRead.size()> read = {};
+  const std::array<Initiator::Message, 2> messages = {{
+      {.device_address = kAddress1,
+       .tx_buffer = kExpectWrite,
+       .rx_buffer = ByteSpan()},
+      {.device_address = kAddress2,
+       .tx_buffer = ConstByteSpan(),
+       .rx_buffer = read},
+  }};
+  EXPECT_EQ(mocked_i2c.TransferFor(messages, kI2cTransactionTimeout),
+            OkStatus());
+  EXPECT_TRUE(pw::containers::Equal(read, kExpectRead));
+
+  EXPECT_EQ(mocked_i2c.Finalize(), OkStatus());
+}
+
 TEST(Transaction, Read) {
   static constexpr Address kAddress1 = Address::SevenBit<0x01>();
   constexpr auto kExpectRead1 = bytes::Array<1, 2, 3, 4, 5>();
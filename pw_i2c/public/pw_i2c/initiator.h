@@ -18,7 +18,9 @@
 #include "pw_bytes/span.h"
 #include "pw_chrono/system_clock.h"
 #include "pw_i2c/address.h"
+#include "pw_span/span.h"
 #include "pw_status/status.h"
+#include "pw_status/try.h"
 
 namespace pw::i2c {
 
@@ -273,11 +275,45 @@ class Initiator {
         device_address, ConstByteSpan(), ignored_buffer, timeout);
   }
 
+  /// Describes one message of a batched transfer: a write
+  /// (`rx_buffer` empty), a read (`tx_buffer` empty), or a write followed by
+  /// a read with a repeated start, addressed to one device.
+  struct Message {
+    Address device_address;
+    ConstByteSpan tx_buffer;
+    ByteSpan rx_buffer;
+  };
+
+  /// Executes a sequence of messages, letting backends that support it
+  /// (e.g. a single I2C_RDWR ioctl on Linux, or one bus claim on MCU
+  /// drivers) perform them as one batched bus operation. The default
+  /// implementation performs the messages sequentially, applying `timeout`
+  /// to each.
+  ///
+  /// @returns The first error encountered; messages after a failing one are
+  /// not executed.
+  Status TransferFor(span<const Message> messages,
+                     chrono::SystemClock::duration timeout) {
+    return DoTransferFor(messages, timeout);
+  }
+
  private:
   virtual Status DoWriteReadFor(Address device_address,
                                 ConstByteSpan tx_buffer,
                                 ByteSpan rx_buffer,
                                 chrono::SystemClock::duration timeout) = 0;
+
+  /// Batched transfer hook; backends override this to issue the whole
+  /// sequence as one bus operation.
+  virtual Status DoTransferFor(span<const Message> messages,
+                               chrono::SystemClock::duration timeout) {
+    for (const Message& message : messages) {
+      PW_TRY(DoWriteReadFor(
+          message.device_address, message.tx_buffer, message.rx_buffer,
+          timeout));
+    }
+    return OkStatus();
+  }
 };
 
 }  // namespace pw::i2c
@@ -232,4 +232,84 @@ Status LinuxInitiator::DoWriteReadForLocked(
   return OkStatus();
 }
 
+Status LinuxInitiator::DoTransferFor(span<const Message> messages,
+                                     SystemClock::duration timeout) {
+  const auto start_time = SystemClock::now();
+
+  if (messages.empty()) {
+    return OkStatus();
+  }
+
+  // Each message contributes one i2c_msg for its write part and one for its
+  // read part. The kernel limits I2C_RDWR to I2C_RDWR_IOCTL_MAX_MSGS (42)
+  // operations per ioctl.
+  std::array<i2c_msg, I2C_RDWR_IOCTL_MAX_MSGS> operations{};
+  uint32_t num_operations = 0;
+  for (const Message& message : messages) {
+    if (message.tx_buffer.empty() && message.rx_buffer.empty()) {
+      PW_LOG_ERROR("Each message must have a tx_buffer or an rx_buffer");
+      return Status::InvalidArgument();
+    }
+    const auto address = message.device_address.GetSevenBit();
+    if (!message.tx_buffer.empty()) {
+      if (num_operations == operations.size()) {
+        return Status::ResourceExhausted();
+      }
+      operations[num_operations++] = i2c_msg{
+          .addr = address,
+          .flags = 0,
+          .len = static_cast<uint16_t>(message.tx_buffer.size()),
+          .buf = reinterpret_cast<uint8_t*>(const_cast<std::byte*>(
+              message.tx_buffer.data())),  // NOLINT: read-only
+      };
+    }
+    if (!message.rx_buffer.empty()) {
+      if (num_operations == operations.size()) {
+        return Status::ResourceExhausted();
+      }
+      operations[num_operations++] = i2c_msg{
+          .addr = address,
+          .flags = I2C_M_RD,
+          .len = static_cast<uint16_t>(message.rx_buffer.size()),
+          .buf = reinterpret_cast<uint8_t*>(message.rx_buffer.data()),
+      };
+    }
+  }
+
+  i2c_rdwr_ioctl_data ioctl_data{
+      .msgs = operations.data(),
+      .nmsgs = num_operations,
+  };
+
+  // Try to acquire access to the bus.
+  if (!mutex_.try_lock_for(timeout)) {
+    return Status::DeadlineExceeded();
+  }
+  std::lock_guard lock(mutex_, std::adopt_lock);
+
+  // Attempt the batched transaction with the same retry-on-arbitration-loss
+  // policy as single transactions.
+  do {
+    if (ioctl(fd_, I2C_RDWR, &ioctl_data) < 0) {
+      Status status = PwStatusAndLog(errno, operations[0].addr);
+      if (status == Status::Aborted()) {
+        PW_LOG_DEBUG("Retrying batched I2C transaction");
+        continue;
+      }
+      return status;
+    }
+    return OkStatus();
+  } while (SystemClock::now() - start_time < timeout);
+
+  if (ioctl(fd_, I2C_RDWR, &ioctl_data) < 0) {
+    Status status = PwStatusAndLog(errno, operations[0].addr);
+    if (status == Status::Aborted()) {
+      PW_LOG_INFO("Timeout waiting for I2C bus access");
+      return Status::DeadlineExceeded();
+    }
+    return status;
+  }
+  return OkStatus();
+}
+
 }  // namespace pw::i2c
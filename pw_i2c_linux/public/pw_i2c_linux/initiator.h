@@ -80,6 +80,14 @@ class LinuxInitiator final : public Initiator {
                         chrono::SystemClock::duration timeout) override
       PW_LOCKS_EXCLUDED(mutex_);
 
+  /// Executes a batch of messages as a single I2C_RDWR ioctl, claiming the
+  /// bus and entering the kernel once for the whole sequence. Each write,
+  /// read, or write+read message maps to one or two i2c_msg entries, bounded
+  /// by the kernel's I2C_RDWR_IOCTL_MAX_MSGS.
+  Status DoTransferFor(span<const Message> messages,
+                       chrono::SystemClock::duration timeout) override
+      PW_LOCKS_EXCLUDED(mutex_);
+
   Status DoWriteReadForLocked(uint8_t address,
                               ConstByteSpan tx_buffer,
                               ByteSpan rx_buffer,
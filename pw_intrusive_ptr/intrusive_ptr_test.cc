@@ -14,10 +14,13 @@
 
 #include "pw_intrusive_ptr/intrusive_ptr.h"
 
+#include <array>
+
 #include <stdint.h>
 
 #include <utility>
 
+#include "pw_intrusive_ptr/single_threaded_ref_counted.h"
 #include "pw_unit_test/framework.h"
 
 namespace pw {
@@ -102,6 +105,67 @@ class IntrusivePtrTest : public ::testing::Test {
   }
 };
 
+class SingleThreadedItem : public SingleThreadedRefCounted<SingleThreadedItem> {
+ public:
+  SingleThreadedItem() { ++instance_counter; }
+  ~SingleThreadedItem() { --instance_counter; }
+
+  inline static int32_t instance_counter = 0;
+};
+
+TEST_F(IntrusivePtrTest, ReleaseAllCoalescesAndEmptiesPointers) {
+  auto item_a = IntrusivePtr<TestItem>(new TestItem());
+  auto item_b = IntrusivePtr<TestItem>(new TestItem());
+  std::array<IntrusivePtr<TestItem>, 5> batch = {
+      item_a, item_b, item_a, item_a, IntrusivePtr<TestItem>()};
+  EXPECT_EQ(item_a.use_count(), 4);
+  EXPECT_EQ(item_b.use_count(), 2);
+
+  IntrusivePtr<TestItem>::ReleaseAll(batch);
+  for (const auto& ptr : batch) {
+    EXPECT_FALSE(ptr);
+  }
+  EXPECT_EQ(item_a.use_count(), 1);
+  EXPECT_EQ(item_b.use_count(), 1);
+  EXPECT_EQ(TestItem::instance_counter, 2);
+}
+
+TEST_F(IntrusivePtrTest, ReleaseAllDeletesObjectsWithNoRemainingRefs) {
+  std::array<IntrusivePtr<TestItem>, 3> batch;
+  auto item = IntrusivePtr<TestItem>(new TestItem());
+  batch[0] = item;
+  batch[1] = item;
+  batch[2] = std::move(item);
+  EXPECT_EQ(TestItem::instance_counter, 1);
+
+  IntrusivePtr<TestItem>::ReleaseAll(batch);
+  EXPECT_EQ(TestItem::instance_counter, 0);
+}
+
+TEST_F(IntrusivePtrTest, SingleThreadedRefCountBehavesLikeAtomic) {
+  SingleThreadedItem::instance_counter = 0;
+  {
+    auto ptr = IntrusivePtr<SingleThreadedItem>(new SingleThreadedItem());
+    EXPECT_EQ(SingleThreadedItem::instance_counter, 1);
+    {
+      IntrusivePtr<SingleThreadedItem> copy = ptr;
+      EXPECT_EQ(ptr.use_count(), 2);
+    }
+    EXPECT_EQ(ptr.use_count(), 1);
+  }
+  EXPECT_EQ(SingleThreadedItem::instance_counter, 0);
+}
+
+TEST_F(IntrusivePtrTest, SingleThreadedReleaseAll) {
+  SingleThreadedItem::instance_counter = 0;
+  std::array<IntrusivePtr<SingleThreadedItem>, 2> batch;
+  auto item = IntrusivePtr<SingleThreadedItem>(new SingleThreadedItem());
+  batch[0] = item;
+  batch[1] = std::move(item);
+  IntrusivePtr<SingleThreadedItem>::ReleaseAll(batch);
+  EXPECT_EQ(SingleThreadedItem::instance_counter, 0);
+}
+
 TEST_F(IntrusivePtrTest, DeletingLastPtrDeletesTheObject) {
   {
     IntrusivePtr<TestItem> ptr(new TestItem());
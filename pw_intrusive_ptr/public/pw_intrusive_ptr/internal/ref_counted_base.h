@@ -38,6 +38,11 @@ class RefCountedBase {
   // deleted.
   [[nodiscard]] bool ReleaseRef() const;
 
+  // Decrements the reference count by `count` with a single atomic operation
+  // and returns true if the object should be deleted. Used by
+  // IntrusivePtr::ReleaseAll to coalesce batched releases.
+  [[nodiscard]] bool ReleaseRefs(int32_t count) const;
+
   // Returns current ref count value.
   [[nodiscard]] int32_t ref_count() const {
     return ref_count_.load(std::memory_order_relaxed);
@@ -19,6 +19,7 @@
 
 #include "pw_intrusive_ptr/internal/ref_counted_base.h"
 #include "pw_intrusive_ptr/recyclable.h"
+#include "pw_span/span.h"
 
 namespace pw {
 
@@ -111,6 +112,34 @@ class IntrusivePtr final {
 
   void swap(IntrusivePtr& other) { std::swap(ptr_, other.ptr_); }
 
+  // Releases every pointer in `ptrs`, coalescing the reference-count
+  // decrements so each distinct object receives a single atomic operation
+  // regardless of how many pointers in the batch refer to it. All pointers
+  // are left empty. Dropping a graph-structured table that holds thousands
+  // of references to a smaller set of nodes this way avoids serializing on
+  // each node's counter.
+  //
+  // Requires T to provide ReleaseRefs(int32_t) (inherited from RefCounted or
+  // SingleThreadedRefCounted).
+  static void ReleaseAll(span<IntrusivePtr> ptrs) {
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+      T* const target = std::exchange(ptrs[i].ptr_, nullptr);
+      if (target == nullptr) {
+        continue;
+      }
+      int32_t count = 1;
+      for (size_t j = i + 1; j < ptrs.size(); ++j) {
+        if (ptrs[j].ptr_ == target) {
+          ptrs[j].ptr_ = nullptr;
+          ++count;
+        }
+      }
+      if (target->ReleaseRefs(count)) {
+        recycle_or_delete(target);
+      }
+    }
+  }
+
   T* get() const { return ptr_; }
 
   int32_t use_count() const { return ptr_ ? ptr_->ref_count() : 0; }
@@ -0,0 +1,69 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+
+#include "pw_assert/assert.h"
+#include "pw_intrusive_ptr/intrusive_ptr.h"
+
+namespace pw {
+
+// Non-atomic counterpart of RefCounted, for objects confined to a single
+// thread or dispatcher. Reference count updates are plain integer arithmetic
+// with no atomic traffic, which matters on hot paths that copy and drop many
+// pointers (e.g. per-packet routing through a shared table polled by one
+// dispatcher).
+//
+// All IntrusivePtrs to a SingleThreadedRefCounted object MUST be created,
+// copied, and destroyed on the same thread; nothing here detects violations.
+// Like RefCounted, this MUST never be used as a pointer type to store derived
+// objects - it doesn't provide a virtual destructor.
+template <typename T>
+class SingleThreadedRefCounted {
+ public:
+  using Ptr = IntrusivePtr<T>;
+
+ protected:
+  constexpr SingleThreadedRefCounted() = default;
+  ~SingleThreadedRefCounted() = default;
+
+  SingleThreadedRefCounted(const SingleThreadedRefCounted&) = delete;
+  SingleThreadedRefCounted(SingleThreadedRefCounted&&) = delete;
+  SingleThreadedRefCounted& operator=(const SingleThreadedRefCounted&) = delete;
+  SingleThreadedRefCounted& operator=(SingleThreadedRefCounted&&) = delete;
+
+ private:
+  template <typename U>
+  friend class IntrusivePtr;
+
+  void AddRef() const { ++ref_count_; }
+
+  [[nodiscard]] bool ReleaseRef() const {
+    PW_DASSERT(ref_count_ >= 1);
+    return --ref_count_ == 0;
+  }
+
+  [[nodiscard]] bool ReleaseRefs(int32_t count) const {
+    PW_DASSERT(ref_count_ >= count);
+    ref_count_ -= count;
+    return ref_count_ == 0;
+  }
+
+  [[nodiscard]] int32_t ref_count() const { return ref_count_; }
+
+  mutable int32_t ref_count_ = 0;
+};
+
+}  // namespace pw
@@ -58,4 +58,14 @@ bool RefCountedBase::ReleaseRef() const {
   return refs == 1;
 }
 
+bool RefCountedBase::ReleaseRefs(int32_t count) const {
+  // See ReleaseRef for the rationale behind acq_rel on every release.
+  const auto refs = ref_count_.fetch_sub(count, std::memory_order_acq_rel);
+
+  // Fires if a batch releases more references than are held.
+  PW_DCHECK(refs >= count);
+
+  return refs == count;
+}
+
 }  // namespace pw::internal
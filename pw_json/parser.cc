@@ -0,0 +1,229 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_json/parser.h"
+
+#include "pw_status/try.h"
+
+namespace pw::json {
+namespace {
+
+// Iterative JSON parser. Nesting is tracked in a 64-bit stack with one bit
+// per level (1 = object, 0 = array).
+class Parser {
+ public:
+  Parser(std::string_view json, JsonHandler& handler)
+      : json_(json), handler_(handler) {}
+
+  Status Run() {
+    SkipWhitespace();
+    PW_TRY(ParseValue());
+    SkipWhitespace();
+    if (!json_.empty()) {
+      return Status::InvalidArgument();  // Trailing characters.
+    }
+    return OkStatus();
+  }
+
+ private:
+  static constexpr size_t kMaxDepth = 64;
+
+  void SkipWhitespace() {
+    size_t i = 0;
+    while (i < json_.size() && (json_[i] == ' ' || json_[i] == '\t' ||
+                                json_[i] == '\n' || json_[i] == '\r')) {
+      ++i;
+    }
+    json_.remove_prefix(i);
+  }
+
+  bool Consume(char c) {
+    if (json_.empty() || json_.front() != c) {
+      return false;
+    }
+    json_.remove_prefix(1);
+    return true;
+  }
+
+  Status ParseValue() {
+    if (json_.empty()) {
+      return Status::InvalidArgument();
+    }
+    switch (json_.front()) {
+      case '{':
+        return ParseContainer(/*is_object=*/true);
+      case '[':
+        return ParseContainer(/*is_object=*/false);
+      case '"': {
+        std::string_view contents;
+        PW_TRY(ParseString(contents));
+        return handler_.OnString(contents);
+      }
+      case 't':
+        return ParseLiteral("true") ? handler_.OnBool(true)
+                                    : Status::InvalidArgument();
+      case 'f':
+        return ParseLiteral("false") ? handler_.OnBool(false)
+                                     : Status::InvalidArgument();
+      case 'n':
+        return ParseLiteral("null") ? handler_.OnNull()
+                                    : Status::InvalidArgument();
+      default:
+        return ParseNumber();
+    }
+  }
+
+  // Parses an object or array iteratively, using the bitstack for nesting.
+  Status ParseContainer(bool is_object) {
+    PW_TRY(Push(is_object));
+    json_.remove_prefix(1);
+
+    while (depth_ > 0) {
+      const bool in_object = (container_bits_ >> (depth_ - 1)) & 1u;
+      SkipWhitespace();
+
+      // Handle an empty container or the container's closing bracket.
+      if (Consume(in_object ? '}' : ']')) {
+        PW_TRY(in_object ? handler_.OnObjectEnd() : handler_.OnArrayEnd());
+        --depth_;
+        // After closing, the parent must see ',' or its own close bracket;
+        // anything else (e.g. "[[] []]") is a missing separator.
+        SkipWhitespace();
+        if (depth_ > 0) {
+          if (!json_.empty() && json_.front() == ',') {
+            json_.remove_prefix(1);
+            SkipWhitespace();
+            // A close bracket may not directly follow a comma.
+            if (!json_.empty() &&
+                (json_.front() == '}' || json_.front() == ']')) {
+              return Status::InvalidArgument();
+            }
+          } else if (json_.empty() ||
+                     (json_.front() != '}' && json_.front() != ']')) {
+            return Status::InvalidArgument();
+          }
+        }
+        continue;
+      }
+
+      if (in_object) {
+        std::string_view key;
+        PW_TRY(ParseString(key));
+        PW_TRY(handler_.OnKey(key));
+        SkipWhitespace();
+        if (!Consume(':')) {
+          return Status::InvalidArgument();
+        }
+        SkipWhitespace();
+      }
+
+      // Parse the element. Nested containers push a level and continue the
+      // outer loop; scalars are handled inline.
+      if (!json_.empty() && (json_.front() == '{' || json_.front() == '[')) {
+        const bool nested_object = json_.front() == '{';
+        PW_TRY(Push(nested_object));
+        json_.remove_prefix(1);
+        continue;
+      }
+      PW_TRY(ParseValue());
+      SkipWhitespace();
+      if (!json_.empty() && json_.front() == ',') {
+        json_.remove_prefix(1);
+        SkipWhitespace();
+        if (!json_.empty() && (json_.front() == '}' || json_.front() == ']')) {
+          return Status::InvalidArgument();
+        }
+      } else if (json_.empty() ||
+                 (json_.front() != '}' && json_.front() != ']')) {
+        return Status::InvalidArgument();
+      }
+    }
+    return OkStatus();
+  }
+
+  Status Push(bool is_object) {
+    if (depth_ == kMaxDepth) {
+      return Status::ResourceExhausted();
+    }
+    if (is_object) {
+      container_bits_ |= uint64_t{1} << depth_;
+    } else {
+      container_bits_ &= ~(uint64_t{1} << depth_);
+    }
+    ++depth_;
+    return is_object ? handler_.OnObjectBegin() : handler_.OnArrayBegin();
+  }
+
+  // Parses a quoted string, setting `contents` to the raw characters between
+  // the quotes without decoding escapes.
+  Status ParseString(std::string_view& contents) {
+    if (!Consume('"')) {
+      return Status::InvalidArgument();
+    }
+    size_t i = 0;
+    while (i < json_.size() && json_[i] != '"') {
+      if (json_[i] == '\\') {
+        ++i;  // Skip the escaped character, including \".
+      }
+      ++i;
+    }
+    if (i >= json_.size()) {
+      return Status::InvalidArgument();  // Unterminated string.
+    }
+    contents = json_.substr(0, i);
+    json_.remove_prefix(i + 1);
+    return OkStatus();
+  }
+
+  Status ParseNumber() {
+    size_t i = 0;
+    bool has_digit = false;
+    while (i < json_.size()) {
+      const char c = json_[i];
+      if (c >= '0' && c <= '9') {
+        has_digit = true;
+      } else if (c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+        break;
+      }
+      ++i;
+    }
+    if (!has_digit) {
+      return Status::InvalidArgument();
+    }
+    const std::string_view token = json_.substr(0, i);
+    json_.remove_prefix(i);
+    return handler_.OnNumber(token);
+  }
+
+  bool ParseLiteral(std::string_view literal) {
+    if (json_.substr(0, literal.size()) != literal) {
+      return false;
+    }
+    json_.remove_prefix(literal.size());
+    return true;
+  }
+
+  std::string_view json_;
+  JsonHandler& handler_;
+  uint64_t container_bits_ = 0;
+  size_t depth_ = 0;
+};
+
+}  // namespace
+
+Status Parse(std::string_view json, JsonHandler& handler) {
+  return Parser(json, handler).Run();
+}
+
+}  // namespace pw::json
@@ -0,0 +1,117 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_json/parser.h"
+
+#include "pw_string/string_builder.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::json {
+namespace {
+
+// Records events as a compact trace string for easy comparison.
+class TracingHandler : public JsonHandler {
+ public:
+  const char* trace() const { return trace_.c_str(); }
+
+ private:
+  Status OnObjectBegin() override { return Append("{"); }
+  Status OnObjectEnd() override { return Append("}"); }
+  Status OnArrayBegin() override { return Append("["); }
+  Status OnArrayEnd() override { return Append("]"); }
+  Status OnKey(std::string_view key) override {
+    trace_ << 'K' << key << ';';
+    return OkStatus();
+  }
+  Status OnString(std::string_view value) override {
+    trace_ << 'S' << value << ';';
+    return OkStatus();
+  }
+  Status OnNumber(std::string_view token) override {
+    trace_ << 'N' << token << ';';
+    return OkStatus();
+  }
+  Status OnBool(bool value) override {
+    trace_ << (value ? "T;" : "F;");
+    return OkStatus();
+  }
+  Status OnNull() override { return Append("0;"); }
+
+  Status Append(const char* text) {
+    trace_ << text;
+    return OkStatus();
+  }
+
+  StringBuffer<256> trace_;
+};
+
+TEST(JsonParser, ParsesNestedDocument) {
+  TracingHandler handler;
+  ASSERT_EQ(OkStatus(),
+            Parse(R"({"a": 1, "b": [true, null, "x"], "c": {"d": -2.5e3}})",
+                  handler));
+  EXPECT_STREQ(handler.trace(), "{Ka;N1;Kb;[T;0;Sx;]Kc;{Kd;N-2.5e3;}}");
+}
+
+TEST(JsonParser, ParsesScalars) {
+  TracingHandler handler;
+  ASSERT_EQ(OkStatus(), Parse("42", handler));
+  EXPECT_STREQ(handler.trace(), "N42;");
+}
+
+TEST(JsonParser, EmptyContainers) {
+  TracingHandler handler;
+  ASSERT_EQ(OkStatus(), Parse(R"([{}, [], {"k": {}}])", handler));
+  EXPECT_STREQ(handler.trace(), "[{}[]{Kk;{}}]");
+}
+
+TEST(JsonParser, EscapedQuotesStayRaw) {
+  TracingHandler handler;
+  ASSERT_EQ(OkStatus(), Parse(R"({"k": "a\"b\\"})", handler));
+  EXPECT_STREQ(handler.trace(), "{Kk;Sa\\\"b\\\\;}");
+}
+
+TEST(JsonParser, RejectsMalformedDocuments) {
+  TracingHandler handler;
+  EXPECT_EQ(Status::InvalidArgument(), Parse("", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("{", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("[1,]", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("{\"a\" 1}", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("[1] extra", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("[[] []]", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("[{} 1]", handler));
+  EXPECT_EQ(Status::InvalidArgument(), Parse("\"unterminated", handler));
+}
+
+TEST(JsonParser, HandlerStatusAbortsParsing) {
+  class AbortingHandler : public JsonHandler {
+    Status OnNumber(std::string_view) override {
+      return Status::Cancelled();
+    }
+  };
+  AbortingHandler handler;
+  EXPECT_EQ(Status::Cancelled(), Parse("[1, 2]", handler));
+}
+
+TEST(JsonParser, RejectsExcessiveNesting) {
+  TracingHandler handler;
+  StringBuffer<160> deep;
+  for (int i = 0; i < 70; ++i) {
+    deep << '[';
+  }
+  EXPECT_EQ(Status::ResourceExhausted(), Parse(deep.view(), handler));
+}
+
+}  // namespace
+}  // namespace pw::json
@@ -0,0 +1,78 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_json/parser.h
+///
+/// Streaming, SAX-style JSON parsing. `pw::json::Parse` walks a JSON document
+/// and invokes a `JsonHandler` callback for each structural element and
+/// value, without allocating or building a document tree. This is the parsing
+/// companion to `pw_json/builder.h`.
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "pw_status/status.h"
+
+namespace pw::json {
+
+/// Receives events from `pw::json::Parse`. Callback implementations return a
+/// non-OK status to abort parsing; the status is returned from `Parse`.
+class JsonHandler {
+ public:
+  virtual ~JsonHandler() = default;
+
+  virtual Status OnObjectBegin() { return OkStatus(); }
+  virtual Status OnObjectEnd() { return OkStatus(); }
+  virtual Status OnArrayBegin() { return OkStatus(); }
+  virtual Status OnArrayEnd() { return OkStatus(); }
+
+  /// Called with each object key, before the corresponding value's event.
+  virtual Status OnKey(std::string_view) { return OkStatus(); }
+
+  /// Called with a string value. The view refers to the raw characters
+  /// between the quotes; escape sequences are NOT decoded, so the handler
+  /// sees e.g. `\n` as two characters.
+  virtual Status OnString(std::string_view) { return OkStatus(); }
+
+  /// Called with a number value as its raw token (e.g. "-12.5e3"). Handlers
+  /// parse it with the integer or float parser appropriate for the field.
+  virtual Status OnNumber(std::string_view) { return OkStatus(); }
+
+  virtual Status OnBool(bool) { return OkStatus(); }
+  virtual Status OnNull() { return OkStatus(); }
+};
+
+/// Parses a complete JSON document, invoking `handler` for each element.
+///
+/// The parser is allocation-free: nesting state is kept in a fixed bitstack,
+/// so documents may nest at most 64 levels deep.
+///
+/// @returns @rst
+///
+/// .. pw-status-codes::
+///
+///    OK: The document was parsed successfully.
+///
+///    INVALID_ARGUMENT: The input is not valid JSON.
+///
+///    RESOURCE_EXHAUSTED: The document nests more than 64 levels deep.
+///
+/// Any non-OK status returned by a handler callback is passed through.
+///
+/// @endrst
+Status Parse(std::string_view json, JsonHandler& handler);
+
+}  // namespace pw::json
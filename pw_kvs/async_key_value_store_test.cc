@@ -0,0 +1,166 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_kvs/async_key_value_store.h"
+
+#include <cstring>
+
+#include "pw_async2/dispatcher.h"
+#include "pw_kvs/fake_flash_memory.h"
+#include "pw_kvs/flash_memory.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::kvs {
+namespace {
+
+using ::pw::async2::Context;
+using ::pw::async2::Dispatcher;
+using ::pw::async2::Pending;
+using ::pw::async2::Poll;
+using ::pw::async2::Ready;
+using ::pw::async2::Task;
+
+class AsyncKvsTest : public ::testing::Test {
+ protected:
+  static constexpr EntryFormat kFormat{.magic = 0x731fabcd,
+                                       .checksum = nullptr};
+
+  AsyncKvsTest()
+      : flash_(16), partition_(&flash_), kvs_(&partition_, kFormat),
+        async_kvs_(kvs_) {
+    kvs_.Init();
+  }
+
+  FakeFlashMemoryBuffer<512, 4> flash_;
+  FlashPartition partition_;
+  KeyValueStoreBuffer<8, 4> kvs_;
+  AsyncKeyValueStore<4> async_kvs_;
+};
+
+// Task that drives one future to completion.
+class FutureTask : public Task {
+ public:
+  explicit FutureTask(AsyncKeyValueStore<4>::Future&& future)
+      : future_(std::move(future)) {}
+
+  bool done = false;
+  StatusWithSize result;
+
+ private:
+  Poll<> DoPend(Context& context) override {
+    Poll<StatusWithSize> poll = future_.Pend(context);
+    if (poll.IsPending()) {
+      return Pending();
+    }
+    result = poll.value();
+    done = true;
+    return Ready();
+  }
+
+  AsyncKeyValueStore<4>::Future future_;
+};
+
+TEST_F(AsyncKvsTest, PutThenGetCompletesThroughWorker) {
+  const uint32_t value = 0xfeedbeef;
+  FutureTask put_task(
+      async_kvs_.PendPut("answer", as_bytes(span(&value, 1))));
+
+  Dispatcher dispatcher;
+  dispatcher.Post(put_task);
+
+  // Nothing completes until the worker runs.
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_FALSE(put_task.done);
+
+  EXPECT_EQ(async_kvs_.ProcessPendingOperations(), 1u);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(put_task.done);
+  EXPECT_EQ(put_task.result.status(), OkStatus());
+
+  uint32_t read_back = 0;
+  FutureTask get_task(
+      async_kvs_.PendGet("answer", as_writable_bytes(span(&read_back, 1))));
+  dispatcher.Post(get_task);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(async_kvs_.ProcessPendingOperations(), 1u);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  ASSERT_TRUE(get_task.done);
+  EXPECT_EQ(get_task.result.status(), OkStatus());
+  EXPECT_EQ(get_task.result.size(), sizeof(read_back));
+  EXPECT_EQ(read_back, value);
+}
+
+TEST_F(AsyncKvsTest, DuplicateGetsCoalesceIntoOneRead) {
+  const uint32_t value = 123456;
+  ASSERT_EQ(kvs_.Put("key", value), OkStatus());
+
+  uint32_t out_a = 0;
+  uint32_t out_b = 0;
+  FutureTask task_a(
+      async_kvs_.PendGet("key", as_writable_bytes(span(&out_a, 1))));
+  FutureTask task_b(
+      async_kvs_.PendGet("key", as_writable_bytes(span(&out_b, 1))));
+
+  Dispatcher dispatcher;
+  dispatcher.Post(task_a);
+  dispatcher.Post(task_b);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+
+  // One worker pass serves both queued Gets: the second is satisfied from
+  // the first's read.
+  EXPECT_EQ(async_kvs_.ProcessPendingOperations(1), 1u);
+  EXPECT_EQ(async_kvs_.coalesced_gets(), 1u);
+
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(task_a.done);
+  EXPECT_TRUE(task_b.done);
+  EXPECT_EQ(out_a, value);
+  EXPECT_EQ(out_b, value);
+}
+
+TEST_F(AsyncKvsTest, DeleteCompletesAndRemovesKey) {
+  ASSERT_EQ(kvs_.Put("gone", uint32_t{1}), OkStatus());
+
+  FutureTask task(async_kvs_.PendDelete("gone"));
+  Dispatcher dispatcher;
+  dispatcher.Post(task);
+  EXPECT_FALSE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(async_kvs_.ProcessPendingOperations(), 1u);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_EQ(task.result.status(), OkStatus());
+
+  uint32_t unused = 0;
+  EXPECT_EQ(kvs_.Get("gone", &unused), Status::NotFound());
+}
+
+TEST_F(AsyncKvsTest, FullQueueResolvesResourceExhausted) {
+  // Fill the 4-slot table.
+  [[maybe_unused]] auto f0 = async_kvs_.PendDelete("a");
+  [[maybe_unused]] auto f1 = async_kvs_.PendDelete("b");
+  [[maybe_unused]] auto f2 = async_kvs_.PendDelete("c");
+  [[maybe_unused]] auto f3 = async_kvs_.PendDelete("d");
+
+  FutureTask overflow(async_kvs_.PendDelete("e"));
+  Dispatcher dispatcher;
+  dispatcher.Post(overflow);
+  EXPECT_TRUE(dispatcher.RunUntilStalled().IsReady());
+  EXPECT_TRUE(overflow.done);
+  EXPECT_EQ(overflow.result.status(), Status::ResourceExhausted());
+
+  // Drain the queued operations so their slots are reusable.
+  EXPECT_EQ(async_kvs_.ProcessPendingOperations(), 4u);
+}
+
+}  // namespace
+}  // namespace pw::kvs
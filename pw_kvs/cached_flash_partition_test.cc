@@ -0,0 +1,101 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_kvs/cached_flash_partition.h"
+
+#include <array>
+#include <cstring>
+
+#include "pw_kvs/fake_flash_memory.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::kvs {
+namespace {
+
+// Counts reads that reach the flash.
+class CountingFlash : public FakeFlashMemoryBuffer<128, 4> {
+ public:
+  CountingFlash() : FakeFlashMemoryBuffer(1) {}
+
+  StatusWithSize Read(Address address, span<std::byte> output) override {
+    flash_reads += 1;
+    return FakeFlashMemoryBuffer::Read(address, output);
+  }
+
+  int flash_reads = 0;
+};
+
+class CachedFlashPartitionTest : public ::testing::Test {
+ protected:
+  CachedFlashPartitionTest() : partition_(&flash_) {
+    EXPECT_EQ(OkStatus(), partition_.Erase(0, 4));
+    std::array<std::byte, 128> data;
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = std::byte(i);
+    }
+    EXPECT_EQ(OkStatus(), partition_.Write(0, data).status());
+    flash_.flash_reads = 0;
+  }
+
+  CountingFlash flash_;
+  CachedFlashPartition<2, 32> partition_;
+};
+
+TEST_F(CachedFlashPartitionTest, SmallReadsHitCache) {
+  std::byte buffer[8];
+  // Eight 8-byte reads over one 32-byte line cost one flash read.
+  for (int pass = 0; pass < 2; ++pass) {
+    for (FlashPartition::Address address = 0; address < 32; address += 8) {
+      ASSERT_EQ(partition_.Read(address, buffer).status(), OkStatus());
+      EXPECT_EQ(buffer[0], std::byte(address));
+    }
+  }
+  EXPECT_EQ(flash_.flash_reads, 1);
+}
+
+TEST_F(CachedFlashPartitionTest, ReadsSpanningLines) {
+  std::byte buffer[16];
+  ASSERT_EQ(partition_.Read(24, buffer).status(), OkStatus());  // Lines 0+1.
+  EXPECT_EQ(buffer[0], std::byte(24));
+  EXPECT_EQ(buffer[15], std::byte(39));
+  EXPECT_EQ(flash_.flash_reads, 2);
+}
+
+TEST_F(CachedFlashPartitionTest, WritesInvalidateOverlappingLines) {
+  std::byte buffer[4];
+  ASSERT_EQ(partition_.Read(0, buffer).status(), OkStatus());
+  EXPECT_EQ(flash_.flash_reads, 1);
+
+  // Overwrite the cached range (fake flash requires erase first).
+  ASSERT_EQ(partition_.Erase(0, 1), OkStatus());
+  std::array<std::byte, 4> new_data = {
+      std::byte{9}, std::byte{9}, std::byte{9}, std::byte{9}};
+  ASSERT_EQ(partition_.Write(0, new_data).status(), OkStatus());
+
+  ASSERT_EQ(partition_.Read(0, buffer).status(), OkStatus());
+  EXPECT_EQ(buffer[0], std::byte{9});  // Fresh data, not stale cache.
+}
+
+TEST_F(CachedFlashPartitionTest, LargeReadsBypassCache) {
+  std::byte buffer[64];
+  ASSERT_EQ(partition_.Read(0, buffer).status(), OkStatus());
+  EXPECT_EQ(flash_.flash_reads, 1);
+  // Bypassed reads do not populate the cache.
+  std::byte small[4];
+  ASSERT_EQ(partition_.Read(0, small).status(), OkStatus());
+  EXPECT_EQ(flash_.flash_reads, 2);
+}
+
+}  // namespace
+}  // namespace pw::kvs
@@ -69,6 +69,10 @@ StatusWithSize EntryCache::Find(FlashPartition& partition,
   Entry::KeyBuffer key_buffer;
   bool error_detected = false;
 
+  if (!BloomMayContain(hash)) {
+    return StatusWithSize::NotFound();
+  }
+
   for (size_t i = 0; i < descriptors_.size(); ++i) {
     if (descriptors_[i].key_hash == hash) {
       bool key_found = false;
@@ -97,7 +101,7 @@ StatusWithSize EntryCache::Find(FlashPartition& partition,
           PW_LOG_WARN(
               "   Found corrupt entry, invalidating this copy of the key");
           error_detected = true;
-          sectors.FromAddress(address).mark_corrupt();
+          sectors.MarkCorrupt(sectors.FromAddress(address));
         }
       }
       size_t error_val = error_detected ? 1 : 0;
@@ -123,6 +127,7 @@ EntryMetadata EntryCache::AddNew(const KeyDescriptor& descriptor,
   // TODO(hepler): DCHECK(!full());
   Address* first_address = ResetAddresses(descriptors_.size(), address);
   descriptors_.push_back(descriptor);
+  BloomInsert(descriptor.key_hash);
   return EntryMetadata(descriptors_.back(), span(first_address, 1));
 }
 
@@ -220,6 +225,9 @@ size_t EntryCache::present_entries() const {
 }
 
 int EntryCache::FindIndex(uint32_t key_hash) const {
+  if (!BloomMayContain(key_hash)) {
+    return -1;
+  }
   for (size_t i = 0; i < descriptors_.size(); ++i) {
     if (descriptors_[i].key_hash == key_hash) {
       return i;
@@ -166,6 +166,39 @@ TEST_F(EmptyEntryCache, AddNewOrUpdateExisting_AddDuplicateEntryInSameSector) {
   }
 }
 
+TEST_F(EmptyEntryCache, BloomFilter_NoFalseNegatives) {
+  // Fill the cache with distinct hashes; the Bloom filter must never hide an
+  // existing hash, so updating each entry must find it rather than add a
+  // duplicate.
+  for (uint32_t i = 0; i < kMaxEntries; ++i) {
+    ASSERT_EQ(
+        OkStatus(),
+        entries_.AddNewOrUpdateExisting(
+            {i * uint32_t{0x9e3779b9}, i, EntryState::kValid}, i, 1));
+  }
+  ASSERT_EQ(kMaxEntries, entries_.total_entries());
+
+  for (uint32_t i = 0; i < kMaxEntries; ++i) {
+    ASSERT_EQ(OkStatus(),
+              entries_.AddNewOrUpdateExisting(
+                  {i * uint32_t{0x9e3779b9}, 1000 + i, EntryState::kValid},
+                  1000 + i,
+                  1));
+  }
+  EXPECT_EQ(kMaxEntries, entries_.total_entries());
+}
+
+TEST_F(EmptyEntryCache, Reset_ClearsBloomFilter) {
+  entries_.AddNew(kDescriptor, 5);
+  entries_.Reset();
+
+  // After Reset the filter is rebuilt from scratch, so re-adding the same
+  // descriptor must behave as a fresh entry.
+  EXPECT_EQ(0u, entries_.total_entries());
+  entries_.AddNew(kDescriptor, 5);
+  EXPECT_EQ(1u, entries_.total_entries());
+}
+
 TEST_F(EmptyEntryCache, Iterator_MutableFromConst_CanModify) {
   entries_.AddNew(kDescriptor, 1);
   EntryCache::iterator it = static_cast<const EntryCache&>(entries_).begin();
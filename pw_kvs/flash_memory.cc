@@ -22,6 +22,7 @@
 #include <cstring>
 
 #include "pw_assert/check.h"
+#include "pw_checksum/crc32.h"
 #include "pw_kvs_private/config.h"
 #include "pw_log/log.h"
 #include "pw_status/status_with_size.h"
@@ -127,6 +128,39 @@ StatusWithSize FlashPartition::Write(Address address, span<const byte> data) {
   return flash_.Write(PartitionToFlashAddress(address), data);
 }
 
+StatusWithSize FlashPartition::WriteVerified(Address address,
+                                             span<const byte> data) {
+  const uint32_t expected_crc = checksum::Crc32::Calculate(data);
+  const StatusWithSize result = Write(address, data);
+  PW_TRY_WITH_SIZE(result.status());
+  PW_TRY_WITH_SIZE(VerifyWrittenRange(address, data.size(), expected_crc));
+  return result;
+}
+
+Status FlashPartition::VerifyWrittenRange(Address address,
+                                          size_t size,
+                                          uint32_t expected_crc32) {
+  checksum::Crc32 crc;
+  byte buffer[64];
+  size_t remaining = size;
+  Address read_address = address;
+  while (remaining > 0) {
+    const size_t chunk = std::min(remaining, sizeof(buffer));
+    const StatusWithSize read_result =
+        Read(read_address, span(buffer).first(chunk));
+    PW_TRY(read_result.status());
+    crc.Update(span<const byte>(buffer, read_result.size()));
+    read_address += read_result.size();
+    remaining -= read_result.size();
+  }
+  if (crc.value() != expected_crc32) {
+    PW_LOG_ERROR("Write verification failed at address %#x; CRC mismatch",
+                 unsigned(address));
+    return Status::DataLoss();
+  }
+  return OkStatus();
+}
+
 Status FlashPartition::IsRegionErased(Address source_flash_address,
                                       size_t length,
                                       bool* is_erased) {
@@ -13,7 +13,9 @@
 // the License.
 
 #include <algorithm>
+#include <cstring>
 
+#include "pw_kvs/fake_flash_memory.h"
 #include "pw_kvs/flash_memory.h"
 #include "pw_kvs/flash_test_partition.h"
 #include "pw_kvs_private/config.h"
@@ -114,6 +116,26 @@ void WriteData(FlashPartition& partition, uint8_t fill_byte) {
   }
 }
 
+TEST(FlashPartitionAsync, HooksDefaultToSynchronous) {
+  FakeFlashMemoryBuffer<128, 2> async_flash(16);
+  FlashPartition async_partition(&async_flash);
+  ASSERT_EQ(OkStatus(), async_partition.Erase());
+
+  EXPECT_FALSE(async_partition.supports_async_write());
+  EXPECT_FALSE(async_partition.supports_async_read());
+
+  // The default StartWrite/StartRead complete synchronously.
+  std::byte data[16];
+  std::memset(data, 1, sizeof(data));
+  ASSERT_EQ(async_partition.StartWrite(0, data).status(), OkStatus());
+  ASSERT_EQ(async_partition.AwaitWriteCompletion(), OkStatus());
+
+  std::byte read_back[16] = {};
+  ASSERT_EQ(async_partition.StartRead(0, read_back).status(), OkStatus());
+  ASSERT_EQ(async_partition.AwaitReadCompletion(), OkStatus());
+  EXPECT_EQ(std::memcmp(data, read_back, sizeof(data)), 0);
+}
+
 TEST(FlashPartitionTest, FillTest) {
   FlashPartition& test_partition = FlashTestPartition();
 
@@ -134,6 +156,37 @@ TEST(FlashPartitionTest, FillTest) {
   }
 }
 
+TEST(FlashPartitionTest, WriteVerifiedDetectsCleanWrite) {
+  FlashPartition& test_partition = FlashTestPartition();
+  ASSERT_EQ(OkStatus(), test_partition.Erase(0, 1));
+
+  uint8_t test_data[kMaxFlashAlignment];
+  memset(test_data, 0xc3, sizeof(test_data));
+  const size_t block_size =
+      std::min(sizeof(test_data), test_partition.sector_size_bytes());
+
+  const StatusWithSize result =
+      test_partition.WriteVerified(0, as_bytes(span(test_data, block_size)));
+  ASSERT_EQ(result.status(), OkStatus());
+  EXPECT_EQ(result.size(), block_size);
+}
+
+TEST(FlashPartitionTest, VerifyWrittenRangeRejectsWrongCrc) {
+  FlashPartition& test_partition = FlashTestPartition();
+  ASSERT_EQ(OkStatus(), test_partition.Erase(0, 1));
+
+  uint8_t test_data[kMaxFlashAlignment];
+  memset(test_data, 0x96, sizeof(test_data));
+  const size_t block_size =
+      std::min(sizeof(test_data), test_partition.sector_size_bytes());
+  ASSERT_EQ(
+      test_partition.Write(0, as_bytes(span(test_data, block_size))).status(),
+      OkStatus());
+
+  EXPECT_EQ(test_partition.VerifyWrittenRange(0, block_size, 0xBADBADBA),
+            Status::DataLoss());
+}
+
 TEST(FlashPartitionTest, EraseTest) {
   FlashPartition& test_partition = FlashTestPartition();
 
@@ -20,9 +20,11 @@
 #include <algorithm>
 #include <cinttypes>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 #include "pw_assert/check.h"
+#include "pw_checksum/crc16_ccitt.h"
 #include "pw_kvs_private/config.h"
 #include "pw_log/log.h"
 #include "pw_status/try.h"
@@ -54,11 +56,231 @@ KeyValueStore::KeyValueStore(FlashPartition* partition,
       initialized_(InitializationState::kNotInitialized),
       error_detected_(false),
       internal_stats_({}),
+      incremental_gc_sector_(nullptr),
       last_transaction_id_(0) {}
 
+namespace {
+
+// Serialized index cache layout (all fields little-endian, packed):
+//   IndexCacheHeader, then sector_count of IndexCacheSector, then entry_count
+//   of IndexCacheEntry records (each followed by its addresses).
+struct IndexCacheHeader {
+  uint32_t magic;
+  uint32_t checksum;  // CRC-16 of everything after this header, zero-padded.
+  uint32_t sector_count;
+  uint32_t sector_size_bytes;
+  uint32_t redundancy;
+  uint32_t last_transaction_id;
+  uint32_t last_new_sector;
+  uint32_t entry_count;
+};
+
+struct IndexCacheSector {
+  uint16_t writable_bytes;
+  uint16_t valid_bytes;
+  uint8_t corrupt;
+};
+
+struct IndexCacheEntry {
+  uint32_t key_hash;
+  uint32_t transaction_id;
+  uint8_t state;
+  uint8_t num_addresses;
+};
+
+constexpr uint32_t kIndexCacheMagic = 0x73764b50;  // "PKvs"
+
+uint32_t IndexCacheChecksum(ConstByteSpan payload) {
+  return checksum::Crc16Ccitt::Calculate(payload);
+}
+
+}  // namespace
+
+StatusWithSize KeyValueStore::SaveIndexCache(ByteSpan buffer) const {
+  if (initialized_ != InitializationState::kReady) {
+    return StatusWithSize::FailedPrecondition();
+  }
+
+  size_t offset = sizeof(IndexCacheHeader);
+  const auto append = [&](const void* data, size_t size) {
+    if (offset + size <= buffer.size()) {
+      std::memcpy(buffer.data() + offset, data, size);
+    }
+    offset += size;
+  };
+
+  for (const SectorDescriptor& sector : sectors_) {
+    const IndexCacheSector sector_record = {
+        .writable_bytes = static_cast<uint16_t>(sector.writable_bytes()),
+        .valid_bytes = static_cast<uint16_t>(sector.valid_bytes()),
+        .corrupt = sector.corrupt() ? uint8_t{1} : uint8_t{0},
+    };
+    append(&sector_record, sizeof(sector_record));
+  }
+
+  uint32_t entry_count = 0;
+  for (const EntryMetadata& metadata : entry_cache_) {
+    const IndexCacheEntry entry_record = {
+        .key_hash = metadata.hash(),
+        .transaction_id = metadata.transaction_id(),
+        .state = static_cast<uint8_t>(metadata.state()),
+        .num_addresses = static_cast<uint8_t>(metadata.addresses().size()),
+    };
+    append(&entry_record, sizeof(entry_record));
+    for (Address address : metadata.addresses()) {
+      const uint32_t address_32 = address;
+      append(&address_32, sizeof(address_32));
+    }
+    entry_count += 1;
+  }
+
+  if (offset > buffer.size()) {
+    return StatusWithSize::ResourceExhausted();
+  }
+
+  const IndexCacheHeader header = {
+      .magic = kIndexCacheMagic,
+      .checksum = IndexCacheChecksum(
+          buffer.subspan(sizeof(IndexCacheHeader),
+                         offset - sizeof(IndexCacheHeader))),
+      .sector_count = static_cast<uint32_t>(sectors_.size()),
+      .sector_size_bytes =
+          static_cast<uint32_t>(partition_.sector_size_bytes()),
+      .redundancy = static_cast<uint32_t>(entry_cache_.redundancy()),
+      .last_transaction_id = last_transaction_id_,
+      .last_new_sector = sectors_.Index(sectors_.last_new()),
+      .entry_count = entry_count,
+  };
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  return StatusWithSize(offset);
+}
+
+Status KeyValueStore::InitFromIndexCache(ConstByteSpan cache) {
+  if (cache.size() < sizeof(IndexCacheHeader)) {
+    return Status::DataLoss();
+  }
+  IndexCacheHeader header;
+  std::memcpy(&header, cache.data(), sizeof(header));
+  if (header.magic != kIndexCacheMagic ||
+      header.sector_count != partition_.sector_count() ||
+      header.sector_size_bytes != partition_.sector_size_bytes() ||
+      header.redundancy != entry_cache_.redundancy() ||
+      header.entry_count > entry_cache_.max_entries()) {
+    return Status::DataLoss();
+  }
+  if (IndexCacheChecksum(cache.subspan(sizeof(header))) != header.checksum) {
+    return Status::DataLoss();
+  }
+
+  initialized_ = InitializationState::kNotInitialized;
+  error_detected_ = false;
+  incremental_gc_sector_ = nullptr;
+  entry_cache_.Reset();
+  sectors_.Reset();
+
+  size_t offset = sizeof(IndexCacheHeader);
+  const auto read_record = [&](void* out, size_t size) {
+    if (offset + size > cache.size()) {
+      return false;
+    }
+    std::memcpy(out, cache.data() + offset, size);
+    offset += size;
+    return true;
+  };
+
+  for (SectorDescriptor& sector : sectors_) {
+    IndexCacheSector sector_record;
+    if (!read_record(&sector_record, sizeof(sector_record))) {
+      return Status::DataLoss();
+    }
+    if (sector_record.corrupt != 0) {
+      sectors_.MarkCorrupt(sector);
+    } else {
+      sectors_.SetWritableBytes(sector, sector_record.writable_bytes);
+    }
+    sector.AddValidBytes(sector_record.valid_bytes);
+  }
+
+  for (uint32_t i = 0; i < header.entry_count; ++i) {
+    IndexCacheEntry entry_record;
+    if (!read_record(&entry_record, sizeof(entry_record)) ||
+        entry_record.num_addresses == 0 ||
+        entry_record.num_addresses > entry_cache_.redundancy()) {
+      return Status::DataLoss();
+    }
+
+    uint32_t first_address;
+    if (!read_record(&first_address, sizeof(first_address))) {
+      return Status::DataLoss();
+    }
+    EntryMetadata metadata = entry_cache_.AddNew(
+        KeyDescriptor{
+            .key_hash = entry_record.key_hash,
+            .transaction_id = entry_record.transaction_id,
+            .state = static_cast<EntryState>(entry_record.state),
+        },
+        first_address);
+    for (uint8_t address_index = 1; address_index < entry_record.num_addresses;
+         ++address_index) {
+      uint32_t address;
+      if (!read_record(&address, sizeof(address))) {
+        return Status::DataLoss();
+      }
+      metadata.AddNewAddress(address);
+    }
+
+    // Verify the cache against flash with a single header read per entry;
+    // any mismatch means the cache is stale.
+    Entry entry;
+    if (!Entry::Read(partition_, metadata.first_address(), formats_, &entry)
+             .ok() ||
+        entry.transaction_id() != entry_record.transaction_id) {
+      entry_cache_.Reset();
+      sectors_.Reset();
+      return Status::DataLoss();
+    }
+  }
+
+  // Detect entries appended after the cache was saved: the bytes at each
+  // sector's cached write position must still be erased. One bounded read per
+  // sector.
+  for (SectorDescriptor& sector : sectors_) {
+    if (sector.corrupt() || sector.writable_bytes() == 0) {
+      continue;
+    }
+    const size_t probe_size =
+        std::min<size_t>(sector.writable_bytes(), partition_.alignment_bytes());
+    bool is_erased = false;
+    if (!partition_
+             .IsRegionErased(
+                 sectors_.NextWritableAddress(sector), probe_size, &is_erased)
+             .ok() ||
+        !is_erased) {
+      entry_cache_.Reset();
+      sectors_.Reset();
+      return Status::DataLoss();
+    }
+  }
+
+  last_transaction_id_ = header.last_transaction_id;
+  if (header.last_new_sector >= sectors_.size()) {
+    entry_cache_.Reset();
+    sectors_.Reset();
+    return Status::DataLoss();
+  }
+  sectors_.set_last_new_sector(header.last_new_sector *
+                               partition_.sector_size_bytes());
+
+  initialized_ = InitializationState::kReady;
+  PW_LOG_INFO("KeyValueStore init from index cache: %u entries",
+              unsigned(header.entry_count));
+  return OkStatus();
+}
+
 Status KeyValueStore::Init() {
   initialized_ = InitializationState::kNotInitialized;
   error_detected_ = false;
+  incremental_gc_sector_ = nullptr;
   last_transaction_id_ = 0;
 
   PW_LOG_INFO("Initializing key value store");
@@ -206,8 +428,8 @@ Status KeyValueStore::InitializeMetadata() {
       entry_address = next_entry_address;
 
       // Update of the number of writable bytes in this sector.
-      sector.set_writable_bytes(sector_size_bytes -
-                                (entry_address - sector_address));
+      sectors_.SetWritableBytes(
+          sector, sector_size_bytes - (entry_address - sector_address));
     }
 
     if (sector_corrupt_bytes > 0) {
@@ -215,7 +437,7 @@ Status KeyValueStore::InitializeMetadata() {
       // being written to it by indicating that it has no space. This should
       // also make it a decent GC candidate. Valid keys in the sector are still
       // readable as normal.
-      sector.mark_corrupt();
+      sectors_.MarkCorrupt(sector);
       error_detected_ = true;
 
       PW_LOG_WARN("Sector %u contains %uB of corrupt data",
@@ -261,7 +483,7 @@ Status KeyValueStore::InitializeMetadata() {
         corrupt_entries++;
         total_corrupt_bytes += sector.writable_bytes();
         error_detected_ = true;
-        sector.mark_corrupt();
+        sectors_.MarkCorrupt(sector);
 
         // Remove the bad address and stay at this index. The removal
         // replaces out the removed address with the back address so
@@ -455,6 +677,30 @@ StatusWithSize KeyValueStore::Get(std::string_view key,
   return Get(key, metadata, value_buffer, offset_bytes);
 }
 
+Status KeyValueStore::GetPointer(std::string_view key,
+                                 span<const byte>* value) const {
+  PW_TRY(CheckReadOperation(key));
+
+  EntryMetadata metadata;
+  PW_TRY(FindExisting(key, &metadata));
+
+  Entry entry;
+  PW_TRY(ReadEntry(metadata, entry));
+
+  // The value is stored in flash immediately after the header and key.
+  const byte* mcu_address = partition_.PartitionAddressToMcuAddress(
+      entry.address() + Entry::entry_overhead() + entry.key_length());
+  if (mcu_address == nullptr) {
+    return Status::Unimplemented();  // Flash is not memory mapped.
+  }
+
+  // Verify the whole entry from flash before handing out a pointer to it.
+  PW_TRY(entry.VerifyChecksumInFlash());
+
+  *value = span(mcu_address, entry.value_size());
+  return OkStatus();
+}
+
 Status KeyValueStore::PutBytes(std::string_view key, span<const byte> value) {
   PW_TRY(CheckWriteOperation(key));
   PW_LOG_DEBUG("Writing key/value; key length=%u, value length=%u",
@@ -501,6 +747,102 @@ Status KeyValueStore::Delete(std::string_view key) {
   return WriteEntryForExistingKey(metadata, EntryState::kDeleted, key, {});
 }
 
+namespace {
+
+// Transaction staging record layout: [op:1][key_size:1][value_size:2(LE)]
+// followed by the key and value bytes.
+constexpr size_t kTransactionRecordHeaderSize = 4;
+
+}  // namespace
+
+Status KeyValueStore::Transaction::Stage(std::string_view key,
+                                         span<const byte> value,
+                                         OpType op) {
+  if (InvalidKey(key) ||
+      value.size() > std::numeric_limits<uint16_t>::max()) {
+    return Status::InvalidArgument();
+  }
+
+  const size_t record_size =
+      kTransactionRecordHeaderSize + key.size() + value.size();
+  if (buffer_.size() - staged_bytes_ < record_size) {
+    return Status::ResourceExhausted();
+  }
+
+  byte* record = buffer_.data() + staged_bytes_;
+  record[0] = static_cast<byte>(op);
+  record[1] = static_cast<byte>(key.size());
+  const uint16_t value_size = static_cast<uint16_t>(value.size());
+  std::memcpy(&record[2], &value_size, sizeof(value_size));
+  std::memcpy(&record[kTransactionRecordHeaderSize], key.data(), key.size());
+  if (!value.empty()) {
+    std::memcpy(&record[kTransactionRecordHeaderSize + key.size()],
+                value.data(),
+                value.size());
+  }
+  staged_bytes_ += record_size;
+  return OkStatus();
+}
+
+Status KeyValueStore::Transaction::Commit() {
+  struct Record {
+    OpType op;
+    std::string_view key;
+    span<const byte> value;
+    size_t next_offset;
+  };
+
+  auto read_record = [this](size_t offset) {
+    const byte* record = buffer_.data() + offset;
+    const size_t key_size = static_cast<size_t>(record[1]);
+    uint16_t value_size;
+    std::memcpy(&value_size, &record[2], sizeof(value_size));
+    const char* key = reinterpret_cast<const char*>(
+        &record[kTransactionRecordHeaderSize]);
+    return Record{
+        .op = static_cast<OpType>(record[0]),
+        .key = std::string_view(key, key_size),
+        .value = span(&record[kTransactionRecordHeaderSize + key_size],
+                      value_size),
+        .next_offset =
+            offset + kTransactionRecordHeaderSize + key_size + value_size,
+    };
+  };
+
+  for (size_t offset = 0; offset < staged_bytes_;) {
+    const Record record = read_record(offset);
+    offset = record.next_offset;
+
+    // If a later staged operation supersedes this one, skip it so each key is
+    // written to flash at most once per commit.
+    bool superseded = false;
+    for (size_t later = offset; later < staged_bytes_;) {
+      const Record later_record = read_record(later);
+      later = later_record.next_offset;
+      if (later_record.key == record.key) {
+        superseded = true;
+        break;
+      }
+    }
+    if (superseded) {
+      continue;
+    }
+
+    if (record.op == OpType::kPut) {
+      PW_TRY(kvs_.PutBytes(record.key, record.value));
+    } else {
+      Status status = kvs_.Delete(record.key);
+      // Deleting a key that was never written is a no-op for the batch.
+      if (!status.ok() && !status.IsNotFound()) {
+        return status;
+      }
+    }
+  }
+
+  staged_bytes_ = 0;
+  return OkStatus();
+}
+
 void KeyValueStore::Item::ReadKey() {
   key_buffer_.fill('\0');
 
@@ -550,7 +892,7 @@ Status KeyValueStore::ReadEntry(const EntryMetadata& metadata,
 
     // Found a bad address. Set the sector as corrupt.
     error_detected_ = true;
-    sectors_.FromAddress(address).mark_corrupt();
+    sectors_.MarkCorrupt(sectors_.FromAddress(address));
   }
 
   PW_LOG_ERROR("No valid entries for key. Data has been lost!");
@@ -849,7 +1191,7 @@ Status KeyValueStore::MarkSectorCorruptIfNotOk(Status status,
                                                SectorDescriptor* sector) {
   if (!status.ok()) {
     PW_LOG_DEBUG("  Sector %u corrupt", sectors_.Index(sector));
-    sector->mark_corrupt();
+    sectors_.MarkCorrupt(*sector);
     error_detected_ = true;
   }
   return status;
@@ -874,7 +1216,7 @@ Status KeyValueStore::AppendEntry(const Entry& entry,
     PW_TRY(MarkSectorCorruptIfNotOk(entry.VerifyChecksumInFlash(), &sector));
   }
 
-  sector.RemoveWritableBytes(result.size());
+  sectors_.RemoveWritableBytes(sector, result.size());
   sector.AddValidBytes(result.size());
   return OkStatus();
 }
@@ -898,7 +1240,7 @@ StatusWithSize KeyValueStore::CopyEntryToSector(Entry& entry,
   }
   // Entry was written successfully; update descriptor's address and the sector
   // descriptors to reflect the new entry.
-  new_sector->RemoveWritableBytes(result.size());
+  sectors_.RemoveWritableBytes(*new_sector, result.size());
   new_sector->AddValidBytes(result.size());
 
   return result;
@@ -1033,6 +1375,57 @@ Status KeyValueStore::PartialMaintenance() {
   return GarbageCollect(span<const Address>());
 }
 
+Status KeyValueStore::GarbageCollectChunk(size_t max_relocate_bytes) {
+  if (initialized_ == InitializationState::kNotInitialized) {
+    return Status::FailedPrecondition();
+  }
+
+  CheckForErrors();
+  // Do automatic repair, if KVS options allow for it. Repair may rescan the
+  // sectors, so any in-progress incremental collection is restarted.
+  if (error_detected_ && options_.recovery != ErrorRecovery::kManual) {
+    incremental_gc_sector_ = nullptr;
+    PW_TRY(Repair());
+  }
+
+  // Select a sector to collect if one is not already in progress. Unlike
+  // GarbageCollect(), only collect sectors with reclaimable space; moving
+  // valid-only sectors around (FindSectorToGarbageCollect's last resort for
+  // making space during a Put) is pure wear for a background task and would
+  // keep a drive loop from ever terminating.
+  if (incremental_gc_sector_ == nullptr) {
+    SectorDescriptor* sector_to_gc =
+        sectors_.FindSectorToGarbageCollect(span<const Address>());
+    if (sector_to_gc == nullptr ||
+        sector_to_gc->RecoverableBytes(partition_.sector_size_bytes()) == 0) {
+      return Status::NotFound();
+    }
+    incremental_gc_sector_ = sector_to_gc;
+    PW_LOG_DEBUG("Incremental GC starting sector %u",
+                 sectors_.Index(incremental_gc_sector_));
+  }
+
+  // Relocate valid entries out of the sector until the relocation budget for
+  // this chunk is consumed. Entries already relocated by previous chunks have
+  // no addresses in the sector and are skipped without flash access.
+  const size_t valid_bytes_at_start = incremental_gc_sector_->valid_bytes();
+  if (valid_bytes_at_start != 0) {
+    for (EntryMetadata& metadata : entry_cache_) {
+      if (valid_bytes_at_start - incremental_gc_sector_->valid_bytes() >=
+          max_relocate_bytes) {
+        return OkStatus();  // Chunk budget consumed; more work remains.
+      }
+      PW_TRY(RelocateKeyAddressesInSector(
+          *incremental_gc_sector_, metadata, span<const Address>()));
+    }
+  }
+
+  // All valid entries are relocated; erase the sector to finish.
+  SectorDescriptor* sector_to_gc = incremental_gc_sector_;
+  incremental_gc_sector_ = nullptr;
+  return GarbageCollectSector(*sector_to_gc, span<const Address>());
+}
+
 Status KeyValueStore::GarbageCollect(span<const Address> reserved_addresses) {
   PW_LOG_DEBUG("Garbage Collect a single sector");
   for ([[maybe_unused]] Address address : reserved_addresses) {
@@ -1091,10 +1484,11 @@ Status KeyValueStore::GarbageCollectSector(
 
   // Step 2: Reinitialize the sector
   if (!sector_to_gc.Empty(partition_.sector_size_bytes())) {
-    sector_to_gc.mark_corrupt();
+    sectors_.MarkCorrupt(sector_to_gc);
     internal_stats_.sector_erase_count++;
     PW_TRY(partition_.Erase(sectors_.BaseAddress(sector_to_gc), 1));
-    sector_to_gc.set_writable_bytes(partition_.sector_size_bytes());
+    sectors_.SetWritableBytes(sector_to_gc, partition_.sector_size_bytes());
+    sectors_.RecordErase(sector_to_gc);
   }
 
   PW_LOG_DEBUG("  Garbage Collect sector %u complete",
@@ -381,6 +381,95 @@ TEST_F(LargeEmptyInitializedKvs, Basic) {
   EXPECT_EQ(kvs_.size(), 1u);
 }
 
+TEST_F(LargeEmptyInitializedKvs, IndexCache_RoundTripAndStalenessDetection) {
+  ASSERT_EQ(OkStatus(), kvs_.Put(keys[0], uint32_t(111)));
+  ASSERT_EQ(OkStatus(), kvs_.Put(keys[1], uint32_t(222)));
+
+  std::byte cache[512];
+  StatusWithSize saved = kvs_.SaveIndexCache(cache);
+  ASSERT_EQ(OkStatus(), saved.status());
+
+  // A fresh KVS on the same partition restores from the cache.
+  KeyValueStoreBuffer<kMaxEntries, kMaxUsableSectors> restored(
+      &large_test_partition, default_format);
+  ASSERT_EQ(OkStatus(),
+            restored.InitFromIndexCache(span(cache).first(saved.size())));
+  uint32_t value = 0;
+  ASSERT_EQ(OkStatus(), restored.Get(keys[0], &value));
+  EXPECT_EQ(value, 111u);
+  ASSERT_EQ(OkStatus(), restored.Put(keys[2], uint32_t(333)));
+
+  // The cache is now stale (flash changed); it must be rejected and a full
+  // Init must succeed as the fallback.
+  KeyValueStoreBuffer<kMaxEntries, kMaxUsableSectors> stale(
+      &large_test_partition, default_format);
+  EXPECT_EQ(Status::DataLoss(),
+            stale.InitFromIndexCache(span(cache).first(saved.size())));
+  ASSERT_EQ(OkStatus(), stale.Init());
+  ASSERT_EQ(OkStatus(), stale.Get(keys[2], &value));
+  EXPECT_EQ(value, 333u);
+}
+
+TEST_F(LargeEmptyInitializedKvs, Transaction) {
+  std::byte staging[128];
+  KeyValueStore::Transaction transaction(kvs_, staging);
+
+  const uint32_t kValue1 = 0xbaa5feed;
+  const uint32_t kValue2 = 0x0ca5cade;
+
+  // Stage several operations, including a superseded Put and a Delete;
+  // nothing is written until Commit.
+  ASSERT_EQ(OkStatus(), transaction.Put(keys[0], kValue1));
+  ASSERT_EQ(OkStatus(), transaction.Put(keys[1], kValue1));
+  ASSERT_EQ(OkStatus(), transaction.Put(keys[0], kValue2));
+  ASSERT_EQ(OkStatus(), transaction.Delete(keys[1]));
+  EXPECT_EQ(0u, kvs_.size());
+
+  ASSERT_EQ(OkStatus(), transaction.Commit());
+  EXPECT_EQ(0u, transaction.staged_bytes());
+
+  // Only the last staged operation per key is applied: keys[0] has kValue2
+  // and keys[1] was never written.
+  uint32_t value = 0;
+  ASSERT_EQ(OkStatus(), kvs_.Get(keys[0], &value));
+  EXPECT_EQ(kValue2, value);
+  EXPECT_EQ(Status::NotFound(), kvs_.Get(keys[1], &value));
+  EXPECT_EQ(1u, kvs_.size());
+
+  // A full staging buffer reports RESOURCE_EXHAUSTED; Abort discards.
+  std::byte small_staging[8];
+  KeyValueStore::Transaction small(kvs_, small_staging);
+  EXPECT_EQ(Status::ResourceExhausted(), small.Put(keys[0], kValue1));
+  ASSERT_EQ(OkStatus(), transaction.Put(keys[2], kValue1));
+  transaction.Abort();
+  ASSERT_EQ(OkStatus(), transaction.Commit());
+  EXPECT_EQ(Status::NotFound(), kvs_.Get(keys[2], &value));
+}
+
+TEST_F(LargeEmptyInitializedKvs, GetPointer) {
+  const uint32_t kValue1 = 0xDA1A51DE;
+  const uint32_t kValue2 = 0x0005EC0D;
+  ASSERT_EQ(OkStatus(), kvs_.Put(keys[0], kValue1));
+
+  // FakeFlashMemory is memory mapped, so GetPointer returns a span aliasing
+  // the value bytes in the fake flash.
+  span<const std::byte> value;
+  ASSERT_EQ(OkStatus(), kvs_.GetPointer(keys[0], &value));
+  ASSERT_EQ(sizeof(kValue1), value.size());
+  uint32_t read_value = 0;
+  std::memcpy(&read_value, value.data(), sizeof(read_value));
+  EXPECT_EQ(kValue1, read_value);
+
+  // Overwriting the key moves the entry; a fresh GetPointer sees the new
+  // value.
+  ASSERT_EQ(OkStatus(), kvs_.Put(keys[0], kValue2));
+  ASSERT_EQ(OkStatus(), kvs_.GetPointer(keys[0], &value));
+  std::memcpy(&read_value, value.data(), sizeof(read_value));
+  EXPECT_EQ(kValue2, read_value);
+
+  EXPECT_EQ(Status::NotFound(), kvs_.GetPointer("not-a-key", &value));
+}
+
 TEST_F(LargeEmptyInitializedKvs, FullMaintenance) {
   const uint8_t kValue1 = 0xDA;
   const uint8_t kValue2 = 0x12;
@@ -410,6 +499,44 @@ TEST_F(LargeEmptyInitializedKvs, FullMaintenance) {
   EXPECT_EQ(stats.reclaimable_bytes, 0u);
 }
 
+TEST_F(LargeEmptyInitializedKvs, GarbageCollectChunk) {
+  const uint8_t kValue1 = 0xDA;
+  const uint8_t kValue2 = 0x12;
+
+  // Write several keys to give the garbage collector valid entries to
+  // relocate, then overwrite one key repeatedly to create stale entries.
+  for (size_t i = 0; i < 8; ++i) {
+    ASSERT_EQ(OkStatus(), kvs_.Put(keys[i % 3], kValue1));
+  }
+  ASSERT_EQ(OkStatus(), kvs_.Put(keys[0], kValue2));
+
+  KeyValueStore::StorageStats stats = kvs_.GetStorageStats();
+  EXPECT_GT(stats.reclaimable_bytes, 0u);
+
+  // Drive incremental GC with a small budget until no work remains. Each call
+  // performs a bounded amount of relocation, so multiple calls are required.
+  size_t chunks = 0;
+  Status status;
+  while ((status = kvs_.GarbageCollectChunk(16)).ok()) {
+    ASSERT_LT(chunks++, 100u);
+  }
+  EXPECT_EQ(Status::NotFound(), status);
+  EXPECT_GT(chunks, 1u);
+
+  stats = kvs_.GetStorageStats();
+  EXPECT_EQ(stats.reclaimable_bytes, 0u);
+  EXPECT_GT(stats.sector_erase_count, 0u);
+
+  // All keys remain readable after their entries were relocated.
+  uint8_t value = 0;
+  ASSERT_EQ(OkStatus(), kvs_.Get(keys[0], &value));
+  EXPECT_EQ(kValue2, value);
+  ASSERT_EQ(OkStatus(), kvs_.Get(keys[1], &value));
+  EXPECT_EQ(kValue1, value);
+  ASSERT_EQ(OkStatus(), kvs_.Get(keys[2], &value));
+  EXPECT_EQ(kValue1, value);
+}
+
 TEST_F(LargeEmptyInitializedKvs, KeyDeletionMaintenance) {
   const uint8_t kValue1 = 0xDA;
   const uint8_t kValue2 = 0x12;
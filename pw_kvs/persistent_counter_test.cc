@@ -0,0 +1,111 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_kvs/persistent_counter.h"
+
+#include <cstdint>
+
+#include "pw_kvs/fake_flash_memory.h"
+#include "pw_kvs/flash_memory.h"
+#include "pw_kvs/key_value_store.h"
+#include "pw_persistent_ram/persistent.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::kvs {
+namespace {
+
+class PersistentCounterTest : public ::testing::Test {
+ protected:
+  static constexpr EntryFormat kFormat{.magic = 0x8e1dd3f4,
+                                       .checksum = nullptr};
+
+  PersistentCounterTest()
+      : flash_(16), partition_(&flash_), kvs_(&partition_, kFormat) {
+    kvs_.Init();
+  }
+
+  FakeFlashMemoryBuffer<512, 4> flash_;
+  FlashPartition partition_;
+  KeyValueStoreBuffer<8, 4> kvs_;
+  persistent_ram::Persistent<uint32_t> ram_;
+};
+
+TEST_F(PersistentCounterTest, StartsAtZeroWithNoSources) {
+  PersistentCounter<uint32_t> counter(ram_, kvs_, "counter");
+  ASSERT_EQ(counter.Init(), OkStatus());
+  EXPECT_EQ(counter.value(), 0u);
+  EXPECT_FALSE(counter.dirty());
+}
+
+TEST_F(PersistentCounterTest, IncrementsWithoutFlashWrites) {
+  PersistentCounter<uint32_t> counter(ram_, kvs_, "counter");
+  ASSERT_EQ(counter.Init(), OkStatus());
+
+  counter.Increment();
+  counter.Increment(9);
+  EXPECT_EQ(counter.value(), 10u);
+  EXPECT_TRUE(counter.dirty());
+
+  // Nothing was checkpointed, so the KVS has no entry.
+  uint32_t stored = 0;
+  EXPECT_EQ(kvs_.Get("counter", &stored), Status::NotFound());
+}
+
+TEST_F(PersistentCounterTest, CheckpointWritesOnlyWhenDirty) {
+  PersistentCounter<uint32_t> counter(ram_, kvs_, "counter");
+  ASSERT_EQ(counter.Init(), OkStatus());
+
+  counter.Increment(42);
+  ASSERT_EQ(counter.Checkpoint(), OkStatus());
+  EXPECT_FALSE(counter.dirty());
+
+  uint32_t stored = 0;
+  ASSERT_EQ(kvs_.Get("counter", &stored), OkStatus());
+  EXPECT_EQ(stored, 42u);
+
+  // A clean checkpoint performs no KVS write.
+  const KeyValueStore::StorageStats stats_before = kvs_.GetStorageStats();
+  ASSERT_EQ(counter.Checkpoint(), OkStatus());
+  EXPECT_EQ(kvs_.GetStorageStats().in_use_bytes, stats_before.in_use_bytes);
+}
+
+TEST_F(PersistentCounterTest, WarmRebootKeepsRamValue) {
+  PersistentCounter<uint32_t> counter(ram_, kvs_, "counter");
+  ASSERT_EQ(counter.Init(), OkStatus());
+  counter.Increment(100);
+  ASSERT_EQ(counter.Checkpoint(), OkStatus());
+  counter.Increment(5);  // Advances past the checkpoint; RAM-only.
+
+  // Simulate a warm reboot: the Persistent survives, a new counter wraps it.
+  PersistentCounter<uint32_t> rebooted(ram_, kvs_, "counter");
+  ASSERT_EQ(rebooted.Init(), OkStatus());
+  EXPECT_EQ(rebooted.value(), 105u);  // RAM wins over the stale checkpoint.
+  EXPECT_TRUE(rebooted.dirty());
+}
+
+TEST_F(PersistentCounterTest, ColdBootFallsBackToCheckpoint) {
+  PersistentCounter<uint32_t> counter(ram_, kvs_, "counter");
+  ASSERT_EQ(counter.Init(), OkStatus());
+  counter.Increment(77);
+  ASSERT_EQ(counter.Checkpoint(), OkStatus());
+
+  // Simulate power loss: the RAM copy is gone, the checkpoint remains.
+  ram_.Invalidate();
+  PersistentCounter<uint32_t> rebooted(ram_, kvs_, "counter");
+  ASSERT_EQ(rebooted.Init(), OkStatus());
+  EXPECT_EQ(rebooted.value(), 77u);
+}
+
+}  // namespace
+}  // namespace pw::kvs
@@ -0,0 +1,216 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_kvs/async_key_value_store.h
+///
+/// Async façade over `KeyValueStore` for pw_async2 applications. Every KVS
+/// operation blocks on flash, so async-first applications end up wrapping
+/// the store in a hand-rolled thread + request queue. `AsyncKeyValueStore`
+/// provides that plumbing once: `PendGet`/`PendPut`/`PendDelete` return
+/// pendable futures, requests queue into a fixed-size table, and a worker of
+/// the application's choosing (a thread, a `pw_work_queue` item, or a
+/// dedicated low-priority task) drains them with
+/// `ProcessPendingOperations()`, waking each future as its request
+/// completes.
+///
+/// Duplicate in-flight Gets of the same key are coalesced: one flash read
+/// serves every waiting Get whose buffer fits the value, so a burst of
+/// readers costs a single pass over flash.
+
+#include <array>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#include "pw_async2/dispatcher.h"
+#include "pw_async2/poll.h"
+#include "pw_kvs/key_value_store.h"
+#include "pw_status/status_with_size.h"
+#include "pw_sync/interrupt_spin_lock.h"
+
+namespace pw::kvs {
+
+/// Queues up to `kMaxOperations` concurrent KVS operations.
+template <size_t kMaxOperations>
+class AsyncKeyValueStore {
+ public:
+  /// Pendable handle for one queued operation. Returns `Pending` until the
+  /// worker executes the request, then the operation's `StatusWithSize`
+  /// (size is 0 for Put/Delete). Dropping the future abandons the request's
+  /// result but the operation still executes.
+  class Future {
+   public:
+    Future() : store_(nullptr), slot_(0) {}
+
+    async2::Poll<StatusWithSize> Pend(async2::Context& context) {
+      if (store_ == nullptr) {
+        return async2::Ready(StatusWithSize(Status::ResourceExhausted(), 0));
+      }
+      return store_->PendOperation(*this, context);
+    }
+
+   private:
+    template <size_t>
+    friend class AsyncKeyValueStore;
+
+    Future(AsyncKeyValueStore& store, size_t slot)
+        : store_(&store), slot_(slot) {}
+
+    AsyncKeyValueStore* store_;
+    size_t slot_;
+  };
+
+  explicit AsyncKeyValueStore(KeyValueStore& kvs) : kvs_(kvs) {}
+
+  /// Queues a read of `key` into `value_out`. The buffer must remain valid
+  /// until the future resolves.
+  Future PendGet(std::string_view key, ByteSpan value_out) {
+    return Enqueue(Operation::kGet, key, value_out, ConstByteSpan());
+  }
+
+  /// Queues a write. Both key and value must remain valid until the future
+  /// resolves.
+  Future PendPut(std::string_view key, ConstByteSpan value) {
+    return Enqueue(Operation::kPut, key, ByteSpan(), value);
+  }
+
+  /// Queues a deletion of `key`.
+  Future PendDelete(std::string_view key) {
+    return Enqueue(Operation::kDelete, key, ByteSpan(), ConstByteSpan());
+  }
+
+  /// Executes up to `max_operations` queued requests on the caller's thread
+  /// (the worker). Returns the number executed. Completed futures are woken.
+  size_t ProcessPendingOperations(size_t max_operations = kMaxOperations) {
+    size_t processed = 0;
+    while (processed < max_operations) {
+      Slot* slot = ClaimNextQueued();
+      if (slot == nullptr) {
+        break;
+      }
+      Execute(*slot);
+      ++processed;
+    }
+    return processed;
+  }
+
+  /// Gets served from another Get's flash read instead of their own.
+  uint32_t coalesced_gets() const { return coalesced_gets_; }
+
+ private:
+  enum class Operation : uint8_t { kGet, kPut, kDelete };
+  enum class State : uint8_t { kFree, kQueued, kExecuting, kComplete };
+
+  struct Slot {
+    State state = State::kFree;
+    Operation operation;
+    std::string_view key;
+    ByteSpan value_out;
+    ConstByteSpan value_in;
+    StatusWithSize result;
+    async2::Waker waker;
+  };
+
+  Future Enqueue(Operation operation,
+                 std::string_view key,
+                 ByteSpan value_out,
+                 ConstByteSpan value_in) {
+    std::lock_guard lock(lock_);
+    for (size_t i = 0; i < kMaxOperations; ++i) {
+      Slot& slot = slots_[i];
+      if (slot.state == State::kFree) {
+        slot.state = State::kQueued;
+        slot.operation = operation;
+        slot.key = key;
+        slot.value_out = value_out;
+        slot.value_in = value_in;
+        slot.result = StatusWithSize(Status::Unknown(), 0);
+        return Future(*this, i);
+      }
+    }
+    return Future();  // Table full; the future resolves RESOURCE_EXHAUSTED.
+  }
+
+  async2::Poll<StatusWithSize> PendOperation(Future& future,
+                                             async2::Context& context) {
+    std::lock_guard lock(lock_);
+    Slot& slot = slots_[future.slot_];
+    if (slot.state == State::kComplete) {
+      slot.state = State::kFree;
+      future.store_ = nullptr;
+      return async2::Ready(slot.result);
+    }
+    PW_ASYNC_STORE_WAKER(
+        context, slot.waker, "AsyncKeyValueStore operation pending");
+    return async2::Pending();
+  }
+
+  Slot* ClaimNextQueued() {
+    std::lock_guard lock(lock_);
+    for (Slot& slot : slots_) {
+      if (slot.state == State::kQueued) {
+        slot.state = State::kExecuting;
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  void Execute(Slot& slot) {
+    StatusWithSize result;
+    switch (slot.operation) {
+      case Operation::kGet:
+        result = kvs_.Get(slot.key, slot.value_out);
+        break;
+      case Operation::kPut:
+        result = StatusWithSize(kvs_.Put(slot.key, slot.value_in), 0);
+        break;
+      case Operation::kDelete:
+        result = StatusWithSize(kvs_.Delete(slot.key), 0);
+        break;
+    }
+
+    std::lock_guard lock(lock_);
+    Complete(slot, result);
+
+    // Serve queued Gets of the same key from this read: their buffers are
+    // filled from the just-read copy, skipping redundant flash passes.
+    if (slot.operation == Operation::kGet && result.ok()) {
+      for (Slot& other : slots_) {
+        if (&other != &slot && other.state == State::kQueued &&
+            other.operation == Operation::kGet && other.key == slot.key &&
+            other.value_out.size() >= result.size()) {
+          std::memcpy(
+              other.value_out.data(), slot.value_out.data(), result.size());
+          Complete(other, result);
+          ++coalesced_gets_;
+        }
+      }
+    }
+  }
+
+  void Complete(Slot& slot, StatusWithSize result) {
+    slot.result = result;
+    slot.state = State::kComplete;
+    std::move(slot.waker).Wake();
+  }
+
+  KeyValueStore& kvs_;
+  sync::InterruptSpinLock lock_;
+  std::array<Slot, kMaxOperations> slots_;
+  uint32_t coalesced_gets_ = 0;
+};
+
+}  // namespace pw::kvs
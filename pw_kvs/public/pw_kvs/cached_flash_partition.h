@@ -0,0 +1,126 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "pw_kvs/flash_memory.h"
+#include "pw_span/span.h"
+
+namespace pw::kvs {
+
+/// `FlashPartition` with a small read cache in front of the flash.
+///
+/// Reads are served from `kCacheLines` RAM lines of `kLineSizeBytes` each,
+/// filled on miss with one line-sized flash read. This converts the many
+/// small, overlapping reads that `KeyValueStore` issues while scanning
+/// entries (headers, keys, checksums) into a few line-sized flash
+/// transactions, which matters for external SPI/QSPI flash where each read
+/// carries command and address overhead. Writes and erases invalidate any
+/// overlapping lines, so cached data never goes stale through this object.
+///
+/// The cache costs `kCacheLines * kLineSizeBytes` bytes of RAM. Size lines to
+/// the flash's efficient read granularity; direct reads larger than a line
+/// bypass the cache.
+template <size_t kCacheLines = 4, size_t kLineSizeBytes = 64>
+class CachedFlashPartition : public FlashPartition {
+ public:
+  using FlashPartition::FlashPartition;
+
+  StatusWithSize Read(Address address, span<std::byte> output) override {
+    // Large reads go straight to flash and do not disturb the cache.
+    if (output.size() > kLineSizeBytes) {
+      return FlashPartition::Read(address, output);
+    }
+
+    size_t read = 0;
+    while (read < output.size()) {
+      const Address line_base = AlignDownToLine(address + read);
+      const size_t line_index = LineIndex(line_base);
+      Line& line = lines_[line_index];
+      if (!line.valid || line.base != line_base) {
+        // Fill the line, clamping at the end of the partition.
+        const size_t fill_size =
+            line_base + kLineSizeBytes <= size_bytes()
+                ? kLineSizeBytes
+                : size_bytes() - line_base;
+        const StatusWithSize fill_result =
+            FlashPartition::Read(line_base, span(line.data, fill_size));
+        if (!fill_result.ok()) {
+          return StatusWithSize(fill_result.status(), read);
+        }
+        line.base = line_base;
+        line.size = fill_result.size();
+        line.valid = true;
+      }
+      const size_t offset = address + read - line.base;
+      if (offset >= line.size) {
+        return StatusWithSize::OutOfRange();
+      }
+      const size_t to_copy =
+          std::min(output.size() - read, line.size - offset);
+      std::memcpy(output.data() + read, line.data + offset, to_copy);
+      read += to_copy;
+    }
+    return StatusWithSize(read);
+  }
+
+  StatusWithSize Write(Address address, span<const std::byte> data) override {
+    InvalidateRange(address, data.size());
+    return FlashPartition::Write(address, data);
+  }
+
+  Status Erase(Address address, size_t num_sectors) override {
+    InvalidateRange(address, num_sectors * sector_size_bytes());
+    return FlashPartition::Erase(address, num_sectors);
+  }
+
+  /// Discards all cached data, e.g. after the flash is modified externally.
+  void InvalidateCache() {
+    for (Line& line : lines_) {
+      line.valid = false;
+    }
+  }
+
+ private:
+  struct Line {
+    Address base = 0;
+    size_t size = 0;
+    bool valid = false;
+    std::byte data[kLineSizeBytes];
+  };
+
+  static constexpr Address AlignDownToLine(Address address) {
+    return address - (address % kLineSizeBytes);
+  }
+
+  static constexpr size_t LineIndex(Address line_base) {
+    return (line_base / kLineSizeBytes) % kCacheLines;
+  }
+
+  void InvalidateRange(Address address, size_t size) {
+    const Address first = AlignDownToLine(address);
+    for (Line& line : lines_) {
+      if (line.valid && line.base + kLineSizeBytes > first &&
+          line.base < address + size) {
+        line.valid = false;
+      }
+    }
+  }
+
+  Line lines_[kCacheLines];
+};
+
+}  // namespace pw::kvs
@@ -285,6 +285,52 @@ class FlashPartition {
   // UNKNOWN - HAL error
   virtual StatusWithSize Write(Address address, span<const std::byte> data);
 
+  // Writes `data` and verifies it with a CRC32 read-back pass: the checksum
+  // is computed from the source buffer while it is still in RAM, then the
+  // written range is verified via VerifyWrittenRange, which by default
+  // re-reads the range through a small chunk buffer and compares checksums
+  // once at the end. Unlike a byte-compare verify, this needs no second copy
+  // of the source data and only one comparison; backends whose controller
+  // reports per-page ECC/CRC status can override VerifyWrittenRange to skip
+  // the read-back entirely. Returns DATA_LOSS if verification fails.
+  StatusWithSize WriteVerified(Address address, span<const std::byte> data);
+
+  // Verifies that `size` bytes at `address` have the given CRC32. The
+  // default implementation reads the range in chunks and computes the
+  // checksum; override to use hardware verification status instead.
+  virtual Status VerifyWrittenRange(Address address,
+                                    size_t size,
+                                    uint32_t expected_crc32);
+
+  // Hooks for asynchronous writes. Backends that can program flash in the
+  // background (e.g. via DMA or a busy-polling-free driver) may override
+  // these; the default implementation performs the write synchronously in
+  // StartWrite, so AwaitWriteCompletion completes immediately. While a write
+  // started with StartWrite is in progress, the source buffer must remain
+  // valid and no other Read, Write, or Erase may be issued until
+  // AwaitWriteCompletion returns.
+  virtual bool supports_async_write() const { return false; }
+
+  virtual StatusWithSize StartWrite(Address address,
+                                    span<const std::byte> data) {
+    return Write(address, data);
+  }
+
+  virtual Status AwaitWriteCompletion() { return OkStatus(); }
+
+  // Hooks for asynchronous reads, mirroring the asynchronous write hooks.
+  // DMA-capable backends may override these to read flash in the background;
+  // the default implementation reads synchronously in StartRead. While a read
+  // is in progress, the destination buffer must remain valid and no other
+  // Read, Write, or Erase may be issued until AwaitReadCompletion returns.
+  virtual bool supports_async_read() const { return false; }
+
+  virtual StatusWithSize StartRead(Address address, span<std::byte> output) {
+    return Read(address, output);
+  }
+
+  virtual Status AwaitReadCompletion() { return OkStatus(); }
+
   // Check to see if chunk of flash partition is erased. Address and len need to
   // be aligned with FlashMemory. Returns:
   //
@@ -25,6 +25,21 @@
 #include "pw_kvs/internal/sectors.h"
 #include "pw_span/span.h"
 
+/// @def PW_KVS_ENTRY_CACHE_BLOOM_BITS
+///
+/// Number of bits in the EntryCache's key-hash Bloom filter. Lookups for keys
+/// that are not in the KVS (and most new keys during initialization) are
+/// resolved by the filter without scanning the descriptor list. Must be a
+/// power of two; costs kBits / 8 bytes of RAM per KVS instance. Set to 0 to
+/// disable the filter.
+#ifndef PW_KVS_ENTRY_CACHE_BLOOM_BITS
+#define PW_KVS_ENTRY_CACHE_BLOOM_BITS 256
+#endif  // PW_KVS_ENTRY_CACHE_BLOOM_BITS
+
+static_assert((PW_KVS_ENTRY_CACHE_BLOOM_BITS &
+               (PW_KVS_ENTRY_CACHE_BLOOM_BITS - 1)) == 0,
+              "PW_KVS_ENTRY_CACHE_BLOOM_BITS must be a power of two");
+
 namespace pw {
 namespace kvs {
 namespace internal {
@@ -157,10 +172,16 @@ class EntryCache {
                        size_t redundancy)
       : descriptors_(descriptors),
         addresses_(addresses),
-        redundancy_(redundancy) {}
+        redundancy_(redundancy),
+        bloom_{} {}
 
   // Clears all KeyDescriptors.
-  void Reset() const { descriptors_.clear(); }
+  void Reset() const {
+    descriptors_.clear();
+    for (size_t i = 0; i < kBloomWords; ++i) {
+      bloom_[i] = 0;
+    }
+  }
 
   // Finds the metadata for an entry matching a particular key. Searches for a
   // KeyDescriptor that matches this key and sets *metadata to point to it if
@@ -224,6 +245,38 @@ class EntryCache {
   const_iterator cend() const { return {this, descriptors_.end()}; }
 
  private:
+  static constexpr size_t kBloomBits = PW_KVS_ENTRY_CACHE_BLOOM_BITS;
+  static constexpr size_t kBloomWords = kBloomBits == 0 ? 1 : kBloomBits / 32;
+
+  // The Bloom filter sets two bits per key hash. Bits are only set, never
+  // cleared (except by Reset), so removing an entry leaves stale bits; a
+  // stale bit just means a scan that finds nothing, which is safe.
+  static constexpr uint32_t BloomBit2(uint32_t key_hash) {
+    return (key_hash * UINT32_C(2654435761)) & (kBloomBits - 1);
+  }
+
+  void BloomInsert(uint32_t key_hash) const {
+    if constexpr (kBloomBits > 0) {
+      const uint32_t bit_1 = key_hash & (kBloomBits - 1);
+      const uint32_t bit_2 = BloomBit2(key_hash);
+      bloom_[bit_1 / 32] |= UINT32_C(1) << (bit_1 % 32);
+      bloom_[bit_2 / 32] |= UINT32_C(1) << (bit_2 % 32);
+    }
+  }
+
+  // Returns false only if no descriptor has this key hash; false positives
+  // are possible and fall through to the descriptor scan.
+  bool BloomMayContain(uint32_t key_hash) const {
+    if constexpr (kBloomBits > 0) {
+      const uint32_t bit_1 = key_hash & (kBloomBits - 1);
+      const uint32_t bit_2 = BloomBit2(key_hash);
+      return (bloom_[bit_1 / 32] & (UINT32_C(1) << (bit_1 % 32))) != 0 &&
+             (bloom_[bit_2 / 32] & (UINT32_C(1) << (bit_2 % 32))) != 0;
+    } else {
+      return true;
+    }
+  }
+
   int FindIndex(uint32_t key_hash) const;
 
   // Adds the address to the descriptor at the specified index if there is an
@@ -242,6 +295,10 @@ class EntryCache {
   Vector<KeyDescriptor>& descriptors_;
   FlashPartition::Address* const addresses_;
   const size_t redundancy_;
+
+  // Updated from const methods (EntryCache is mutated through const methods
+  // throughout, since the descriptors are a reference).
+  mutable uint32_t bloom_[kBloomWords];
 };
 
 }  // namespace internal
@@ -21,6 +21,28 @@
 #include "pw_kvs/flash_memory.h"
 #include "pw_span/span.h"
 
+/// @def PW_KVS_FREE_SPACE_INDEX_BUCKETS
+///
+/// Number of buckets in the sector free-space index. The index maintains a
+/// histogram of sector writable bytes so FindSpace can reject requests that no
+/// sector can satisfy without scanning every sector descriptor, and caches the
+/// sector selected by the last append so repeated writes to the same sector
+/// skip the scan entirely. Each bucket costs 2 bytes of RAM per KVS instance.
+/// Set to 0 to disable the index.
+#ifndef PW_KVS_FREE_SPACE_INDEX_BUCKETS
+#define PW_KVS_FREE_SPACE_INDEX_BUCKETS 8
+#endif  // PW_KVS_FREE_SPACE_INDEX_BUCKETS
+
+/// @def PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+///
+/// When enabled, each sector descriptor tracks how many times the sector has
+/// been erased since boot, and garbage collection breaks ties between
+/// equally reclaimable sectors by preferring the least-erased one, spreading
+/// wear. Costs 2 bytes of RAM per sector.
+#ifndef PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+#define PW_KVS_RECORD_SECTOR_ERASE_COUNTS 0
+#endif  // PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+
 namespace pw {
 namespace kvs {
 namespace internal {
@@ -94,6 +116,12 @@ class SectorDescriptor {
 
   uint16_t tail_free_bytes_;  // writable bytes at the end of the sector
   uint16_t valid_bytes_;      // sum of sizes of valid entries
+#if PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+  uint16_t erase_count_ = 0;  // erases since boot, for wear-aware GC
+
+ public:
+  uint16_t erase_count() const { return erase_count_; }
+#endif  // PW_KVS_RECORD_SECTOR_ERASE_COUNTS
 };
 
 // Represents a list of sectors usable by the KVS.
@@ -107,6 +135,8 @@ class Sectors {
       : descriptors_(sectors),
         partition_(partition),
         last_new_(nullptr),
+        append_candidate_(nullptr),
+        free_space_buckets_{},
         temp_sectors_to_skip_(temp_sectors_to_skip) {}
 
   // Resets the Sectors list. Must be called before using the object.
@@ -114,6 +144,7 @@ class Sectors {
     last_new_ = descriptors_.begin();
     descriptors_.assign(partition_.sector_count(),
                         SectorDescriptor(partition_.sector_size_bytes()));
+    RebuildFreeSpaceIndex();
   }
 
   // The last sector that was selected as the "new empty sector" to write to.
@@ -127,9 +158,11 @@ class Sectors {
   // because SectorDescriptor* is the standard way to identify a sector.
   SectorDescriptor* last_new() const { return last_new_; }
 
-  // Sets the last new sector from the provided address.
+  // Sets the last new sector from the provided address. Invalidates the
+  // cached append candidate, since it depends on the scan starting point.
   void set_last_new_sector(Address address) {
     last_new_ = &FromAddress(address);
+    append_candidate_ = nullptr;
   }
 
   // Checks if an address is in the particular sector.
@@ -156,6 +189,45 @@ class Sectors {
            sector.writable_bytes();
   }
 
+  // Wrappers for the SectorDescriptor writable-byte mutators that keep the
+  // free-space index in sync. All writable-byte changes made by the KVS must
+  // go through these rather than mutating the SectorDescriptor directly.
+  void RemoveWritableBytes(SectorDescriptor& sector, size_t bytes) {
+    FreeSpaceIndexRemove(sector);
+    sector.RemoveWritableBytes(static_cast<uint16_t>(bytes));
+    FreeSpaceIndexAdd(sector);
+    if (&sector != append_candidate_) {
+      append_candidate_ = nullptr;
+    }
+  }
+
+  void SetWritableBytes(SectorDescriptor& sector, size_t writable_bytes) {
+    FreeSpaceIndexRemove(sector);
+    sector.set_writable_bytes(static_cast<uint16_t>(writable_bytes));
+    FreeSpaceIndexAdd(sector);
+    append_candidate_ = nullptr;
+  }
+
+  // Marking a sector corrupt can happen while reading, so this is const, and
+  // the index bookkeeping members are mutable (as with
+  // KeyValueStore::error_detected_).
+  // Records that the sector was erased, for wear-aware GC selection. No-op
+  // unless PW_KVS_RECORD_SECTOR_ERASE_COUNTS is enabled.
+  void RecordErase([[maybe_unused]] SectorDescriptor& sector) {
+#if PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+    if (sector.erase_count_ != UINT16_MAX) {
+      sector.erase_count_ += 1;
+    }
+#endif  // PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+  }
+
+  void MarkCorrupt(SectorDescriptor& sector) const {
+    FreeSpaceIndexRemove(sector);
+    sector.mark_corrupt();
+    FreeSpaceIndexAdd(sector);
+    append_candidate_ = nullptr;
+  }
+
   // Finds either an existing sector with enough space that is not the sector to
   // skip, or an empty sector. Maintains the invariant that there is always at
   // least 1 empty sector. Addresses in reserved_addresses are avoided.
@@ -209,6 +281,9 @@ class Sectors {
  private:
   enum FindMode { kAppendEntry, kGarbageCollect };
 
+  static constexpr size_t kFreeSpaceIndexBuckets =
+      PW_KVS_FREE_SPACE_INDEX_BUCKETS;
+
   Status Find(FindMode find_mode,
               SectorDescriptor** found_sector,
               size_t size,
@@ -217,11 +292,72 @@ class Sectors {
 
   SectorDescriptor& WearLeveledSectorFromIndex(size_t idx) const;
 
+  // Returns the free-space index bucket for the provided byte count. The
+  // mapping is monotonic, so a sector with at least as many writable bytes as
+  // a request never lands in a lower bucket than the request.
+  size_t FreeSpaceBucket(size_t bytes) const {
+    const size_t bucket =
+        bytes * kFreeSpaceIndexBuckets / partition_.sector_size_bytes();
+    return bucket >= kFreeSpaceIndexBuckets ? kFreeSpaceIndexBuckets - 1
+                                            : bucket;
+  }
+
+  void FreeSpaceIndexAdd(const SectorDescriptor& sector) const {
+    if constexpr (kFreeSpaceIndexBuckets > 0) {
+      free_space_buckets_[FreeSpaceBucket(sector.writable_bytes())] += 1;
+    }
+  }
+
+  void FreeSpaceIndexRemove(const SectorDescriptor& sector) const {
+    if constexpr (kFreeSpaceIndexBuckets > 0) {
+      free_space_buckets_[FreeSpaceBucket(sector.writable_bytes())] -= 1;
+    }
+  }
+
+  void RebuildFreeSpaceIndex() {
+    append_candidate_ = nullptr;
+    if constexpr (kFreeSpaceIndexBuckets > 0) {
+      for (size_t i = 0; i < kFreeSpaceIndexBuckets; ++i) {
+        free_space_buckets_[i] = 0;
+      }
+      for (const SectorDescriptor& sector : descriptors_) {
+        FreeSpaceIndexAdd(sector);
+      }
+    }
+  }
+
+  // Returns true if no sector can possibly hold size writable bytes, allowing
+  // Find to skip the descriptor scan. Conservative: never returns true when a
+  // suitable sector exists.
+  bool NoSectorCanHold(size_t size) const {
+    if constexpr (kFreeSpaceIndexBuckets > 0) {
+      for (size_t i = FreeSpaceBucket(size); i < kFreeSpaceIndexBuckets; ++i) {
+        if (free_space_buckets_[i] != 0) {
+          return false;
+        }
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }
+
   Vector<SectorDescriptor>& descriptors_;
   FlashPartition& partition_;
 
   SectorDescriptor* last_new_;
 
+  // The sector selected by the most recent append-mode Find. While it still
+  // has data and space and no other sector has changed, the next append-mode
+  // Find returns it without scanning.
+  mutable SectorDescriptor* append_candidate_;
+
+  // Histogram of sector writable bytes, used to reject unsatisfiable space
+  // requests in O(buckets) instead of O(sectors).
+  mutable uint16_t free_space_buckets_[kFreeSpaceIndexBuckets == 0
+                                   ? 1
+                                   : kFreeSpaceIndexBuckets];
+
   // Temp buffer with space for redundancy * 2 - 1 sector pointers. This list is
   // used to track sectors that should be excluded from Find functions.
   const SectorDescriptor** const temp_sectors_to_skip_;
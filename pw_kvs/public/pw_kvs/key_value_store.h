@@ -122,6 +122,24 @@ class KeyValueStore {
   /// @endrst
   Status Init();
 
+  /// Serializes the in-RAM index (sector usage and entry cache) into
+  /// `buffer`, so a subsequent boot can skip the full flash scan via
+  /// `InitFromIndexCache()`. Save the result to persistent storage (e.g. a
+  /// blob or dedicated flash page) at a quiescent point such as clean
+  /// shutdown; any KVS write after saving invalidates the cache.
+  ///
+  /// Returns the number of bytes written, or RESOURCE_EXHAUSTED if the
+  /// buffer is too small, or FAILED_PRECONDITION if the KVS is not
+  /// initialized.
+  StatusWithSize SaveIndexCache(ByteSpan buffer) const;
+
+  /// Initializes the KVS from an index cache saved by `SaveIndexCache()`,
+  /// reading one entry header per key to confirm the cache matches the flash
+  /// contents instead of scanning and checksumming every sector. If the
+  /// cache is invalid, stale, or fails verification, returns an error
+  /// without modifying flash; the caller should fall back to `Init()`.
+  Status InitFromIndexCache(ConstByteSpan cache);
+
   bool initialized() const {
     return initialized_ == InitializationState::kReady;
   }
@@ -162,6 +180,37 @@ class KeyValueStore {
                      span<std::byte> value,
                      size_t offset_bytes = 0) const;
 
+  /// Reads the value of an entry in place, without copying, when the
+  /// partition's flash is memory mapped (e.g. XIP flash). The returned span
+  /// points directly into flash; it remains valid until the entry is
+  /// rewritten, deleted, or relocated by garbage collection, so it must not
+  /// be held across calls that write to the KVS. The entry's checksum is
+  /// verified once before the span is returned.
+  ///
+  /// @param[in] key The name of the key.
+  ///
+  /// @param[out] value Set to the entry's value bytes in flash on success.
+  ///
+  /// @returns @rst
+  ///
+  /// .. pw-status-codes::
+  ///
+  ///    OK: ``value`` points to the value in flash.
+  ///
+  ///    UNIMPLEMENTED: The flash backend is not memory mapped.
+  ///
+  ///    NOT_FOUND: ``key`` is not present in the KVS.
+  ///
+  ///    DATA_LOSS: Checksum validation failed.
+  ///
+  ///    FAILED_PRECONDITION: The KVS is not initialized. Call ``Init()``
+  ///    before calling this method.
+  ///
+  ///    INVALID_ARGUMENT: ``key`` is empty or too long.
+  ///
+  /// @endrst
+  Status GetPointer(std::string_view key, span<const std::byte>* value) const;
+
   /// Overload of `Get()` that accepts a pointer to a trivially copyable
   /// object.
   ///
@@ -244,6 +293,71 @@ class KeyValueStore {
   /// @endrst
   Status Delete(std::string_view key);
 
+  /// Stages multiple Put and Delete operations in a caller-provided buffer
+  /// and applies them together with `Commit()`. Operations are applied in
+  /// order; if the same key is staged multiple times, only the last staged
+  /// operation is written to flash, so checkpoints that update a key several
+  /// times pay for a single entry. Commit is not atomic with respect to power
+  /// loss: each entry is still written and checksummed individually, and a
+  /// commit interrupted partway leaves the earlier operations applied.
+  ///
+  /// The buffer stores each operation as a small header plus the key and
+  /// value bytes. A Put of an N-byte value with a K-character key requires
+  /// 4 + K + N bytes; a Delete requires 4 + K bytes.
+  class Transaction {
+   public:
+    /// Creates a transaction that stages operations in `buffer`.
+    Transaction(KeyValueStore& kvs, span<std::byte> buffer)
+        : kvs_(kvs), buffer_(buffer), staged_bytes_(0) {}
+
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+    /// Stages a Put of a span of bytes or a trivially copyable object.
+    /// Returns RESOURCE_EXHAUSTED if the staging buffer is full.
+    template <typename T,
+              typename std::enable_if_t<ConvertsToSpan<T>::value>* = nullptr>
+    Status Put(const std::string_view& key, const T& value) {
+      return Stage(key, as_bytes(internal::make_span(value)), OpType::kPut);
+    }
+
+    template <typename T,
+              typename std::enable_if_t<!ConvertsToSpan<T>::value>* = nullptr>
+    Status Put(const std::string_view& key, const T& value) {
+      CheckThatObjectCanBePutOrGet<T>();
+      return Stage(key,
+                   span(reinterpret_cast<const std::byte*>(&value), sizeof(T)),
+                   OpType::kPut);
+    }
+
+    /// Stages a Delete of a key.
+    Status Delete(std::string_view key) {
+      return Stage(key, {}, OpType::kDelete);
+    }
+
+    /// Applies the staged operations to the KVS in order and clears the
+    /// transaction. Returns the first error encountered; operations staged
+    /// after a failing operation are not applied.
+    Status Commit();
+
+    /// Discards all staged operations.
+    void Abort() { staged_bytes_ = 0; }
+
+    /// The number of bytes of the staging buffer in use.
+    size_t staged_bytes() const { return staged_bytes_; }
+
+   private:
+    enum class OpType : uint8_t { kPut, kDelete };
+
+    Status Stage(std::string_view key,
+                 span<const std::byte> value,
+                 OpType op);
+
+    KeyValueStore& kvs_;
+    const span<std::byte> buffer_;
+    size_t staged_bytes_;
+  };
+
   /// Returns the size of the value corresponding to the key.
   ///
   /// @param[in] key - The name of the key.
@@ -295,6 +409,29 @@ class KeyValueStore {
   /// that makes sense for the KVS implementation.
   Status PartialMaintenance();
 
+  /// Performs a bounded amount of garbage collection, relocating roughly at
+  /// most `max_relocate_bytes` of valid data before returning. Repeated calls
+  /// continue collecting the same sector until it is reclaimed, then select
+  /// the next sector, so this can be driven from a low-priority task (e.g. a
+  /// pw_work_queue worker) to keep worst-case `Put()` latency bounded. At
+  /// least one entry is relocated per call, even if it is larger than
+  /// `max_relocate_bytes`. If configured for at least lazy recovery, does any
+  /// needed repairing of corruption first.
+  ///
+  /// @returns @rst
+  ///
+  /// .. pw-status-codes::
+  ///
+  ///    OK: A chunk of work was performed; call again to continue.
+  ///
+  ///    NOT_FOUND: No garbage collection work remains; no sector has
+  ///    reclaimable space.
+  ///
+  ///    FAILED_PRECONDITION: The KVS is not initialized.
+  ///
+  /// @endrst
+  Status GarbageCollectChunk(size_t max_relocate_bytes);
+
   void LogDebugInfo() const;
 
   // Classes and functions to support STL-style iteration.
@@ -688,6 +825,10 @@ class KeyValueStore {
   };
   InternalStats internal_stats_;
 
+  // Sector currently being garbage collected by GarbageCollectChunk(), or
+  // nullptr if no incremental garbage collection is in progress.
+  internal::SectorDescriptor* incremental_gc_sector_;
+
   uint32_t last_transaction_id_;
 };
 
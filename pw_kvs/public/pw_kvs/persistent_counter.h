@@ -0,0 +1,120 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_kvs/persistent_counter.h
+///
+/// A journaling tier for rapidly-changing counters (operating hours, cycle
+/// counts). Incrementing through `KeyValueStore::Put` burns a flash write per
+/// update, which is unsustainable at high update rates. `PersistentCounter`
+/// keeps the live value in a `pw::persistent_ram::Persistent`, which survives
+/// warm reboots for free, and only checkpoints into the KVS on demand --
+/// typically from a power-loss-warning interrupt or a coarse timer -- so
+/// flash sees a tiny fraction of the update volume.
+
+#include <string_view>
+#include <type_traits>
+
+#include "pw_kvs/key_value_store.h"
+#include "pw_persistent_ram/persistent.h"
+#include "pw_status/status.h"
+#include "pw_status/try.h"
+
+namespace pw::kvs {
+
+/// A monotonic counter persisted across warm reboots in RAM and across power
+/// loss in a `KeyValueStore`.
+///
+/// `T` must be an unsigned integral type. The counter is monotonic by
+/// construction (`Increment` only adds), which is what makes the load-time
+/// merge well defined: the recovered value is the maximum of the RAM copy and
+/// the last KVS checkpoint, so a stale checkpoint never rolls the counter
+/// back after a warm reboot, and a lost RAM section falls back to the
+/// checkpoint.
+///
+/// @code{.cpp}
+///   PW_PLACE_IN_SECTION(".noinit")
+///   pw::persistent_ram::Persistent<uint64_t> operating_seconds_ram;
+///
+///   pw::kvs::PersistentCounter<uint64_t> operating_seconds(
+///       operating_seconds_ram, kvs, "op_secs");
+///
+///   operating_seconds.Init();
+///   operating_seconds.Increment();   // RAM-only; no flash write.
+///   ...
+///   operating_seconds.Checkpoint();  // On power-loss warning or interval.
+/// @endcode
+template <typename T>
+class PersistentCounter {
+ public:
+  static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>,
+                "PersistentCounter requires an unsigned integral type");
+
+  PersistentCounter(persistent_ram::Persistent<T>& ram_value,
+                    KeyValueStore& kvs,
+                    std::string_view key)
+      : ram_value_(ram_value), kvs_(kvs), key_(key), checkpointed_value_(0) {}
+
+  /// Recovers the counter. Merges the RAM copy (if it survived reset intact)
+  /// with the last KVS checkpoint by taking the maximum, so a stale
+  /// checkpoint never rolls the counter back after a warm reboot. A missing
+  /// KVS entry is not an error -- the counter starts from the RAM copy, or
+  /// zero if that was also lost. Other KVS errors are returned unchanged.
+  Status Init() {
+    T checkpoint = 0;
+    const Status get_status = kvs_.Get(key_, &checkpoint);
+    if (!get_status.ok() && !get_status.IsNotFound()) {
+      return get_status;
+    }
+    checkpointed_value_ = get_status.ok() ? checkpoint : 0;
+
+    if (!ram_value_.has_value() || ram_value_.value() < checkpointed_value_) {
+      ram_value_ = checkpointed_value_;
+    }
+    return OkStatus();
+  }
+
+  /// The current counter value.
+  ///
+  /// @pre `Init` has been called.
+  T value() const { return ram_value_.value(); }
+
+  /// Adds `amount` to the counter. RAM-only: no flash is touched.
+  void Increment(T amount = 1) { ram_value_ = ram_value_.value() + amount; }
+
+  /// True if the counter has advanced past the last KVS checkpoint.
+  bool dirty() const { return ram_value_.value() != checkpointed_value_; }
+
+  /// Writes the current value to the KVS if it has changed since the last
+  /// checkpoint. Call from a power-loss-warning handler or on a coarse
+  /// interval; calling when clean is free.
+  Status Checkpoint() {
+    if (!dirty()) {
+      return OkStatus();
+    }
+    const T current = ram_value_.value();
+    PW_TRY(kvs_.Put(key_, current));
+    checkpointed_value_ = current;
+    return OkStatus();
+  }
+
+ private:
+  persistent_ram::Persistent<T>& ram_value_;
+  KeyValueStore& kvs_;
+  const std::string_view key_;
+  // Last value written to (or read from) the KVS, to skip no-op checkpoints.
+  T checkpointed_value_;
+};
+
+}  // namespace pw::kvs
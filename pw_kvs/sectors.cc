@@ -46,6 +46,15 @@ Status Sectors::Find(FindMode find_mode,
   SectorDescriptor* non_empty_least_reclaimable_sector = nullptr;
   const size_t sector_size_bytes = partition_.sector_size_bytes();
 
+  // Free-space index check: if no sector has enough writable bytes, skip the
+  // descriptor scan entirely.
+  if (NoSectorCanHold(size)) {
+    PW_LOG_DEBUG("  No sector with %u writable bytes, per free-space index",
+                 unsigned(size));
+    *found_sector = nullptr;
+    return Status::ResourceExhausted();
+  }
+
   // Build a list of sectors to avoid.
   //
   // This is overly strict. reserved_addresses is populated when there are
@@ -73,6 +82,21 @@ Status Sectors::Find(FindMode find_mode,
     PW_LOG_DEBUG("  Skip sector %u", Index(temp_sectors_to_skip_[i]));
   }
 
+  // Fast path for appends: if the sector selected by the last append-mode Find
+  // is unchanged except for the appends themselves, and it still has data and
+  // enough space, reuse it without scanning. Any writable-byte change to a
+  // different sector invalidates the candidate. Finds with sectors to skip
+  // take the full scan, since the skip list may change which sector is chosen.
+  if (find_mode == kAppendEntry && sectors_to_skip == 0 &&
+      append_candidate_ != nullptr &&
+      !append_candidate_->Empty(sector_size_bytes) &&
+      append_candidate_->HasSpace(size)) {
+    PW_LOG_DEBUG("  Reusing append sector %u from free-space index",
+                 Index(append_candidate_));
+    *found_sector = append_candidate_;
+    return OkStatus();
+  }
+
   // last_new_ is the sector that was last selected as the "new empty sector" to
   // write to. This last new sector is used as the starting point for the next
   // "find a new empty sector to write to" operation. By using the last new
@@ -111,6 +135,9 @@ Status Sectors::Find(FindMode find_mode,
     if (!sector->Empty(sector_size_bytes) && sector->HasSpace(size)) {
       if ((find_mode == kAppendEntry) ||
           (sector->RecoverableBytes(sector_size_bytes) == 0)) {
+        if (find_mode == kAppendEntry && sectors_to_skip == 0) {
+          append_candidate_ = sector;
+        }
         *found_sector = sector;
         return OkStatus();
       } else {
@@ -196,14 +223,23 @@ SectorDescriptor* Sectors::FindSectorToGarbageCollect(
   }
 
   // Step 2: If step 1 yields no sectors, just find the sector with the most
-  // reclaimable bytes but no addresses to avoid.
+  // reclaimable bytes but no addresses to avoid. With erase-count tracking
+  // enabled, equally reclaimable sectors are tie-broken toward the
+  // least-erased one to spread wear.
   if (sector_candidate == nullptr) {
     for (size_t i = 0; i < descriptors_.size(); ++i) {
       SectorDescriptor& sector = WearLeveledSectorFromIndex(i);
-      if ((sector.RecoverableBytes(sector_size_bytes) > candidate_bytes) &&
-          !Contains(sectors_to_skip, &sector)) {
+      const size_t recoverable = sector.RecoverableBytes(sector_size_bytes);
+      bool better = recoverable > candidate_bytes;
+#if PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+      better = better || (recoverable == candidate_bytes &&
+                          sector_candidate != nullptr && recoverable > 0 &&
+                          sector.erase_count() <
+                              sector_candidate->erase_count());
+#endif  // PW_KVS_RECORD_SECTOR_ERASE_COUNTS
+      if (better && !Contains(sectors_to_skip, &sector)) {
         sector_candidate = &sector;
-        candidate_bytes = sector.RecoverableBytes(sector_size_bytes);
+        candidate_bytes = recoverable;
       }
     }
   }
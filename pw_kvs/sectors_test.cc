@@ -79,7 +79,51 @@ TEST_F(SectorsTest, NextWritableAddress_PartiallyWrittenSector) {
   EXPECT_EQ(123u, sectors_.NextWritableAddress(*sectors_.begin()));
 }
 
-// TODO(hepler): Add tests for FindSpace, FindSpaceDuringGarbageCollection, and
+TEST_F(SectorsTest, FindSpace_EmptySectors) {
+  SectorDescriptor* sector = nullptr;
+  EXPECT_EQ(OkStatus(), sectors_.FindSpace(&sector, 64, {}));
+  ASSERT_NE(sector, nullptr);
+  EXPECT_EQ(128u, sector->writable_bytes());
+}
+
+TEST_F(SectorsTest, FindSpace_TooLargeForAnySector) {
+  // Fill half of every sector so no sector can hold 96 bytes.
+  for (SectorDescriptor& descriptor : sectors_) {
+    sectors_.RemoveWritableBytes(descriptor, 64);
+  }
+
+  SectorDescriptor* sector = nullptr;
+  EXPECT_EQ(Status::ResourceExhausted(), sectors_.FindSpace(&sector, 96, {}));
+  EXPECT_EQ(sector, nullptr);
+}
+
+TEST_F(SectorsTest, FindSpace_ReusesAppendSector) {
+  // Write to the first sector through the index-maintaining wrapper, so it is
+  // non-empty and preferred for appends over the remaining empty sectors.
+  SectorDescriptor* sector = nullptr;
+  sectors_.RemoveWritableBytes(*sectors_.begin(), 32);
+  ASSERT_EQ(OkStatus(), sectors_.FindSpace(&sector, 64, {}));
+  ASSERT_EQ(sector, sectors_.begin());
+
+  // Repeated appends keep selecting the same sector until it fills up.
+  sectors_.RemoveWritableBytes(*sector, 64);
+  ASSERT_EQ(OkStatus(), sectors_.FindSpace(&sector, 16, {}));
+  EXPECT_EQ(sector, sectors_.begin());
+
+  sectors_.RemoveWritableBytes(*sector, 32);
+  EXPECT_EQ(OkStatus(), sectors_.FindSpace(&sector, 16, {}));
+  EXPECT_NE(sector, sectors_.begin());
+}
+
+TEST_F(SectorsTest, FindSpace_CorruptSectorsHaveNoSpace) {
+  SectorDescriptor* sector = nullptr;
+  for (SectorDescriptor& descriptor : sectors_) {
+    sectors_.MarkCorrupt(descriptor);
+  }
+  EXPECT_EQ(Status::ResourceExhausted(), sectors_.FindSpace(&sector, 1, {}));
+}
+
+// TODO(hepler): Add tests for FindSpaceDuringGarbageCollection and
 // FindSectorToGarbageCollect.
 
 }  // namespace
@@ -0,0 +1,158 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+// Per-drain downsampling stages for log streams. A Filter keeps or drops
+// entries wholesale; high-rate periodic logs instead want *reduced* --
+// 1-in-N sampling or rate caps for a handful of noisy token ids, with full
+// fidelity for everything else. A LogDownsampler sits next to a drain's
+// Filter: the drain consults ShouldForward() per entry, and a few noisy log
+// sites stop dominating uplink bytes without touching their call sites.
+//
+// Suppressed entries are counted per rule so the application can emit
+// periodic summary logs ("token X suppressed N times") via
+// TakeSuppressedCount.
+
+#include <cstdint>
+
+#include "pw_bytes/span.h"
+#include "pw_containers/vector.h"
+#include "pw_log/proto/log.pwpb.h"
+#include "pw_protobuf/decoder.h"
+
+namespace pw::log_rpc {
+
+// Downsampling rules keyed by tokenized-message token id, holding up to
+// `kMaxRules` rules.
+template <size_t kMaxRules>
+class LogDownsampler {
+ public:
+  struct Rule {
+    // Token id of the log site (first 4 bytes of the tokenized message).
+    uint32_t token = 0;
+    // Keep one entry out of every `keep_one_in`; 0 or 1 keeps all.
+    uint16_t keep_one_in = 1;
+    // At most this many entries per second; 0 means unlimited.
+    uint16_t max_per_second = 0;
+
+    // Runtime state.
+    uint16_t seen_in_window = 0;
+    uint32_t window_start_ms = 0;
+    uint32_t sample_counter = 0;
+    uint32_t suppressed = 0;
+  };
+
+  // Installs or replaces the rule for a token. Returns false if the rule
+  // table is full. Typically called from the application's configuration
+  // RPC handler.
+  bool SetRule(uint32_t token, uint16_t keep_one_in, uint16_t max_per_second) {
+    for (Rule& rule : rules_) {
+      if (rule.token == token) {
+        rule.keep_one_in = keep_one_in;
+        rule.max_per_second = max_per_second;
+        return true;
+      }
+    }
+    if (rules_.full()) {
+      return false;
+    }
+    rules_.push_back(Rule{
+        .token = token,
+        .keep_one_in = keep_one_in,
+        .max_per_second = max_per_second,
+    });
+    return true;
+  }
+
+  // Decides whether a proto-encoded LogEntry should be forwarded to the
+  // drain. Entries whose token has no rule -- including non-tokenized
+  // entries -- are always forwarded, so errors and unknown logs keep full
+  // fidelity. `now_ms` is any monotonic millisecond timestamp, used only for
+  // the per-second rate caps.
+  bool ShouldForward(ConstByteSpan entry, uint32_t now_ms) {
+    uint32_t token;
+    if (!ReadToken(entry, token)) {
+      return true;
+    }
+    for (Rule& rule : rules_) {
+      if (rule.token != token) {
+        continue;
+      }
+
+      // 1-in-N sampling.
+      if (rule.keep_one_in > 1) {
+        if (rule.sample_counter++ % rule.keep_one_in != 0) {
+          rule.suppressed += 1;
+          return false;
+        }
+      }
+
+      // Per-second rate cap.
+      if (rule.max_per_second > 0) {
+        if (now_ms - rule.window_start_ms >= 1000) {
+          rule.window_start_ms = now_ms;
+          rule.seen_in_window = 0;
+        }
+        if (rule.seen_in_window >= rule.max_per_second) {
+          rule.suppressed += 1;
+          return false;
+        }
+        rule.seen_in_window += 1;
+      }
+      return true;
+    }
+    return true;
+  }
+
+  // Returns and clears the number of entries suppressed for a token since
+  // the last call, for periodic "suppressed N times" summary emission.
+  uint32_t TakeSuppressedCount(uint32_t token) {
+    for (Rule& rule : rules_) {
+      if (rule.token == token) {
+        const uint32_t count = rule.suppressed;
+        rule.suppressed = 0;
+        return count;
+      }
+    }
+    return 0;
+  }
+
+ private:
+  // Extracts the token id from the entry's tokenized message field.
+  static bool ReadToken(ConstByteSpan entry, uint32_t& token_out) {
+    protobuf::Decoder decoder(entry);
+    while (decoder.Next().ok()) {
+      if (static_cast<log::pwpb::LogEntry::Fields>(decoder.FieldNumber()) !=
+          log::pwpb::LogEntry::Fields::kMessage) {
+        continue;
+      }
+      ConstByteSpan message;
+      if (!decoder.ReadBytes(&message).ok() ||
+          message.size() < sizeof(uint32_t)) {
+        return false;
+      }
+      // Tokenized messages begin with the little-endian token.
+      token_out = static_cast<uint32_t>(message[0]) |
+                  static_cast<uint32_t>(message[1]) << 8 |
+                  static_cast<uint32_t>(message[2]) << 16 |
+                  static_cast<uint32_t>(message[3]) << 24;
+      return true;
+    }
+    return false;
+  }
+
+  Vector<Rule, kMaxRules> rules_;
+};
+
+}  // namespace pw::log_rpc
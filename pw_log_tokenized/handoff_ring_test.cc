@@ -0,0 +1,61 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_log_tokenized/handoff_ring.h"
+
+#include <array>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::log_tokenized {
+namespace {
+
+TEST(HandoffRing, PushAndDrainInOrder) {
+  HandoffRing<8, 16> ring;
+  for (uint8_t i = 0; i < 3; ++i) {
+    std::array<std::byte, 2> entry = {std::byte{i}, std::byte{0xee}};
+    EXPECT_TRUE(ring.TryPush(entry));
+  }
+
+  uint8_t expected = 0;
+  size_t drained = ring.Drain([&expected](ConstByteSpan entry) {
+    ASSERT_EQ(entry.size(), 2u);
+    EXPECT_EQ(entry[0], std::byte{expected});
+    expected += 1;
+  });
+  EXPECT_EQ(drained, 3u);
+  EXPECT_EQ(ring.Drain([](ConstByteSpan) {}), 0u);
+}
+
+TEST(HandoffRing, DropsWhenFullAndRecovers) {
+  HandoffRing<2, 8> ring;
+  const std::array<std::byte, 1> entry = {std::byte{1}};
+  EXPECT_TRUE(ring.TryPush(entry));
+  EXPECT_TRUE(ring.TryPush(entry));
+  EXPECT_FALSE(ring.TryPush(entry));  // Full.
+  EXPECT_EQ(ring.drop_count(), 1u);
+
+  EXPECT_EQ(ring.Drain([](ConstByteSpan) {}), 2u);
+  EXPECT_TRUE(ring.TryPush(entry));  // Space again after draining.
+}
+
+TEST(HandoffRing, DropsOversizedEntries) {
+  HandoffRing<4, 4> ring;
+  const std::array<std::byte, 5> too_big = {};
+  EXPECT_FALSE(ring.TryPush(too_big));
+  EXPECT_EQ(ring.drop_count(), 1u);
+}
+
+}  // namespace
+}  // namespace pw::log_tokenized
@@ -0,0 +1,125 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_log_tokenized/handoff_ring.h
+///
+/// Lock-free staging ring for handing tokenized log messages from any
+/// context, including interrupts on multiple cores, to a single drain task.
+/// Use it in a `pw_log_tokenized_HandleLog` implementation when taking the
+/// `pw_multisink` lock at the log site is not acceptable: log sites push into
+/// the ring lock-free, and a thread-context drain forwards the entries to
+/// `MultiSink::HandleEntry` (or any other consumer), which is where the sink
+/// lock is taken.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "pw_bytes/span.h"
+#include "pw_function/function.h"
+
+namespace pw::log_tokenized {
+
+/// Lock-free multi-producer, single-consumer ring of fixed-size log entries.
+///
+/// Producers claim a slot with a bounded compare-and-swap, copy their
+/// message, and mark the slot committed; a claim only succeeds when space
+/// exists, so a full ring is detected without ever publishing a slot that
+/// must be taken back. The single consumer drains committed entries in
+/// order. When the ring is full, entries are dropped and counted, matching
+/// `pw_multisink`'s drop accounting expectations.
+template <size_t kEntries, size_t kMaxEntrySize>
+class HandoffRing {
+ public:
+  static_assert((kEntries & (kEntries - 1)) == 0,
+                "kEntries must be a power of two");
+
+  constexpr HandoffRing() = default;
+
+  /// Stages one log entry. Lock-free (a claim retries only when another
+  /// producer claims concurrently); callable from any context, including
+  /// interrupts. Returns false if the entry was dropped because it was too
+  /// large or the ring was full.
+  bool TryPush(ConstByteSpan entry) {
+    if (entry.size() > kMaxEntrySize) {
+      drops_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    // Claim a slot only when space exists, bounding head_ with a CAS. A
+    // fetch_add-then-undo scheme is unsound here: between the add and the
+    // undo another producer can claim and commit the next slot, and the
+    // undo would hand that committed slot out again while the abandoned
+    // slot wedges the consumer on committed == false.
+    uint32_t slot = head_.load(std::memory_order_relaxed);
+    do {
+      if (slot - tail_.load(std::memory_order_acquire) >= kEntries) {
+        drops_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    } while (!head_.compare_exchange_weak(slot,
+                                          slot + 1,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed));
+    Slot& storage = slots_[slot & (kEntries - 1)];
+    storage.size = static_cast<uint16_t>(entry.size());
+    std::memcpy(storage.data, entry.data(), entry.size());
+    storage.committed.store(true, std::memory_order_release);
+    return true;
+  }
+
+  /// Forwards all committed entries, in order, to `consumer`. Must only be
+  /// called from one context at a time (the drain task). Returns the number
+  /// of entries drained.
+  size_t Drain(const Function<void(ConstByteSpan)>& consumer) {
+    size_t drained = 0;
+    while (true) {
+      const uint32_t tail = tail_.load(std::memory_order_relaxed);
+      if (head_.load(std::memory_order_acquire) == tail) {
+        return drained;
+      }
+      Slot& storage = slots_[tail & (kEntries - 1)];
+      if (!storage.committed.load(std::memory_order_acquire)) {
+        // A producer claimed this slot but has not finished copying; entries
+        // after it must wait to preserve ordering.
+        return drained;
+      }
+      consumer(ConstByteSpan(storage.data, storage.size));
+      storage.committed.store(false, std::memory_order_relaxed);
+      tail_.store(tail + 1, std::memory_order_release);
+      drained += 1;
+    }
+  }
+
+  /// The number of entries dropped because the ring was full or the entry
+  /// was too large.
+  uint32_t drop_count() const {
+    return drops_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    std::atomic<bool> committed{false};
+    uint16_t size = 0;
+    std::byte data[kMaxEntrySize];
+  };
+
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> drops_{0};
+  Slot slots_[kEntries];
+};
+
+}  // namespace pw::log_tokenized
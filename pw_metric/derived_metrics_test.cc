@@ -0,0 +1,63 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_metric/derived_metrics.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::metric {
+namespace {
+
+TEST(Histogram, RecordsSamplesInBuckets) {
+  Histogram<3> histogram(0x123, {10, 100, 1000});
+
+  histogram.Record(5);
+  histogram.Record(10);    // Bounds are inclusive.
+  histogram.Record(50);
+  histogram.Record(999);
+  histogram.Record(5000);  // Overflow.
+
+  EXPECT_EQ(histogram.count(0), 2u);
+  EXPECT_EQ(histogram.count(1), 1u);
+  EXPECT_EQ(histogram.count(2), 1u);
+  EXPECT_EQ(histogram.overflow_count(), 1u);
+
+  // The group exposes one metric per bucket plus overflow, named by bound.
+  size_t metrics = 0;
+  uint32_t first_name = 0;
+  for (const auto& metric : histogram.group().metrics()) {
+    if (metrics == 0) {
+      first_name = metric.name();
+    }
+    metrics += 1;
+  }
+  EXPECT_EQ(metrics, 4u);
+  EXPECT_EQ(first_name, 10u);  // Ascending order: first bucket listed first.
+}
+
+TEST(EwmaMetric, SmoothsSamples) {
+  EwmaMetric<2> average(0x456);  // avg += (sample - avg) / 4
+
+  average.Record(100.0f);  // First sample seeds the average.
+  EXPECT_EQ(average.value(), 100.0f);
+
+  average.Record(200.0f);
+  EXPECT_EQ(average.value(), 125.0f);
+
+  average.Record(125.0f);
+  EXPECT_EQ(average.value(), 125.0f);
+}
+
+}  // namespace
+}  // namespace pw::metric
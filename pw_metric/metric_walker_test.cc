@@ -0,0 +1,145 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_metric_private/metric_walker.h"
+
+#include "pw_metric/metric.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::metric {
+namespace {
+
+// Counts the metrics written.
+class CountingWriter : public internal::MetricWriter {
+ public:
+  Status Write(const Metric&, const Vector<Token>&) override {
+    count += 1;
+    return OkStatus();
+  }
+
+  int count = 0;
+};
+
+// Records written paths and values for verification.
+class RecordingWriter : public internal::MetricWriter {
+ public:
+  Status Write(const Metric& metric, const Vector<Token>& path) override {
+    if (count < kMaxRecorded) {
+      path_sizes[count] = path.size();
+      leaf_tokens[count] = path.back();
+      values[count] = metric.as_int();
+    }
+    count += 1;
+    return OkStatus();
+  }
+
+  static constexpr size_t kMaxRecorded = 8;
+  size_t path_sizes[kMaxRecorded] = {};
+  Token leaf_tokens[kMaxRecorded] = {};
+  uint32_t values[kMaxRecorded] = {};
+  size_t count = 0;
+};
+
+TEST(FrozenMetricTree, ReplaysTreeWithoutTraversal) {
+  PW_METRIC_GROUP(root, "root");
+  PW_METRIC(root, metric_a, "a", 1u);
+  PW_METRIC(root, metric_b, "b", 2u);
+
+  internal::FrozenMetricTree<8> frozen;
+  // Freeze via the group list form used by the services.
+  IntrusiveList<Group> groups;
+  groups.push_back(root);
+  ASSERT_EQ(OkStatus(), frozen.Freeze(IntrusiveList<Metric>(), groups));
+  EXPECT_EQ(frozen.size(), 2u);
+  groups.clear();
+
+  RecordingWriter writer;
+  ASSERT_EQ(OkStatus(), frozen.Walk(writer));
+  EXPECT_EQ(writer.count, 2u);
+  EXPECT_EQ(writer.path_sizes[0], 2u);  // root/<metric>
+
+  // Value reads go through the live metric pointers: updates after freezing
+  // are visible without re-freezing.
+  metric_a.Increment();
+  metric_b.Increment();
+  RecordingWriter after;
+  ASSERT_EQ(OkStatus(), frozen.Walk(after));
+  EXPECT_EQ(after.values[0] + after.values[1],
+            writer.values[0] + writer.values[1] + 2);
+}
+
+TEST(FrozenMetricTree, OverflowReportsResourceExhausted) {
+  PW_METRIC_GROUP(root, "root");
+  PW_METRIC(root, metric_a, "a", 1u);
+  PW_METRIC(root, metric_b, "b", 2u);
+  PW_METRIC(root, metric_c, "c", 3u);
+
+  internal::FrozenMetricTree<2> frozen;
+  IntrusiveList<Group> groups;
+  groups.push_back(root);
+  EXPECT_EQ(Status::ResourceExhausted(),
+            frozen.Freeze(IntrusiveList<Metric>(), groups));
+  EXPECT_EQ(frozen.size(), 0u);
+  groups.clear();
+}
+
+TEST(DeltaMetricWriter, OnlyWritesChangedMetrics) {
+  PW_METRIC_GROUP(root, "root");
+  PW_METRIC(root, metric_a, "a", 1u);
+  PW_METRIC(root, metric_b, "b", 2u);
+
+  CountingWriter writer;
+  std::array<internal::DeltaMetricWriter::CachedValue, 8> cache = {};
+  internal::DeltaMetricWriter delta(writer, cache);
+  internal::MetricWalker walker(delta);
+
+  // First walk exports everything.
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 2);
+
+  // No changes: nothing is exported.
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 2);
+
+  // Only the changed metric is exported.
+  metric_a.Increment();
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 3);
+
+  // Reset forces a full export.
+  delta.Reset();
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 5);
+}
+
+TEST(DeltaMetricWriter, FullCacheFallsBackToAlwaysWriting) {
+  PW_METRIC_GROUP(root, "root");
+  PW_METRIC(root, metric_a, "a", 1u);
+  PW_METRIC(root, metric_b, "b", 2u);
+
+  CountingWriter writer;
+  std::array<internal::DeltaMetricWriter::CachedValue, 1> cache = {};
+  internal::DeltaMetricWriter delta(writer, cache);
+  internal::MetricWalker walker(delta);
+
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 2);
+
+  // The uncached metric is conservatively re-exported every walk.
+  ASSERT_EQ(OkStatus(), walker.Walk(root));
+  EXPECT_EQ(writer.count, 3);
+}
+
+}  // namespace
+}  // namespace pw::metric
@@ -0,0 +1,115 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_metric/derived_metrics.h
+///
+/// Metric types derived from the basic counter and float metrics: histograms
+/// and exponentially weighted moving averages. Both are built from ordinary
+/// `Metric` leaves, so they export through the existing walkers, services,
+/// and wire format with no protocol changes.
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "pw_metric/metric.h"
+
+namespace pw::metric {
+
+/// A fixed-bucket histogram exported as a `Group` of counter metrics.
+///
+/// Each bucket counts samples less than or equal to its upper bound, with a
+/// final overflow bucket for larger samples. Bucket metrics are named by
+/// their upper bound value rather than a tokenized string (and the overflow
+/// bucket by the maximum `Token` value), so dashboards can recover the bucket
+/// boundaries directly from the metric names.
+template <size_t kNumBuckets>
+class Histogram {
+ public:
+  static_assert(kNumBuckets > 0);
+
+  /// @param[in] name Token for the histogram's group.
+  /// @param[in] upper_bounds Ascending upper bounds for each bucket; samples
+  /// greater than the last bound land in the overflow bucket.
+  Histogram(Token name, const std::array<uint32_t, kNumBuckets>& upper_bounds)
+      : group_(name), upper_bounds_(upper_bounds), overflow_(kOverflowToken, 0u) {
+    // Buckets are added in reverse so they are listed in ascending order.
+    group_.Add(overflow_);
+    for (size_t i = kNumBuckets; i > 0; --i) {
+      buckets_[i - 1].emplace(static_cast<Token>(upper_bounds_[i - 1]), 0u);
+      group_.Add(*buckets_[i - 1]);
+    }
+  }
+
+  /// Records a sample in the appropriate bucket.
+  void Record(uint32_t sample) {
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      if (sample <= upper_bounds_[i]) {
+        buckets_[i]->Increment();
+        return;
+      }
+    }
+    overflow_.Increment();
+  }
+
+  /// The count in the bucket at the provided index.
+  uint32_t count(size_t bucket) const { return buckets_[bucket]->value(); }
+
+  /// The count of samples above the last bucket bound.
+  uint32_t overflow_count() const { return overflow_.value(); }
+
+  /// The group holding the bucket metrics; add it to a parent group or pass
+  /// it to a walker to export the histogram.
+  Group& group() { return group_; }
+
+ private:
+  static constexpr Token kOverflowToken =
+      std::numeric_limits<Token>::max() & 0x7fff'ffffu;
+
+  Group group_;
+  std::array<uint32_t, kNumBuckets> upper_bounds_;
+  std::array<std::optional<TypedMetric<uint32_t>>, kNumBuckets> buckets_;
+  TypedMetric<uint32_t> overflow_;
+};
+
+/// An exponentially weighted moving average exported as a float metric.
+///
+/// The average is updated as `avg += (sample - avg) / 2^kLogFactor`, so a
+/// larger `kLogFactor` gives a smoother, slower-moving average. The first
+/// sample initializes the average.
+template <uint8_t kLogFactor = 3>
+class EwmaMetric : public TypedMetric<float> {
+ public:
+  constexpr EwmaMetric(Token name) : TypedMetric<float>(name, 0.0f) {}
+  EwmaMetric(Token name, IntrusiveList<Metric>& metrics)
+      : TypedMetric<float>(name, 0.0f, metrics) {}
+
+  /// Folds a sample into the moving average.
+  void Record(float sample) {
+    if (!seeded_) {
+      seeded_ = true;
+      Set(sample);
+      return;
+    }
+    const float average = value();
+    Set(average + (sample - average) / static_cast<float>(1u << kLogFactor));
+  }
+
+ private:
+  bool seeded_ = false;
+};
+
+}  // namespace pw::metric
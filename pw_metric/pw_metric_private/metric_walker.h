@@ -13,11 +13,16 @@
 // the License.
 #pragma once
 
+#include <array>
+#include <cstddef>
+
 #include "pw_assert/check.h"
 #include "pw_containers/intrusive_list.h"
 #include "pw_containers/vector.h"
 #include "pw_metric/metric.h"
+#include "pw_span/span.h"
 #include "pw_status/status.h"
+#include "pw_status/try.h"
 #include "pw_tokenizer/tokenize.h"
 
 namespace pw::metric::internal {
@@ -72,4 +77,154 @@ class MetricWalker {
   MetricWriter& writer_;
 };
 
+// Flat, cache-friendly snapshot of a metric tree, for hot export paths.
+//
+// A MetricWalker rebuilds every token path recursively on each export; with
+// hundreds of metrics the pointer-chasing walk dominates export time.
+// FrozenMetricTree captures the walk once -- after boot-time registration
+// completes -- into a flat array of (pre-concatenated token path, metric
+// pointer) entries, so each subsequent export is a linear scan over one
+// array with no recursion in the service handler.
+//
+// The snapshot holds raw Metric pointers: metrics and groups must not be
+// added, removed, or destroyed while frozen. Re-run Freeze after any
+// registration change.
+template <size_t kMaxMetrics>
+class FrozenMetricTree {
+ public:
+  static constexpr size_t kMaxPathDepth = 4;
+
+  // Captures the current tree. Returns RESOURCE_EXHAUSTED if more than
+  // kMaxMetrics metrics exist (the snapshot is cleared).
+  Status Freeze(const IntrusiveList<Metric>& metrics,
+                const IntrusiveList<Group>& groups) {
+    count_ = 0;
+    Capturer capturer(*this);
+    MetricWalker walker(capturer);
+    Status status;
+    status.Update(walker.Walk(metrics));
+    status.Update(walker.Walk(groups));
+    if (!status.ok()) {
+      count_ = 0;
+    }
+    return status;
+  }
+
+  // Replays the frozen entries to `writer` in capture order: one linear
+  // pass, no tree traversal.
+  Status Walk(MetricWriter& writer) const {
+    Vector<Token, kMaxPathDepth> path;
+    for (size_t i = 0; i < count_; ++i) {
+      const Entry& entry = entries_[i];
+      path.clear();
+      for (size_t depth = 0; depth < entry.path_size; ++depth) {
+        path.push_back(entry.path[depth]);
+      }
+      PW_TRY(writer.Write(*entry.metric, path));
+    }
+    return OkStatus();
+  }
+
+  size_t size() const { return count_; }
+
+ private:
+  struct Entry {
+    std::array<Token, kMaxPathDepth> path;
+    size_t path_size;
+    const Metric* metric;
+  };
+
+  // MetricWriter that records entries instead of exporting them.
+  class Capturer : public MetricWriter {
+   public:
+    explicit Capturer(FrozenMetricTree& tree) : tree_(tree) {}
+
+    Status Write(const Metric& metric, const Vector<Token>& path) override {
+      if (tree_.count_ >= kMaxMetrics || path.size() > kMaxPathDepth) {
+        return Status::ResourceExhausted();
+      }
+      Entry& entry = tree_.entries_[tree_.count_++];
+      entry.path_size = path.size();
+      for (size_t i = 0; i < path.size(); ++i) {
+        entry.path[i] = path[i];
+      }
+      entry.metric = &metric;
+      return OkStatus();
+    }
+
+   private:
+    FrozenMetricTree& tree_;
+  };
+
+  std::array<Entry, kMaxMetrics> entries_;
+  size_t count_ = 0;
+};
+
+// MetricWriter decorator that forwards only metrics whose value changed
+// since the previous walk, for cheap periodic "delta" exports. Previous
+// values are kept in a caller-provided cache keyed by a hash of the metric's
+// token path; if the cache fills, further metrics are always forwarded
+// (conservatively treating them as changed).
+//
+// Note on snapshot consistency: each metric is a single word, so individual
+// reads are atomic, but a walk concurrent with updates may observe different
+// metrics at different instants. Callers needing a mutually consistent
+// snapshot must quiesce updaters around the walk.
+class DeltaMetricWriter : public MetricWriter {
+ public:
+  struct CachedValue {
+    uint32_t path_hash;
+    uint32_t value;
+  };
+
+  DeltaMetricWriter(MetricWriter& writer, span<CachedValue> cache)
+      : writer_(writer), cache_(cache) {}
+
+  Status Write(const Metric& metric, const Vector<Token>& path) override {
+    const uint32_t path_hash = HashPath(path);
+    const uint32_t value = metric.is_float()
+                               ? FloatBits(metric.as_float())
+                               : metric.as_int();
+    for (size_t i = 0; i < used_; ++i) {
+      if (cache_[i].path_hash == path_hash) {
+        if (cache_[i].value == value) {
+          return OkStatus();  // Unchanged; skip.
+        }
+        cache_[i].value = value;
+        return writer_.Write(metric, path);
+      }
+    }
+    if (used_ < cache_.size()) {
+      cache_[used_++] = CachedValue{path_hash, value};
+    }
+    return writer_.Write(metric, path);
+  }
+
+  // Clears the cache, so the next walk exports every metric.
+  void Reset() { used_ = 0; }
+
+ private:
+  static uint32_t HashPath(const Vector<Token>& path) {
+    uint32_t hash = 2166136261u;  // FNV-1a over the token path.
+    for (Token token : path) {
+      for (int shift = 0; shift < 32; shift += 8) {
+        hash ^= (token >> shift) & 0xFFu;
+        hash *= 16777619u;
+      }
+    }
+    return hash;
+  }
+
+  static uint32_t FloatBits(float value) {
+    uint32_t bits;
+    static_assert(sizeof(bits) == sizeof(value));
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  MetricWriter& writer_;
+  span<CachedValue> cache_;
+  size_t used_ = 0;
+};
+
 }  // namespace pw::metric::internal
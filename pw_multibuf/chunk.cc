@@ -206,6 +206,18 @@ void Chunk::Slice(size_t begin, size_t end) {
 
 void Chunk::Truncate(size_t len) { Slice(0, len); }
 
+std::optional<OwnedChunk> Chunk::Clone() {
+  void* new_chunk_memory = region_tracker_->AllocateChunkClass();
+  if (new_chunk_memory == nullptr) {
+    return std::nullopt;
+  }
+
+  std::lock_guard lock(region_tracker_->lock_);
+  Chunk* new_chunk = new (new_chunk_memory) Chunk(region_tracker_, span_);
+  InsertBeforeInRegionList(new_chunk);
+  return OwnedChunk(new_chunk);
+}
+
 std::optional<OwnedChunk> Chunk::TakePrefix(size_t bytes_to_take) {
   void* new_chunk_memory = region_tracker_->AllocateChunkClass();
   if (new_chunk_memory == nullptr) {
@@ -227,6 +227,18 @@ std::optional<MultiBuf> MultiBuf::TakePrefix(size_t bytes_to_take) {
   return std::nullopt;
 }
 
+std::optional<MultiBuf> MultiBuf::Clone() {
+  MultiBuf result;
+  for (Chunk& chunk : Chunks()) {
+    std::optional<OwnedChunk> cloned = chunk.Clone();
+    if (!cloned.has_value()) {
+      return std::nullopt;  // Any already-cloned chunks are released.
+    }
+    result.PushBackChunk(std::move(*cloned));
+  }
+  return result;
+}
+
 std::optional<MultiBuf> MultiBuf::TakeSuffix(size_t bytes_to_take) {
   size_t front_size = size() - bytes_to_take;
   std::optional<MultiBuf> front_opt = TakePrefix(front_size);
@@ -263,6 +263,40 @@ TEST(MultiBuf, TruncateEmptyBuffer) {
   EXPECT_TRUE(buf.empty());
 }
 
+TEST(MultiBuf, CloneSharesBytesWithoutCopying) {
+  AllocatorForTest<kArbitraryAllocatorSize> allocator;
+  MultiBuf buf;
+  buf.PushBackChunk(MakeChunk(allocator, {1_b, 2_b}));
+  buf.PushBackChunk(MakeChunk(allocator, {3_b, 4_b, 5_b}));
+
+  std::optional<MultiBuf> clone = buf.Clone();
+  ASSERT_TRUE(clone.has_value());
+  ExpectElementsEqual(*clone, {1_b, 2_b, 3_b, 4_b, 5_b});
+  ExpectElementsEqual(buf, {1_b, 2_b, 3_b, 4_b, 5_b});
+
+  // The clone references the same memory, not a copy.
+  EXPECT_EQ(clone->Chunks().front().data(), buf.Chunks().front().data());
+
+  // Slicing the clone does not affect the original.
+  clone->Slice(1, 4);
+  ExpectElementsEqual(*clone, {2_b, 3_b, 4_b});
+  ExpectElementsEqual(buf, {1_b, 2_b, 3_b, 4_b, 5_b});
+}
+
+TEST(MultiBuf, CloneKeepsRegionAliveAfterOriginalIsReleased) {
+  AllocatorForTest<kArbitraryAllocatorSize> allocator;
+  std::optional<MultiBuf> clone;
+  {
+    MultiBuf buf;
+    buf.PushBackChunk(MakeChunk(allocator, {7_b, 8_b}));
+    clone = buf.Clone();
+    ASSERT_TRUE(clone.has_value());
+  }
+  // The original is gone, but the clone still reads the shared region.
+  ExpectElementsEqual(*clone, {7_b, 8_b});
+  clone = std::nullopt;
+}
+
 TEST(MultiBuf, TakePrefixWithNoBytesDoesNothing) {
   AllocatorForTest<kArbitraryAllocatorSize> allocator;
   MultiBuf buf;
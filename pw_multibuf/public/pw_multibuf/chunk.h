@@ -170,6 +170,19 @@ class Chunk {
   /// This method will acquire a mutex and is not IRQ safe.
   std::optional<OwnedChunk> TakeSuffix(size_t bytes_to_take);
 
+  /// Creates another `Chunk` referencing the same bytes of the same region,
+  /// without copying. The clone shares the region's reference count, so the
+  /// region is released only when every chunk referencing it (including
+  /// clones) is released. Cloned chunks alias the same memory: they are
+  /// intended for read-mostly sharing (e.g. fanning one received buffer out
+  /// to several consumers), and `Claim`/`Merge` operations on aliased regions
+  /// will conservatively fail rather than expand into bytes another clone can
+  /// see.
+  ///
+  /// If the inner call to `AllocateChunkClass` fails, this function will
+  /// return `std::nullopt`.
+  std::optional<OwnedChunk> Clone();
+
  private:
   Chunk(ChunkRegionTracker* region_tracker, ByteSpan span)
       : region_tracker_(region_tracker),
@@ -406,6 +406,15 @@ class MultiBuf : private MultiBufChunks {
   /// This method will acquire a mutex and is not IRQ safe.
   std::optional<MultiBuf> TakeSuffix(size_t bytes_to_take);
 
+  /// Creates a new `MultiBuf` referencing the same bytes as this one without
+  /// copying, by cloning every chunk. The underlying regions are freed only
+  /// when all referencing `MultiBuf`s are released. See `Chunk::Clone` for
+  /// the aliasing caveats.
+  ///
+  /// Returns `std::nullopt` if chunk metadata allocation fails, in which case
+  /// this `MultiBuf` is unchanged.
+  std::optional<MultiBuf> Clone();
+
   /// Pushes `front` onto the front of this `MultiBuf`.
   ///
   /// This operation does not move any data and is `O(front.Chunks().size())`.
@@ -13,6 +13,8 @@
 // the License.
 #include "pw_multisink/multisink.h"
 
+#include <array>
+
 #include <cstring>
 
 #include "pw_assert/check.h"
@@ -28,19 +30,42 @@ namespace pw {
 namespace multisink {
 
 void MultiSink::HandleEntry(ConstByteSpan entry) {
+#if PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+  // Keep the producer critical section limited to the push itself; see
+  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK in config.h.
+  {
+    std::lock_guard lock(lock_);
+    const Status push_back_status =
+        ring_buffer_.PushBack(entry, sequence_id_++);
+    PW_DCHECK_OK(push_back_status);
+  }
+  NotifyListenersRelaxed();
+#else
   std::lock_guard lock(lock_);
   const Status push_back_status = ring_buffer_.PushBack(entry, sequence_id_++);
   PW_DCHECK_OK(push_back_status);
   NotifyListeners();
+#endif  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
 }
 
 void MultiSink::HandleDropped(uint32_t drop_count) {
+#if PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+  {
+    std::lock_guard lock(lock_);
+    // Updating the sequence ID helps identify where the ingress drop happend
+    // when a drain peeks or pops.
+    sequence_id_ += drop_count;
+    total_ingress_drops_ += drop_count;
+  }
+  NotifyListenersRelaxed();
+#else
   std::lock_guard lock(lock_);
   // Updating the sequence ID helps identify where the ingress drop happend when
   // a drain peeks or pops.
   sequence_id_ += drop_count;
   total_ingress_drops_ += drop_count;
   NotifyListeners();
+#endif  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
 }
 
 Status MultiSink::PopEntry(Drain& drain, const Drain::PeekedEntry& entry) {
@@ -91,6 +116,59 @@ Result<ConstByteSpan> MultiSink::PeekOrPopEntry(
   std::lock_guard lock(lock_);
   PW_DCHECK_PTR_EQ(drain.multisink_, this);
 
+  // Accumulates drop counts for `entry_sequence_id`, splitting the sequence
+  // gap into ingress drops (shared across drains) and drain drops. Called
+  // once per visited entry, including entries consumed by the drain's
+  // filter, so accounting is identical with and without filtering.
+  const auto accumulate_drops = [&](uint32_t entry_sequence_id,
+                                    bool successful_read)
+                                    PW_NO_LOCK_SAFETY_ANALYSIS {
+    // Consecutive successful reads will always differ by one at least, so it
+    // is subtracted out. If the read was not successful, the difference is
+    // not adjusted.
+    uint32_t new_drops = entry_sequence_id -
+                         drain.last_handled_sequence_id_ -
+                         (successful_read ? 1 : 0);
+    if (new_drops > 0) {
+      // Only report the ingress drop count when the drain catches up to
+      // where the drop happened, accounting only for the drops found and no
+      // more, as indicated by the gap in sequence IDs.
+      const uint32_t new_ingress_drops = std::min(
+          new_drops,
+          total_ingress_drops_ - drain.last_handled_ingress_drop_count_);
+      // Remove the ingress drop count duplicated in new_drops.
+      new_drops -= new_ingress_drops;
+      // Check if all the ingress drops were reported.
+      drain.last_handled_ingress_drop_count_ =
+          total_ingress_drops_ > new_ingress_drops
+              ? total_ingress_drops_ - new_ingress_drops
+              : total_ingress_drops_;
+      ingress_drop_count_out += new_ingress_drops;
+      drain_drop_count_out += new_drops;
+    }
+  };
+
+  // Consume entries rejected by the drain's filter without copying their
+  // payloads: only a short prefix is peeked for the filter decision.
+  if (drain.filter_ != nullptr) {
+    std::array<std::byte, PW_MULTISINK_CONFIG_FILTER_PREFIX_BYTES> prefix;
+    while (true) {
+      size_t prefix_bytes = 0;
+      uint32_t prefix_sequence_id = 0;
+      if (!drain.reader_
+               .PeekFrontPrefix(prefix, prefix_bytes, prefix_sequence_id)
+               .ok()) {
+        break;  // Defer error/empty handling to the main path below.
+      }
+      if (drain.filter_(ConstByteSpan(prefix.data(), prefix_bytes))) {
+        break;
+      }
+      accumulate_drops(prefix_sequence_id, /* successful_read= */ true);
+      PW_CHECK(drain.reader_.PopFront().ok());
+      drain.last_handled_sequence_id_ = prefix_sequence_id;
+    }
+  }
+
   const Status peek_status = drain.reader_.PeekFrontWithPreamble(
       buffer, entry_sequence_id_out, bytes_read);
 
@@ -108,30 +186,7 @@ Result<ConstByteSpan> MultiSink::PeekOrPopEntry(
 
   // Compute the drop count delta by comparing this entry's sequence ID with the
   // last sequence ID this drain successfully read.
-  //
-  // The drop count calculation simply computes the difference between the
-  // current and last sequence IDs. Consecutive successful reads will always
-  // differ by one at least, so it is subtracted out. If the read was not
-  // successful, the difference is not adjusted.
-  drain_drop_count_out = entry_sequence_id_out -
-                         drain.last_handled_sequence_id_ -
-                         (peek_status.ok() ? 1 : 0);
-
-  // Only report the ingress drop count when the drain catches up to where the
-  // drop happened, accounting only for the drops found and no more, as
-  // indicated by the gap in sequence IDs.
-  if (drain_drop_count_out > 0) {
-    ingress_drop_count_out =
-        std::min(drain_drop_count_out,
-                 total_ingress_drops_ - drain.last_handled_ingress_drop_count_);
-    // Remove the ingress drop count duplicated in drain_drop_count_out.
-    drain_drop_count_out -= ingress_drop_count_out;
-    // Check if all the ingress drops were reported.
-    drain.last_handled_ingress_drop_count_ =
-        total_ingress_drops_ > ingress_drop_count_out
-            ? total_ingress_drops_ - ingress_drop_count_out
-            : total_ingress_drops_;
-  }
+  accumulate_drops(entry_sequence_id_out, peek_status.ok());
 
   // The Peek above may have failed due to OutOfRange, now that we've set the
   // drop count see if we should return before attempting to pop.
@@ -196,6 +251,14 @@ void MultiSink::NotifyListeners() {
   }
 }
 
+#if PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+void MultiSink::NotifyListenersRelaxed() {
+  for (auto& listener : listeners_) {
+    listener.OnNewEntryAvailable();
+  }
+}
+#endif  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+
 Status MultiSink::UnsafeForEachEntry(
     const Function<void(ConstByteSpan)>& callback, size_t max_num_entries) {
   MultiSink::UnsafeIterationWrapper multisink_iteration = UnsafeIteration();
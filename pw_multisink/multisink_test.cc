@@ -151,6 +151,66 @@ class MultiSinkTest : public ::testing::Test {
   MultiSink multisink_;
 };
 
+TEST_F(MultiSinkTest, FilteredDrainSkipsEntriesWithoutDelivery) {
+  multisink_.AttachDrain(drains_[0]);
+
+  // Reject entries whose first byte is 0xDE (kMessage); accept others.
+  drains_[0].SetFilter([](ConstByteSpan prefix) {
+    return prefix.empty() || prefix[0] != std::byte{0xDE};
+  });
+
+  multisink_.HandleEntry(kMessage);       // Filtered out.
+  multisink_.HandleEntry(kMessageOther);  // Delivered.
+  multisink_.HandleEntry(kMessage);       // Filtered out.
+
+  uint32_t drop_count = 0;
+  uint32_t ingress_drop_count = 0;
+  Result<ConstByteSpan> result =
+      drains_[0].PopEntry(entry_buffer_, drop_count, ingress_drop_count);
+  ExpectMessageAndDropCounts(
+      result, drop_count, ingress_drop_count, kMessageOther, 0u, 0u);
+
+  // Only the filtered entry remains; the drain reports empty, not drops.
+  result = drains_[0].PopEntry(entry_buffer_, drop_count, ingress_drop_count);
+  EXPECT_EQ(result.status(), Status::OutOfRange());
+  EXPECT_EQ(drop_count, 0u);
+  EXPECT_EQ(ingress_drop_count, 0u);
+}
+
+TEST_F(MultiSinkTest, FilterRemovalRestoresDelivery) {
+  multisink_.AttachDrain(drains_[0]);
+  drains_[0].SetFilter([](ConstByteSpan) { return false; });
+
+  multisink_.HandleEntry(kMessage);
+  uint32_t drop_count = 0;
+  uint32_t ingress_drop_count = 0;
+  Result<ConstByteSpan> result =
+      drains_[0].PopEntry(entry_buffer_, drop_count, ingress_drop_count);
+  EXPECT_EQ(result.status(), Status::OutOfRange());
+
+  drains_[0].SetFilter(nullptr);
+  multisink_.HandleEntry(kMessageOther);
+  result = drains_[0].PopEntry(entry_buffer_, drop_count, ingress_drop_count);
+  ExpectMessageAndDropCounts(
+      result, drop_count, ingress_drop_count, kMessageOther, 0u, 0u);
+}
+
+TEST_F(MultiSinkTest, FilterOnOneDrainDoesNotAffectOthers) {
+  multisink_.AttachDrain(drains_[0]);
+  multisink_.AttachDrain(drains_[1]);
+  drains_[0].SetFilter([](ConstByteSpan) { return false; });
+
+  multisink_.HandleEntry(kMessage);
+  uint32_t drop_count = 0;
+  uint32_t ingress_drop_count = 0;
+
+  // The unfiltered drain still receives the entry.
+  Result<ConstByteSpan> result =
+      drains_[1].PopEntry(entry_buffer_, drop_count, ingress_drop_count);
+  ExpectMessageAndDropCounts(
+      result, drop_count, ingress_drop_count, kMessage, 0u, 0u);
+}
+
 TEST_F(MultiSinkTest, SingleDrain) {
   multisink_.AttachDrain(drains_[0]);
   multisink_.AttachListener(listeners_[0]);
@@ -40,6 +40,28 @@
 #endif
 #endif  // PW_MULTISINK_CONFIG_LOCK_TYPE
 
+// When enabled, HandleEntry and HandleDropped release the lock before
+// notifying listeners, so the producer's critical section covers only the
+// ring-buffer push and listener callbacks run without the sink lock held.
+// This bounds the time drains can be blocked by a producer and allows
+// listeners to drain inline. With multiple producers, a notification may be
+// delivered after another producer has already pushed a newer entry;
+// listeners must already tolerate spurious notifications (AttachListener
+// notifies immediately), so this only affects notification timing.
+//
+// Precondition: listeners must not be attached or detached while producers
+// are running, since the listener list is walked without the lock.
+#ifndef PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+#define PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK 0
+#endif  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+
+// The number of leading entry bytes peeked and handed to a drain's filter
+// (see Drain::SetFilter). Large enough for the packed metadata fields at the
+// front of tokenized log entries; raise it if filters need deeper prefixes.
+#ifndef PW_MULTISINK_CONFIG_FILTER_PREFIX_BYTES
+#define PW_MULTISINK_CONFIG_FILTER_PREFIX_BYTES 16
+#endif  // PW_MULTISINK_CONFIG_FILTER_PREFIX_BYTES
+
 static_assert(PW_MULTISINK_CONFIG_LOCK_TYPE ==
                   PW_MULTISINK_INTERRUPT_SPIN_LOCK ||
               PW_MULTISINK_CONFIG_LOCK_TYPE == PW_MULTISINK_MUTEX ||
@@ -198,6 +198,22 @@ class MultiSink {
                                   uint32_t& ingress_drop_count_out)
         PW_LOCKS_EXCLUDED(multisink_->lock_);
 
+    // Installs a filter evaluated against the first
+    // PW_MULTISINK_CONFIG_FILTER_PREFIX_BYTES bytes of each entry before the
+    // payload is copied out. Entries for which the filter returns false are
+    // consumed (popped and counted as handled) without ever being copied, so
+    // a drain interested in a small subset (e.g. WARN-and-above on a
+    // bandwidth-constrained uplink) skips the rest at prefix-peek cost.
+    //
+    // The filter runs under the multisink's lock on every entry this drain
+    // visits: it must be fast and must not block or re-enter the multisink.
+    // Filtered entries are not reported as drops. Pass nullptr to remove.
+    void SetFilter(Function<bool(ConstByteSpan entry_prefix)>&& filter)
+        PW_LOCKS_EXCLUDED(multisink_->lock_) {
+      std::lock_guard lock(multisink_->lock_);
+      filter_ = std::move(filter);
+    }
+
     // Drains are not copyable or movable.
     Drain(const Drain&) = delete;
     Drain& operator=(const Drain&) = delete;
@@ -233,6 +249,7 @@ class MultiSink {
     // The `reader_` and `last_handled_sequence_id_` are managed by attached
     // multisink and are guarded by `multisink_->lock_` when used.
     ring_buffer::PrefixedEntryRingBufferMulti::Reader reader_;
+    Function<bool(ConstByteSpan)> filter_;
     uint32_t last_handled_sequence_id_;
     uint32_t last_peek_sequence_id_;
     uint32_t last_handled_ingress_drop_count_;
@@ -467,6 +484,13 @@ class MultiSink {
   // Notifies attached listeners of new entries or an updated drop count.
   void NotifyListeners() PW_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
+#if PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+  // Walks the listener list without holding lock_. Requires that listeners
+  // are not attached or detached concurrently with producers; see
+  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK in config.h.
+  void NotifyListenersRelaxed() PW_NO_LOCK_SAFETY_ANALYSIS;
+#endif  // PW_MULTISINK_CONFIG_NOTIFY_LISTENERS_OUTSIDE_LOCK
+
   LockType lock_;
   IntrusiveList<Listener> listeners_ PW_GUARDED_BY(lock_);
   ring_buffer::PrefixedEntryRingBufferMulti ring_buffer_ PW_GUARDED_BY(lock_);
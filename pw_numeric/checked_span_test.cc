@@ -0,0 +1,96 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_numeric/checked_span.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "pw_unit_test/framework.h"
+
+namespace {
+
+TEST(CheckedAccumulate, SumsWithoutOverflow) {
+  constexpr std::array<uint32_t, 4> values = {1, 2, 3, 4};
+  constexpr auto sum = pw::CheckedAccumulate<uint32_t>(values);
+  static_assert(sum.has_value() && sum.value() == 10u);
+  EXPECT_EQ(pw::CheckedAccumulate<uint32_t>(values).value(), 10u);
+}
+
+TEST(CheckedAccumulate, EmptySpanIsZero) {
+  EXPECT_EQ(pw::CheckedAccumulate<int32_t>(pw::span<const int32_t>()).value(),
+            0);
+}
+
+TEST(CheckedAccumulate, ReportsUnsignedOverflow) {
+  const std::array<uint8_t, 3> values = {200, 100, 1};
+  EXPECT_FALSE(pw::CheckedAccumulate<uint8_t>(values).has_value());
+}
+
+TEST(CheckedAccumulate, ReportsSignedOverflow) {
+  const std::array<int16_t, 2> values = {std::numeric_limits<int16_t>::max(),
+                                         1};
+  EXPECT_FALSE(pw::CheckedAccumulate<int16_t>(values).has_value());
+}
+
+TEST(CheckedAccumulate, OverflowMidSpanIsNotMaskedByLaterElements) {
+  // The running sum wraps at element 1; a later negative element would bring
+  // the wrapped value back in range, but the overflow must still be reported.
+  const std::array<int8_t, 3> values = {127, 1, -10};
+  EXPECT_FALSE(pw::CheckedAccumulate<int8_t>(values).has_value());
+}
+
+TEST(SaturatingAccumulate, ClampsToMax) {
+  const std::array<uint8_t, 3> values = {200, 100, 1};
+  EXPECT_EQ(pw::SaturatingAccumulate<uint8_t>(values), 255u);
+}
+
+TEST(SaturatingAccumulate, ClampsToMin) {
+  const std::array<int8_t, 3> values = {-100, -100, -100};
+  EXPECT_EQ(pw::SaturatingAccumulate<int8_t>(values),
+            std::numeric_limits<int8_t>::min());
+}
+
+TEST(SaturatingAccumulate, ExactWhenInRange) {
+  const std::array<int32_t, 3> values = {-5, 10, -3};
+  EXPECT_EQ(pw::SaturatingAccumulate<int32_t>(values), 2);
+}
+
+TEST(SaturatingAddSpans, ElementWise) {
+  const std::array<int8_t, 3> a = {100, -100, 1};
+  const std::array<int8_t, 3> b = {100, -100, 2};
+  std::array<int8_t, 3> out = {};
+  pw::SaturatingAddSpans<int8_t>(a, b, out);
+  EXPECT_EQ(out[0], std::numeric_limits<int8_t>::max());
+  EXPECT_EQ(out[1], std::numeric_limits<int8_t>::min());
+  EXPECT_EQ(out[2], 3);
+}
+
+TEST(SaturatingAddSpans, OutMayAliasInput) {
+  std::array<uint16_t, 2> a = {65535, 7};
+  const std::array<uint16_t, 2> b = {1, 8};
+  pw::SaturatingAddSpans<uint16_t>(a, b, a);
+  EXPECT_EQ(a[0], 65535u);
+  EXPECT_EQ(a[1], 15u);
+}
+
+TEST(CheckedHintedVariants, MatchUnhintedSemantics) {
+  EXPECT_EQ(pw::CheckedAddHinted<uint8_t>(250, 5).value(), 255u);
+  EXPECT_FALSE(pw::CheckedAddHinted<uint8_t>(250, 6).has_value());
+  EXPECT_EQ(pw::CheckedMulHinted<uint16_t>(255, 257).value(), 65535u);
+  EXPECT_FALSE(pw::CheckedMulHinted<uint16_t>(256, 257).has_value());
+}
+
+}  // namespace
@@ -0,0 +1,113 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_numeric/checked_span.h
+///
+/// Span-level checked and saturating arithmetic kernels. Calling
+/// `pw::CheckedAdd` per element keeps overflow safety but defeats
+/// auto-vectorization: each iteration constructs an `std::optional` and
+/// branches on it. The kernels here instead accumulate a single overflow
+/// flag branch-free inside the loop and test it once at the end, so the loop
+/// body is straight-line arithmetic the vectorizer can handle, while callers
+/// still get an all-or-nothing overflow report.
+
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "pw_preprocessor/compiler.h"
+#include "pw_span/span.h"
+
+namespace pw {
+
+/// Branch-hinted variant of `CheckedAdd` for measured hot paths where
+/// overflow is the rare case. Identical semantics; the overflow branch is
+/// laid out off the fall-through path.
+template <typename T, typename A, typename B>
+constexpr std::optional<T> CheckedAddHinted(A a, B b) {
+  T result;
+  if (PW_PREDICT_FALSE(PW_ADD_OVERFLOW(a, b, &result))) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+/// Branch-hinted variant of `CheckedMul`; see `CheckedAddHinted`.
+template <typename T, typename A, typename B>
+constexpr std::optional<T> CheckedMulHinted(A a, B b) {
+  T result;
+  if (PW_PREDICT_FALSE(PW_MUL_OVERFLOW(a, b, &result))) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+/// Sums all elements of `values`, returning `nullopt` if any partial sum
+/// overflows `T`.
+///
+/// The loop accumulates an overflow flag with `|=` instead of branching per
+/// element, so it vectorizes; overflow is checked once after the loop.
+template <typename T>
+constexpr std::optional<T> CheckedAccumulate(span<const T> values) {
+  static_assert(std::is_integral_v<T>,
+                "CheckedAccumulate requires an integral element type");
+  T sum = 0;
+  bool overflowed = false;
+  for (const T& value : values) {
+    overflowed |= PW_ADD_OVERFLOW(sum, value, &sum);
+  }
+  if (PW_PREDICT_FALSE(overflowed)) {
+    return std::nullopt;
+  }
+  return sum;
+}
+
+/// Sums all elements of `values`, clamping the running sum to the
+/// representable range of `T` instead of reporting overflow.
+template <typename T>
+constexpr T SaturatingAccumulate(span<const T> values) {
+  static_assert(std::is_integral_v<T>,
+                "SaturatingAccumulate requires an integral element type");
+  T sum = 0;
+  for (const T& value : values) {
+    T next;
+    if (PW_ADD_OVERFLOW(sum, value, &next)) {
+      next = value < 0 ? std::numeric_limits<T>::min()
+                       : std::numeric_limits<T>::max();
+    }
+    sum = next;
+  }
+  return sum;
+}
+
+/// Element-wise saturating addition: `out[i] = sat(a[i] + b[i])`. The spans
+/// must be the same size; `out` may alias `a` or `b`.
+template <typename T>
+constexpr void SaturatingAddSpans(span<const T> a,
+                                  span<const T> b,
+                                  span<T> out) {
+  static_assert(std::is_integral_v<T>,
+                "SaturatingAddSpans requires an integral element type");
+  for (size_t i = 0; i < out.size(); ++i) {
+    T sum;
+    if (PW_ADD_OVERFLOW(a[i], b[i], &sum)) {
+      sum = b[i] < 0 ? std::numeric_limits<T>::min()
+                     : std::numeric_limits<T>::max();
+    }
+    out[i] = sum;
+  }
+}
+
+}  // namespace pw
@@ -28,6 +28,11 @@ struct TestMeasurement {
   float mean = 0;
   float max = 0;
   float min = 0;
+  /// Sample standard deviation of the per-iteration durations. Together with
+  /// the mean and the iteration count, this lets tooling detect regressions
+  /// statistically (e.g. flag changes beyond a few standard errors) rather
+  /// than comparing bare means across noisy runs.
+  float std_deviation = 0;
 };
 
 /// Stores information on the upcoming collection of tests.
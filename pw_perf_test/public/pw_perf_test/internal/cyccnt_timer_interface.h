@@ -59,4 +59,59 @@ inline int64_t GetDuration(Timestamp begin, Timestamp end) {
   return static_cast<int64_t>(end - begin);
 }
 
+// DWT profiling (PMU-style) event counters, for attributing cycles measured
+// by CYCCNT. Each is an 8-bit count of events since it was last read or
+// zeroed, so they suit short measurement windows (under 256 events) such as
+// a single benchmark iteration body:
+//
+//   kCpiCnt    - extra cycles from multi-cycle instructions
+//   kExcCnt    - cycles spent in exception entry/exit
+//   kSleepCnt  - cycles spent sleeping
+//   kLsuCnt    - extra cycles from multi-cycle load/store
+//   kFoldCnt   - cycles saved by folded instructions
+//
+// Not all cores implement all counters; unimplemented ones read as zero.
+inline volatile uint32_t& kDwtCpiCnt =
+    *reinterpret_cast<volatile uint32_t*>(0xE0001008);
+inline volatile uint32_t& kDwtExcCnt =
+    *reinterpret_cast<volatile uint32_t*>(0xE000100C);
+inline volatile uint32_t& kDwtSleepCnt =
+    *reinterpret_cast<volatile uint32_t*>(0xE0001010);
+inline volatile uint32_t& kDwtLsuCnt =
+    *reinterpret_cast<volatile uint32_t*>(0xE0001014);
+inline volatile uint32_t& kDwtFoldCnt =
+    *reinterpret_cast<volatile uint32_t*>(0xE0001018);
+
+// Captured DWT event counts bracketing a measurement.
+struct DwtEventCounts {
+  uint8_t cpi;
+  uint8_t exception;
+  uint8_t sleep;
+  uint8_t load_store;
+  uint8_t folded;
+};
+
+// Enables the DWT event counters (bits 16..20 of DWT_CTRL) and zeroes them.
+// Call after TimerPrepare().
+inline void EnableDwtEventCounters() {
+  kDwtCtrl |= 0x001F0000;
+  kDwtCpiCnt = 0;
+  kDwtExcCnt = 0;
+  kDwtSleepCnt = 0;
+  kDwtLsuCnt = 0;
+  kDwtFoldCnt = 0;
+}
+
+// Reads the current event counts; subtract two captures to attribute a
+// measured region's cycles.
+inline DwtEventCounts ReadDwtEventCounters() {
+  return DwtEventCounts{
+      .cpi = static_cast<uint8_t>(kDwtCpiCnt),
+      .exception = static_cast<uint8_t>(kDwtExcCnt),
+      .sleep = static_cast<uint8_t>(kDwtSleepCnt),
+      .load_store = static_cast<uint8_t>(kDwtLsuCnt),
+      .folded = static_cast<uint8_t>(kDwtFoldCnt),
+  };
+}
+
 }  // namespace pw::perf_test::internal::backend
@@ -61,6 +61,10 @@ class State {
 
   int64_t mean_ = -1;
 
+  // Welford's online algorithm state for the variance of iteration times.
+  double welford_mean_ = 0;
+  double welford_m2_ = 0;
+
   // Stores the total number of iterations wanted
   int test_iterations_;
 
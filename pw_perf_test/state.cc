@@ -14,6 +14,8 @@
 
 #include "pw_perf_test/state.h"
 
+#include <cmath>
+
 #include "pw_log/log.h"
 
 namespace pw::perf_test {
@@ -43,6 +45,12 @@ bool State::KeepRunning() {
   }
   total_duration_ += duration;
   ++current_iteration_;
+
+  // Welford's online update, so the variance is available without storing
+  // per-iteration samples.
+  const double delta = static_cast<double>(duration) - welford_mean_;
+  welford_mean_ += delta / current_iteration_;
+  welford_m2_ += delta * (static_cast<double>(duration) - welford_mean_);
   PW_LOG_DEBUG("Iteration number: %d - Duration: %ld",
                current_iteration_,
                static_cast<long>(duration));
@@ -56,10 +64,13 @@ bool State::KeepRunning() {
     PW_LOG_DEBUG("Mean: %ld: ", static_cast<long>(mean_));
     PW_LOG_DEBUG("Minimum: %ld", static_cast<long>(min_));
     PW_LOG_DEBUG("Maxmimum: %ld", static_cast<long>(max_));
+    const double variance =
+        test_iterations_ > 1 ? welford_m2_ / (test_iterations_ - 1) : 0;
     TestMeasurement test_measurement = {
         .mean = static_cast<float>(mean_),
         .max = static_cast<float>(max_),
         .min = static_cast<float>(min_),
+        .std_deviation = static_cast<float>(std::sqrt(variance)),
     };
     event_handler_->TestCaseMeasure(test_measurement);
     event_handler_->TestCaseEnd(test_info);
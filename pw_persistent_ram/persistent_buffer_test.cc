@@ -74,6 +74,44 @@ TEST_F(PersistentTest, DefaultConstructionAndDestruction) {
   }
 }
 
+TEST_F(PersistentTest, BatchWriter_PublishesOnlyAtSync) {
+  constexpr uint32_t kFirst = 0x11111111;
+  constexpr uint32_t kSecond = 0x22222222;
+  {
+    ZeroPersistentMemory();
+    auto& persistent = GetPersistentBuffer();
+    auto writer = persistent.GetBatchWriter();
+
+    ASSERT_EQ(OkStatus(), writer.Write(as_bytes(span(&kFirst, 1))));
+    // Not synced: the persistent value is still empty.
+    EXPECT_FALSE(persistent.has_value());
+
+    writer.Sync();
+    ASSERT_TRUE(persistent.has_value());
+    EXPECT_EQ(persistent.size(), sizeof(kFirst));
+
+    // Unsynced data is lost on "reboot", but the synced prefix survives.
+    ASSERT_EQ(OkStatus(), writer.Write(as_bytes(span(&kSecond, 1))));
+    persistent.~PersistentBuffer();
+  }
+  {
+    auto& persistent = GetPersistentBuffer();
+    ASSERT_TRUE(persistent.has_value());
+    EXPECT_EQ(persistent.size(), sizeof(kFirst));
+
+    // Syncing twice more data continues from the synced prefix.
+    auto writer = persistent.GetBatchWriter();
+    ASSERT_EQ(OkStatus(), writer.Write(as_bytes(span(&kSecond, 1))));
+    writer.Sync();
+    ASSERT_TRUE(persistent.has_value());
+    EXPECT_EQ(persistent.size(), sizeof(kFirst) + sizeof(kSecond));
+
+    uint32_t temp = 0;
+    memcpy(&temp, persistent.data() + sizeof(kFirst), sizeof(temp));
+    EXPECT_EQ(temp, kSecond);
+  }
+}
+
 TEST_F(PersistentTest, LongData) {
   constexpr std::string_view kTestString(
       "A nice string should remain valid even if written incrementally!");
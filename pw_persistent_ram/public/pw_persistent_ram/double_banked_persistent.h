@@ -0,0 +1,139 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "pw_checksum/crc16_ccitt.h"
+
+namespace pw::persistent_ram {
+
+// Double-banked counterpart of Persistent<T> for values that are read on hot
+// paths while being mutated elsewhere. Persistent<T> recomputes the whole-
+// object CRC on every mutation and readers may observe torn intermediate
+// state unless they lock around access. Here, writers stage changes in the
+// inactive bank and publish them with one atomic epoch flip; the CRC is
+// computed once per flip instead of per mutation, and readers never pay a
+// read-side CRC or lock.
+//
+// Reader guarantees: `ReadSnapshot` copies a consistent value with a
+// wait-free epoch-check retry (a tear requires two full commits to land
+// mid-copy); a control loop that is itself the only writer may use
+// `active()` to read in place with no copy.
+//
+// Like Persistent<T>, place instances in a persistent-RAM (noinit) section
+// and call Init() once during boot, before any mutation, to validate what
+// survived; T must be trivially copyable and trivially destructible.
+template <typename T>
+class DoubleBankedPersistent {
+ public:
+  static_assert(std::is_trivially_copy_constructible<T>::value,
+                "A double-banked value is recovered through a trivial copy");
+  static_assert(std::is_trivially_destructible<T>::value,
+                "Banks are never destructed");
+
+  constexpr DoubleBankedPersistent() = default;
+
+  DoubleBankedPersistent(const DoubleBankedPersistent&) = delete;
+  DoubleBankedPersistent& operator=(const DoubleBankedPersistent&) = delete;
+
+  // Validates the banks after reset. Returns true if a consistent value was
+  // recovered (preferring the bank the epoch selects, falling back to the
+  // other if a commit was interrupted by the reset); false if neither bank
+  // holds a valid value, in which case has_value() stays false until the
+  // first Commit.
+  bool Init() {
+    const uint32_t epoch = epoch_.load(std::memory_order_relaxed);
+    for (uint32_t candidate : {epoch, epoch + 1}) {
+      Bank& bank = banks_[candidate % 2];
+      if (bank.crc == CalculateCrc(bank)) {
+        epoch_.store(candidate, std::memory_order_relaxed);
+        valid_ = true;
+        return true;
+      }
+    }
+    valid_ = false;
+    return false;
+  }
+
+  bool has_value() const { return valid_; }
+
+  // Zero-copy access to the active bank. Safe only when the caller is the
+  // sole writer or mutations are externally excluded during the read;
+  // otherwise use ReadSnapshot.
+  //
+  // Precondition: has_value() is true.
+  const T& active() const {
+    return banks_[epoch_.load(std::memory_order_acquire) % 2].contents;
+  }
+
+  // Copies a consistent snapshot of the value into `out`. Lock-free: retries
+  // only if two commits complete during the copy, which bounds retries for
+  // any realistic write rate.
+  //
+  // Precondition: has_value() is true.
+  void ReadSnapshot(T& out) const {
+    while (true) {
+      const uint32_t before = epoch_.load(std::memory_order_acquire);
+      std::memcpy(&out, &banks_[before % 2].contents, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (epoch_.load(std::memory_order_relaxed) == before) {
+        return;
+      }
+    }
+  }
+
+  // Returns the inactive bank for mutation, seeded with a copy of the
+  // current value (or default-initialized bytes if none). Readers are
+  // unaffected until Commit. Single writer only.
+  T& StageWrite() {
+    const uint32_t epoch = epoch_.load(std::memory_order_relaxed);
+    Bank& inactive = banks_[(epoch + 1) % 2];
+    if (valid_) {
+      std::memcpy(
+          &inactive.contents, &banks_[epoch % 2].contents, sizeof(T));
+    }
+    return inactive.contents;
+  }
+
+  // Publishes the staged bank: computes its CRC (once per commit, not per
+  // field write) and atomically flips the epoch so readers switch banks.
+  void Commit() {
+    const uint32_t epoch = epoch_.load(std::memory_order_relaxed);
+    Bank& staged = banks_[(epoch + 1) % 2];
+    staged.crc = CalculateCrc(staged);
+    valid_ = true;
+    epoch_.store(epoch + 1, std::memory_order_release);
+  }
+
+ private:
+  struct Bank {
+    T contents;
+    uint16_t crc;
+  };
+
+  static uint16_t CalculateCrc(const Bank& bank) {
+    return checksum::Crc16Ccitt::Calculate(
+        as_bytes(span(&bank.contents, 1)));
+  }
+
+  Bank banks_[2];
+  std::atomic<uint32_t> epoch_{0};
+  bool valid_ = false;
+};
+
+}  // namespace pw::persistent_ram
@@ -122,6 +122,16 @@
 /// Prevents the compiler from inlining a fuction.
 #define PW_NO_INLINE __attribute__((noinline))
 
+/// Hints to the compiler that the expression is likely to evaluate true, so
+/// the fall-through path is laid out for the common case. Use sparingly, on
+/// measured hot paths; the expression must be contextually convertible to
+/// `bool`.
+#define PW_PREDICT_TRUE(expression) __builtin_expect(!!(expression), 1)
+
+/// Hints to the compiler that the expression is unlikely to evaluate true,
+/// e.g. for error and overflow branches on hot paths.
+#define PW_PREDICT_FALSE(expression) __builtin_expect(!!(expression), 0)
+
 /// Indicate to the compiler that the given section of code will not be reached.
 /// Example:
 ///
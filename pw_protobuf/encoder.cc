@@ -38,10 +38,12 @@ namespace pw::protobuf {
 using internal::VarintType;
 
 StreamEncoder StreamEncoder::GetNestedEncoder(uint32_t field_number,
-                                              bool write_when_empty) {
+                                              bool write_when_empty,
+                                              size_t length_prefix_size) {
   PW_CHECK(!nested_encoder_open());
 
   nested_field_number_ = field_number;
+  nested_length_prefix_size_ = length_prefix_size;
   if (!ValidFieldNumber(field_number)) {
     status_.Update(Status::InvalidArgument());
     return StreamEncoder(*this, ByteSpan(), false);
@@ -51,11 +53,11 @@ StreamEncoder StreamEncoder::GetNestedEncoder(uint32_t field_number,
   // as their scratch buffer.
   size_t key_size =
       varint::EncodedSize(FieldKey(field_number, WireType::kDelimited));
-  size_t reserved_size = key_size + config::kMaxVarintSize;
+  size_t reserved_size = key_size + length_prefix_size;
   size_t max_size = std::min(memory_writer_.ConservativeWriteLimit(),
                              writer_.ConservativeWriteLimit());
-  // Cap based on max varint size.
-  max_size = std::min(varint::MaxValueInBytes(config::kMaxVarintSize),
+  // Cap based on the reserved length prefix size.
+  max_size = std::min(varint::MaxValueInBytes(length_prefix_size),
                       static_cast<uint64_t>(max_size));
 
   // Account for reserved bytes.
@@ -111,7 +113,7 @@ void StreamEncoder::CloseNestedMessage(StreamEncoder& nested) {
   }
 
   if (varint::EncodedSize(nested.memory_writer_.bytes_written()) >
-      config::kMaxVarintSize) {
+      nested_length_prefix_size_) {
     status_ = Status::OutOfRange();
     return;
   }
@@ -254,6 +254,50 @@ TEST(StreamEncoder, Nested) {
             0);
 }
 
+TEST(StreamEncoder, NestedWithSizeHint) {
+  std::byte encode_buffer[64];
+  std::byte dest_buffer[64];
+  MemoryWriter writer(dest_buffer);
+  StreamEncoder encoder(writer, encode_buffer);
+
+  {
+    // A size hint below 128 reserves a single length-prefix byte.
+    StreamEncoder nested =
+        encoder.GetNestedEncoderWithMaxSize(kTestProtoNestedField,
+                                            /*max_encoded_size=*/16);
+    EXPECT_EQ(nested.WriteString(kNestedProtoHelloField, "world"), OkStatus());
+  }
+  ASSERT_EQ(encoder.status(), OkStatus());
+
+  constexpr auto kExpected = bytes::Array<
+      0x32, 0x07, 0x0a, 0x05, 'w', 'o', 'r', 'l', 'd'>();
+  ConstByteSpan result = writer.WrittenData();
+  ASSERT_EQ(result.size(), kExpected.size());
+  EXPECT_EQ(std::memcmp(result.data(), kExpected.data(), kExpected.size()), 0);
+}
+
+TEST(StreamEncoder, NestedWithSizeHint_OverflowingHintFails) {
+  std::byte encode_buffer[64];
+  std::byte dest_buffer[64];
+  MemoryWriter writer(dest_buffer);
+  StreamEncoder encoder(writer, encode_buffer);
+
+  {
+    StreamEncoder nested =
+        encoder.GetNestedEncoderWithMaxSize(kTestProtoNestedField,
+                                            /*max_encoded_size=*/4);
+    // Writing more than fits in the hint's one-byte... the scratch is capped
+    // at the largest value a 1-byte prefix can express, so large writes fail
+    // in the nested encoder.
+    EXPECT_EQ(nested.WriteString(kNestedProtoHelloField,
+                                 "0123456789012345678901234567890123456789012"
+                                 "0123456789012345678901234567890123456789012"
+                                 "0123456789012345678901234567890123456789"),
+              Status::ResourceExhausted());
+  }
+  EXPECT_EQ(encoder.status(), Status::ResourceExhausted());
+}
+
 TEST(StreamEncoder, RepeatedField) {
   std::byte encode_buffer[32];
   MemoryEncoder encoder(encode_buffer);
@@ -0,0 +1,139 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_protobuf/extract.h"
+
+#include <array>
+
+#include "pw_protobuf/encoder.h"
+#include "pw_unit_test/framework.h"
+#include "pw_varint/varint.h"
+
+namespace pw::protobuf {
+namespace {
+
+// Encodes a test message:
+//   field 1 (uint32): 42
+//   field 2 (string): "device-7"
+//   field 3 (submessage):
+//     field 1 (uint32): 99
+//     field 2 (string): "nested"
+//   field 5 (fixed32): 0x12345678
+ConstByteSpan EncodeTestMessage(ByteSpan buffer) {
+  MemoryEncoder encoder(buffer);
+  PW_ASSERT(encoder.WriteUint32(1, 42).ok());
+  PW_ASSERT(encoder.WriteString(2, "device-7").ok());
+  {
+    StreamEncoder nested = encoder.GetNestedEncoder(3);
+    PW_ASSERT(nested.WriteUint32(1, 99).ok());
+    PW_ASSERT(nested.WriteString(2, "nested").ok());
+  }
+  PW_ASSERT(encoder.WriteFixed32(5, 0x12345678).ok());
+  return ConstByteSpan(encoder);
+}
+
+uint64_t DecodeVarintValue(const ExtractedField& field) {
+  uint64_t value = 0;
+  PW_ASSERT(varint::Decode(field.value, &value) != 0);
+  return value;
+}
+
+TEST(ExtractionPlan, ExtractsAllDeclaredFieldsInOnePass) {
+  std::byte buffer[128];
+  const ConstByteSpan message = EncodeTestMessage(buffer);
+
+  static constexpr ExtractionPlan<4> kPlan(std::array<FieldPath, 4>{
+      MakeFieldPath(1),     // top-level uint32
+      MakeFieldPath(2),     // top-level string
+      MakeFieldPath(3, 2),  // nested string
+      MakeFieldPath(5),     // fixed32
+  });
+
+  std::array<ExtractedField, 4> results;
+  ASSERT_EQ(kPlan.Extract(message, results), OkStatus());
+
+  ASSERT_TRUE(results[0].ok());
+  EXPECT_EQ(DecodeVarintValue(results[0]), 42u);
+
+  ASSERT_TRUE(results[1].ok());
+  EXPECT_EQ(std::string_view(
+                reinterpret_cast<const char*>(results[1].value.data()),
+                results[1].value.size()),
+            "device-7");
+
+  ASSERT_TRUE(results[2].ok());
+  EXPECT_EQ(std::string_view(
+                reinterpret_cast<const char*>(results[2].value.data()),
+                results[2].value.size()),
+            "nested");
+
+  ASSERT_TRUE(results[3].ok());
+  EXPECT_EQ(results[3].wire_type, WireType::kFixed32);
+  EXPECT_EQ(results[3].value.size(), sizeof(uint32_t));
+}
+
+TEST(ExtractionPlan, MissingFieldsAreNotFound) {
+  std::byte buffer[128];
+  const ConstByteSpan message = EncodeTestMessage(buffer);
+
+  static constexpr ExtractionPlan<2> kPlan(std::array<FieldPath, 2>{
+      MakeFieldPath(9),     // Absent at top level.
+      MakeFieldPath(3, 7),  // Absent within the submessage.
+  });
+
+  std::array<ExtractedField, 2> results;
+  ASSERT_EQ(kPlan.Extract(message, results), OkStatus());
+  EXPECT_EQ(results[0].status, Status::NotFound());
+  EXPECT_EQ(results[1].status, Status::NotFound());
+}
+
+TEST(ExtractionPlan, DoesNotDescendIntoUndeclaredSubmessages) {
+  std::byte buffer[128];
+  const ConstByteSpan message = EncodeTestMessage(buffer);
+
+  // Field 1 exists at the top level and inside submessage 3; a plan that
+  // only declares the top-level path must not match the nested one.
+  static constexpr ExtractionPlan<1> kPlan(
+      std::array<FieldPath, 1>{MakeFieldPath(1)});
+  std::array<ExtractedField, 1> results;
+  ASSERT_EQ(kPlan.Extract(message, results), OkStatus());
+  EXPECT_EQ(DecodeVarintValue(results[0]), 42u);
+}
+
+TEST(ExtractionPlan, MalformedMessageReportsDataLoss) {
+  // A delimited field whose length runs past the buffer.
+  const std::array<std::byte, 3> bad = {
+      std::byte{0x12}, std::byte{0x7f}, std::byte{0x00}};
+
+  static constexpr ExtractionPlan<1> kPlan(
+      std::array<FieldPath, 1>{MakeFieldPath(2)});
+  std::array<ExtractedField, 1> results;
+  EXPECT_EQ(kPlan.Extract(bad, results), Status::DataLoss());
+}
+
+TEST(ExtractionPlan, FirstOccurrenceWins) {
+  std::byte buffer[64];
+  MemoryEncoder encoder(buffer);
+  ASSERT_EQ(encoder.WriteUint32(1, 7), OkStatus());
+  ASSERT_EQ(encoder.WriteUint32(1, 8), OkStatus());
+
+  static constexpr ExtractionPlan<1> kPlan(
+      std::array<FieldPath, 1>{MakeFieldPath(1)});
+  std::array<ExtractedField, 1> results;
+  ASSERT_EQ(kPlan.Extract(ConstByteSpan(encoder), results), OkStatus());
+  EXPECT_EQ(DecodeVarintValue(results[0]), 7u);
+}
+
+}  // namespace
+}  // namespace pw::protobuf
@@ -60,6 +60,29 @@ TEST(Find, PresentField) {
   EXPECT_STREQ(str.c_str(), "Hello world");
 }
 
+TEST(FieldIndex, FindsFieldsWithoutRescanning) {
+  FieldIndex<8> index(kEncodedProto);
+  EXPECT_EQ(index.size(), 7u);
+
+  EXPECT_EQ(index.FindUint32(1).value(), 42u);
+  EXPECT_EQ(index.FindString(6).value(), "Hello world");
+  ASSERT_TRUE(index.FindBytes(7).ok());
+  EXPECT_EQ(index.FindBytes(7).value().size(), 2u);
+
+  // Views from FindField start at the field's key.
+  ASSERT_TRUE(index.FindField(5).ok());
+  EXPECT_EQ(index.FindField(5).value().data(), &kEncodedProto[15]);
+
+  EXPECT_EQ(index.FindField(99).status(), Status::NotFound());
+}
+
+TEST(FieldIndex, FullIndexFallsBackToScanning) {
+  FieldIndex<2> index(kEncodedProto);
+  EXPECT_EQ(index.size(), 2u);
+  // Field 6 did not fit in the index, but is still found by scanning.
+  EXPECT_EQ(index.FindString(6).value(), "Hello world");
+}
+
 TEST(Find, MissingField) {
   EXPECT_EQ(FindUint32(kEncodedProto, 8).status(), Status::NotFound());
   EXPECT_EQ(FindUint32(kEncodedProto, 66).status(), Status::NotFound());
@@ -179,6 +179,29 @@ class StreamEncoder {
         empty_encoder_behavior == EmptyEncoderBehavior::kWriteFieldNumber);
   }
 
+  // Variant of `GetNestedEncoder` for when the nested message's maximum
+  // encoded size is known in advance (e.g. a generated message's
+  // kMaxEncodedSizeBytes, or a precomputed size). Instead of reserving
+  // PW_PROTOBUF_CFG_MAX_VARINT_SIZE bytes for the length prefix, only the
+  // bytes needed to encode `max_encoded_size` are reserved, so small
+  // submessages are staged closer to their final position (a shorter copy on
+  // close) and messages larger than the configured max varint size cap can
+  // still be encoded when the size is known.
+  //
+  // The nested message must not exceed `max_encoded_size` bytes; the close
+  // fails with OUT_OF_RANGE if it does.
+  StreamEncoder GetNestedEncoderWithMaxSize(
+      uint32_t field_number,
+      size_t max_encoded_size,
+      EmptyEncoderBehavior empty_encoder_behavior =
+          EmptyEncoderBehavior::kWriteFieldNumber) {
+    return GetNestedEncoder(
+        field_number,
+        /*write_when_empty=*/
+        empty_encoder_behavior == EmptyEncoderBehavior::kWriteFieldNumber,
+        varint::EncodedSize(max_encoded_size));
+  }
+
   // Returns the current encoder's status.
   //
   // Precondition: Encoder has no active child encoder.
@@ -651,7 +674,10 @@ class StreamEncoder {
   // Protected method to create a nested encoder, specifying whether the field
   // should be written when no fields were added to the nested encoder. Exposed
   // using an enum in the public API, for better readability.
-  StreamEncoder GetNestedEncoder(uint32_t field_number, bool write_when_empty);
+  StreamEncoder GetNestedEncoder(uint32_t field_number,
+                                 bool write_when_empty,
+                                 size_t length_prefix_size =
+                                     config::kMaxVarintSize);
 
  private:
   friend class MemoryEncoder;
@@ -814,6 +840,9 @@ class StreamEncoder {
   // submessage. Otherwise, this is 0 to indicate no child encoder is open.
   uint32_t nested_field_number_;
 
+  // Bytes reserved for the open nested encoder's length prefix.
+  size_t nested_length_prefix_size_ = config::kMaxVarintSize;
+
   // This memory writer is used for staging proto submessages to the
   // scratch_buffer.
   stream::MemoryWriter memory_writer_;
@@ -0,0 +1,180 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_protobuf/extract.h
+///
+/// Multi-field extraction in one pass. The `Find*` helpers rescan the
+/// message per query, so extracting N fields from a report costs N passes.
+/// An `ExtractionPlan` declares all wanted field paths up front (a constexpr
+/// table of field numbers, including paths into nested messages); a single
+/// streaming pass over the buffer then fills every result, descending into a
+/// submessage only when some declared path continues through it.
+
+#include <array>
+#include <cstdint>
+
+#include "pw_bytes/span.h"
+#include "pw_protobuf/wire_format.h"
+#include "pw_span/span.h"
+#include "pw_status/status.h"
+#include "pw_status/try.h"
+#include "pw_varint/varint.h"
+
+namespace pw::protobuf {
+
+/// Maximum nesting depth of an extractable field path.
+inline constexpr size_t kMaxFieldPathDepth = 4;
+
+/// A path of field numbers from the top-level message to the wanted field,
+/// e.g. `{1, 3}` for field 3 of the submessage in field 1.
+struct FieldPath {
+  std::array<uint32_t, kMaxFieldPathDepth> numbers;
+  size_t depth;
+};
+
+/// Builds a `FieldPath` from 1 to `kMaxFieldPathDepth` field numbers, which
+/// may be integers or generated `Fields` enum values.
+template <typename... Numbers>
+constexpr FieldPath MakeFieldPath(Numbers... numbers) {
+  static_assert(sizeof...(Numbers) >= 1 &&
+                    sizeof...(Numbers) <= kMaxFieldPathDepth,
+                "A field path has 1 to kMaxFieldPathDepth components");
+  return FieldPath{{static_cast<uint32_t>(numbers)...}, sizeof...(Numbers)};
+}
+
+/// One extracted field. `value` holds the raw value bytes: the contents of a
+/// delimited field (string/bytes/submessage), or the encoded varint or fixed
+/// value otherwise; decode scalars with `varint::Decode` or
+/// `bytes::ReadInOrder`. The first occurrence on the wire wins.
+struct ExtractedField {
+  Status status = Status::NotFound();
+  ConstByteSpan value;
+  WireType wire_type = WireType::kVarint;
+
+  bool ok() const { return status.ok(); }
+};
+
+/// A compiled plan extracting `kNumPaths` field paths in one streaming pass.
+/// Plans are immutable and reusable; declare them once (typically constexpr)
+/// and run `Extract` per message.
+template <size_t kNumPaths>
+class ExtractionPlan {
+ public:
+  static_assert(kNumPaths >= 1 && kNumPaths <= 32,
+                "Plans track active paths in a 32-bit mask");
+
+  explicit constexpr ExtractionPlan(
+      const std::array<FieldPath, kNumPaths>& paths)
+      : paths_(paths) {}
+
+  /// Runs the plan over `message`, filling `results[i]` for `paths[i]`.
+  /// Fields absent from the message are left `NOT_FOUND`. Returns
+  /// `DATA_LOSS` if the message is malformed (results found before the
+  /// malformed point are retained).
+  Status Extract(ConstByteSpan message,
+                 std::array<ExtractedField, kNumPaths>& results) const {
+    results = {};
+    return ExtractLevel(
+        message, 0, kNumPaths == 32 ? ~uint32_t{0} : (1u << kNumPaths) - 1,
+        results);
+  }
+
+ private:
+  Status ExtractLevel(ConstByteSpan message,
+                      size_t depth,
+                      uint32_t active_mask,
+                      std::array<ExtractedField, kNumPaths>& results) const {
+    size_t offset = 0;
+    while (offset < message.size()) {
+      uint64_t key;
+      const size_t key_size = varint::Decode(message.subspan(offset), &key);
+      if (key_size == 0) {
+        return Status::DataLoss();
+      }
+      offset += key_size;
+
+      const uint32_t field_number = static_cast<uint32_t>(key >> 3);
+      const WireType wire_type = static_cast<WireType>(key & 0b111u);
+      ConstByteSpan value;
+      switch (wire_type) {
+        case WireType::kVarint: {
+          uint64_t ignored;
+          const size_t value_size =
+              varint::Decode(message.subspan(offset), &ignored);
+          if (value_size == 0) {
+            return Status::DataLoss();
+          }
+          value = message.subspan(offset, value_size);
+          offset += value_size;
+          break;
+        }
+        case WireType::kFixed64:
+          if (offset + sizeof(uint64_t) > message.size()) {
+            return Status::DataLoss();
+          }
+          value = message.subspan(offset, sizeof(uint64_t));
+          offset += sizeof(uint64_t);
+          break;
+        case WireType::kFixed32:
+          if (offset + sizeof(uint32_t) > message.size()) {
+            return Status::DataLoss();
+          }
+          value = message.subspan(offset, sizeof(uint32_t));
+          offset += sizeof(uint32_t);
+          break;
+        case WireType::kDelimited: {
+          uint64_t length;
+          const size_t length_size =
+              varint::Decode(message.subspan(offset), &length);
+          if (length_size == 0 ||
+              offset + length_size + length > message.size()) {
+            return Status::DataLoss();
+          }
+          value = message.subspan(offset + length_size,
+                                  static_cast<size_t>(length));
+          offset += length_size + static_cast<size_t>(length);
+          break;
+        }
+        default:
+          return Status::DataLoss();
+      }
+
+      // Record terminal matches and collect paths that continue into this
+      // field as a submessage.
+      uint32_t recurse_mask = 0;
+      for (size_t i = 0; i < kNumPaths; ++i) {
+        if ((active_mask & (1u << i)) == 0 ||
+            paths_[i].numbers[depth] != field_number) {
+          continue;
+        }
+        if (depth + 1 == paths_[i].depth) {
+          if (!results[i].ok()) {  // First occurrence wins.
+            results[i] = ExtractedField{OkStatus(), value, wire_type};
+          }
+        } else if (wire_type == WireType::kDelimited) {
+          recurse_mask |= 1u << i;
+        }
+      }
+      if (recurse_mask != 0) {
+        PW_TRY(ExtractLevel(value, depth + 1, recurse_mask, results));
+      }
+    }
+    return OkStatus();
+  }
+
+  std::array<FieldPath, kNumPaths> paths_;
+};
+
+}  // namespace pw::protobuf
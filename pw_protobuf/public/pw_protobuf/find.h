@@ -43,8 +43,10 @@
 #include "pw_protobuf/decoder.h"
 #include "pw_protobuf/stream_decoder.h"
 #include "pw_result/result.h"
+#include "pw_protobuf/wire_format.h"
 #include "pw_status/try.h"
 #include "pw_string/string.h"
+#include "pw_varint/varint.h"
 
 namespace pw::protobuf {
 
@@ -1150,4 +1152,120 @@ Result<ConstByteSpan> FindRaw(ConstByteSpan message, T field) {
   return FindRaw(message, static_cast<uint32_t>(field));
 }
 
+/// Lazily built index of a message's top-level fields, so repeated lookups in
+/// the same serialized message do not each rescan from the beginning. One
+/// pass records the byte offset of the first occurrence of each distinct
+/// field number (up to `kMaxFields`); lookups then hand the `Find*` helpers a
+/// view starting at the field's key, making each lookup proportional to the
+/// field's size rather than the whole message.
+template <size_t kMaxFields>
+class FieldIndex {
+ public:
+  explicit constexpr FieldIndex(ConstByteSpan message) : message_(message) {
+    size_t offset = 0;
+    while (offset < message_.size() && count_ < kMaxFields) {
+      const size_t field_start = offset;
+      uint64_t key;
+      const size_t key_size =
+          varint::Decode(message_.subspan(offset), &key);
+      if (key_size == 0) {
+        break;  // Malformed; index what was parsed so far.
+      }
+      offset += key_size;
+
+      const uint32_t field_number = static_cast<uint32_t>(key >> 3);
+      uint64_t length = 0;
+      switch (static_cast<WireType>(key & 0b111)) {
+        case WireType::kVarint: {
+          const size_t value_size =
+              varint::Decode(message_.subspan(offset), &length);
+          if (value_size == 0) {
+            return;
+          }
+          offset += value_size;
+          break;
+        }
+        case WireType::kFixed64:
+          offset += sizeof(uint64_t);
+          break;
+        case WireType::kFixed32:
+          offset += sizeof(uint32_t);
+          break;
+        case WireType::kDelimited: {
+          const size_t length_size =
+              varint::Decode(message_.subspan(offset), &length);
+          if (length_size == 0) {
+            return;
+          }
+          offset += length_size + length;
+          break;
+        }
+        default:
+          return;  // Unsupported wire type; stop indexing.
+      }
+      if (offset > message_.size()) {
+        return;
+      }
+
+      if (!Contains(field_number)) {
+        entries_[count_++] = Entry{field_number, field_start};
+      }
+    }
+  }
+
+  /// Returns a view of the message beginning at the first occurrence of the
+  /// field, suitable for passing to the `Find*` helpers, or NOT_FOUND. If the
+  /// index filled up before reaching the field, falls back to returning the
+  /// whole message, so `Find*` still locates it with a scan.
+  constexpr Result<ConstByteSpan> FindField(uint32_t field_number) const {
+    for (size_t i = 0; i < count_; ++i) {
+      if (entries_[i].field_number == field_number) {
+        return message_.subspan(entries_[i].offset);
+      }
+    }
+    if (count_ == kMaxFields) {
+      return message_;  // Index is full; the field may still be present.
+    }
+    return Status::NotFound();
+  }
+
+  /// Typed lookup helpers that combine `FindField` with the `Find*` scanners.
+  Result<uint32_t> FindUint32(uint32_t field_number) const {
+    PW_TRY(FindField(field_number).status());
+    return protobuf::FindUint32(FindField(field_number).value(), field_number);
+  }
+
+  Result<ConstByteSpan> FindBytes(uint32_t field_number) const {
+    PW_TRY(FindField(field_number).status());
+    return protobuf::FindBytes(FindField(field_number).value(), field_number);
+  }
+
+  Result<std::string_view> FindString(uint32_t field_number) const {
+    PW_TRY(FindField(field_number).status());
+    return protobuf::FindString(FindField(field_number).value(), field_number);
+  }
+
+  /// The number of distinct fields indexed.
+  constexpr size_t size() const { return count_; }
+
+ private:
+  struct Entry {
+    uint32_t field_number;
+    size_t offset;
+  };
+
+  constexpr bool Contains(uint32_t field_number) const {
+    for (size_t i = 0; i < count_; ++i) {
+      if (entries_[i].field_number == field_number) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ConstByteSpan message_;
+  Entry entries_[kMaxFields] = {};
+  size_t count_ = 0;
+};
+
 }  // namespace pw::protobuf
@@ -106,4 +106,50 @@ class XorShiftStarRng64 : public RandomGenerator {
   static constexpr uint64_t kMultConst = 0x2545F4914F6CDD1D;
 };
 
+/// Two-tier random generator: serves bytes from the fast `XorShiftStarRng64`
+/// PRNG and periodically reseeds it from a slower entropy source, such as a
+/// hardware TRNG whose per-read cost or throughput makes it unsuitable for
+/// hot paths. The entropy source's cost is amortized over
+/// `reseed_interval_bytes` of fast output, while continuous reseeding keeps
+/// the PRNG from being a pure function of its initial seed.
+///
+/// @warning Like the underlying PRNG, this is **NOT** cryptographically
+/// secure; it is a fast statistical tier over a true entropy source.
+class ReseedingXorShiftStarRng64 : public RandomGenerator {
+ public:
+  ReseedingXorShiftStarRng64(RandomGenerator& entropy_source,
+                             size_t reseed_interval_bytes,
+                             uint64_t initial_seed = 0)
+      : entropy_source_(entropy_source),
+        reseed_interval_bytes_(reseed_interval_bytes),
+        rng_(initial_seed) {
+    Reseed();
+  }
+
+  void Get(ByteSpan dest) final {
+    bytes_since_reseed_ += dest.size_bytes();
+    if (bytes_since_reseed_ >= reseed_interval_bytes_) {
+      Reseed();
+    }
+    rng_.Get(dest);
+  }
+
+  void InjectEntropyBits(uint32_t data, uint_fast8_t num_bits) final {
+    rng_.InjectEntropyBits(data, num_bits);
+  }
+
+ private:
+  void Reseed() {
+    uint32_t entropy = 0;
+    entropy_source_.GetInt(entropy);
+    rng_.InjectEntropyBits(entropy, 32);
+    bytes_since_reseed_ = 0;
+  }
+
+  RandomGenerator& entropy_source_;
+  size_t reseed_interval_bytes_;
+  size_t bytes_since_reseed_ = 0;
+  XorShiftStarRng64 rng_;
+};
+
 }  // namespace pw::random
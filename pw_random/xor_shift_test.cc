@@ -42,6 +42,20 @@ constexpr uint64_t result2[] = {
 };
 constexpr int result2_count = sizeof(result2) / sizeof(result2[0]);
 
+TEST(ReseedingXorShiftStarRng64, ProducesBytesAndReseeds) {
+  XorShiftStarRng64 entropy_source(0x11223344);
+  ReseedingXorShiftStarRng64 rng(entropy_source, /*reseed_interval_bytes=*/16);
+
+  // Crossing the reseed interval pulls from the entropy source and output
+  // keeps flowing.
+  std::array<std::byte, 8> buffer_a = {};
+  std::array<std::byte, 8> buffer_b = {};
+  rng.Get(buffer_a);
+  rng.Get(buffer_a);  // Triggers a reseed on the next Get.
+  rng.Get(buffer_b);
+  EXPECT_NE(std::memcmp(buffer_a.data(), buffer_b.data(), buffer_a.size()), 0);
+}
+
 TEST(XorShiftStarRng64, ValidateSeries1) {
   XorShiftStarRng64 rng(seed1);
   for (size_t i = 0; i < result1_count; ++i) {
@@ -35,6 +35,7 @@ void PrefixedEntryRingBufferMulti::Clear() {
   for (Reader& reader : readers_) {
     reader.read_idx_ = 0;
     reader.entry_count_ = 0;
+    reader.front_info_valid_ = false;
   }
 }
 
@@ -61,10 +62,12 @@ Status PrefixedEntryRingBufferMulti::AttachReader(Reader& reader) {
   if (readers_.empty()) {
     reader.read_idx_ = write_idx_;
     reader.entry_count_ = 0;
+    reader.front_info_valid_ = false;
   } else {
     const Reader& slowest_reader = GetSlowestReader();
     reader.read_idx_ = slowest_reader.read_idx_;
     reader.entry_count_ = slowest_reader.entry_count_;
+    reader.front_info_valid_ = false;
   }
 
   readers_.push_back(reader);
@@ -78,6 +81,7 @@ Status PrefixedEntryRingBufferMulti::DetachReader(Reader& reader) {
   reader.buffer_ = nullptr;
   reader.read_idx_ = 0;
   reader.entry_count_ = 0;
+  reader.front_info_valid_ = false;
   readers_.remove(reader);
   return OkStatus();
 }
@@ -163,6 +167,24 @@ Status PrefixedEntryRingBufferMulti::InternalPeekFrontWithPreamble(
   return InternalRead(reader, output, true);
 }
 
+Status PrefixedEntryRingBufferMulti::InternalPeekFrontPrefix(
+    const Reader& reader,
+    span<byte> prefix,
+    size_t& bytes_read_out,
+    uint32_t& user_preamble_out) const {
+  bytes_read_out = 0;
+  // Copies up to the prefix capacity and ignores the remainder of the entry;
+  // InternalRead may deliver the data in two chunks when the entry wraps.
+  auto copy_prefix = [&](span<const byte> chunk) -> Status {
+    const size_t to_copy =
+        std::min(chunk.size(), prefix.size() - bytes_read_out);
+    std::memcpy(prefix.data() + bytes_read_out, chunk.data(), to_copy);
+    bytes_read_out += to_copy;
+    return OkStatus();
+  };
+  return InternalRead(reader, copy_prefix, false, &user_preamble_out);
+}
+
 Status PrefixedEntryRingBufferMulti::InternalPeekFrontPreamble(
     const Reader& reader, uint32_t& user_preamble_out) const {
   if (reader.entry_count_ == 0) {
@@ -305,9 +327,58 @@ Status PrefixedEntryRingBufferMulti::InternalPopFront(Reader& reader) {
   size_t prev_read_idx = reader.read_idx_;
   reader.read_idx_ = IncrementIndex(prev_read_idx, entry_bytes);
   reader.entry_count_--;
+  reader.front_info_valid_ = false;
   return OkStatus();
 }
 
+StatusWithSize PrefixedEntryRingBufferMulti::InternalPopEntries(
+    Reader& reader, span<byte> data, size_t& entries_read_out) {
+  entries_read_out = 0;
+  if (buffer_ == nullptr) {
+    return StatusWithSize::FailedPrecondition();
+  }
+  if (reader.entry_count_ == 0) {
+    return StatusWithSize::OutOfRange();
+  }
+
+  // Walk the entry prefixes once to find how many whole entries fit.
+  size_t total_bytes = 0;
+  size_t entries = 0;
+  size_t source_idx = reader.read_idx_;
+  while (entries < reader.entry_count_) {
+    const Result<EntryInfo> info = RawFrontEntryInfo(source_idx);
+    if (!info.ok()) {
+      return StatusWithSize(info.status(), 0);
+    }
+    const size_t entry_bytes = info->preamble_bytes + info->data_bytes;
+    if (total_bytes + entry_bytes > data.size()) {
+      break;
+    }
+    total_bytes += entry_bytes;
+    source_idx = IncrementIndex(source_idx, entry_bytes);
+    entries++;
+  }
+  if (entries == 0) {
+    return StatusWithSize::ResourceExhausted();
+  }
+
+  // The entries are contiguous in the ring, so copying them is at most two
+  // memcpys: one up to the buffer end and one for the wrapped remainder.
+  const size_t bytes_until_wrap = buffer_bytes_ - reader.read_idx_;
+  const size_t first_chunk = std::min(total_bytes, bytes_until_wrap);
+  std::memcpy(data.data(), buffer_ + reader.read_idx_, first_chunk);
+  if (first_chunk < total_bytes) {
+    std::memcpy(data.data() + first_chunk, buffer_, total_bytes - first_chunk);
+  }
+
+  // Advance the reader past all copied entries.
+  reader.read_idx_ = IncrementIndex(reader.read_idx_, total_bytes);
+  reader.entry_count_ -= entries;
+  reader.front_info_valid_ = false;
+  entries_read_out = entries;
+  return StatusWithSize(total_bytes);
+}
+
 size_t PrefixedEntryRingBufferMulti::InternalFrontEntryDataSizeBytes(
     const Reader& reader) const {
   if (reader.entry_count_ == 0) {
@@ -327,9 +398,20 @@ size_t PrefixedEntryRingBufferMulti::InternalFrontEntryTotalSizeBytes(
 
 PrefixedEntryRingBufferMulti::EntryInfo
 PrefixedEntryRingBufferMulti::FrontEntryInfo(const Reader& reader) const {
+  if (reader.front_info_valid_) {
+    return EntryInfo{
+        .preamble_bytes = reader.front_preamble_bytes_,
+        .user_preamble = reader.front_user_preamble_,
+        .data_bytes = reader.front_data_bytes_,
+    };
+  }
   Result<PrefixedEntryRingBufferMulti::EntryInfo> entry_info =
       RawFrontEntryInfo(reader.read_idx_);
   PW_CHECK_OK(entry_info.status());
+  reader.front_preamble_bytes_ = entry_info.value().preamble_bytes;
+  reader.front_user_preamble_ = entry_info.value().user_preamble;
+  reader.front_data_bytes_ = entry_info.value().data_bytes;
+  reader.front_info_valid_ = true;
   return entry_info.value();
 }
 
@@ -340,21 +422,17 @@ PrefixedEntryRingBufferMulti::RawFrontEntryInfo(size_t source_idx) const {
   // If a preamble exists, extract the varint and it's bytes in bytes.
   size_t user_preamble_bytes = 0;
   uint64_t user_preamble_data = 0;
-  byte varint_buf[varint::kMaxVarint32SizeBytes];
   if (user_preamble_) {
-    RawRead(varint_buf, source_idx, varint::kMaxVarint32SizeBytes);
-    user_preamble_bytes = varint::Decode(varint_buf, &user_preamble_data);
+    user_preamble_bytes = RawDecodeVarint(source_idx, user_preamble_data);
     if (user_preamble_bytes == 0u) {
       return Status::DataLoss();
     }
   }
 
   // Read the entry header; extract the varint and it's bytes in bytes.
-  RawRead(varint_buf,
-          IncrementIndex(source_idx, user_preamble_bytes),
-          varint::kMaxVarint32SizeBytes);
   uint64_t entry_bytes;
-  size_t length_bytes = varint::Decode(varint_buf, &entry_bytes);
+  size_t length_bytes = RawDecodeVarint(
+      IncrementIndex(source_idx, user_preamble_bytes), entry_bytes);
   if (length_bytes == 0u) {
     return Status::DataLoss();
   }
@@ -411,6 +489,22 @@ void PrefixedEntryRingBufferMulti::RawWrite(span<const std::byte> source) {
   write_idx_ = IncrementIndex(write_idx_, source.size());
 }
 
+size_t PrefixedEntryRingBufferMulti::RawDecodeVarint(size_t source_idx,
+                                                     uint64_t& value_out)
+    const {
+  // Fast path: the varint's maximum footprint is contiguous, so decode
+  // straight out of the ring with no copy. The wrap-handling copy runs at
+  // most once per lap around the buffer.
+  const size_t contiguous = buffer_bytes_ - source_idx;
+  if (contiguous >= varint::kMaxVarint32SizeBytes) {
+    return varint::Decode(
+        span(buffer_ + source_idx, varint::kMaxVarint32SizeBytes), &value_out);
+  }
+  byte varint_buf[varint::kMaxVarint32SizeBytes];
+  RawRead(varint_buf, source_idx, varint::kMaxVarint32SizeBytes);
+  return varint::Decode(varint_buf, &value_out);
+}
+
 void PrefixedEntryRingBufferMulti::RawRead(byte* destination,
                                            size_t source_idx,
                                            size_t length_bytes) const {
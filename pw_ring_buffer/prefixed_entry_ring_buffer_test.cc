@@ -685,6 +685,129 @@ TEST(PrefixedEntryRingBufferMulti, TryPushBack) {
   EXPECT_EQ(ring.TotalUsedBytes(), 0u);
 }
 
+TEST(PrefixedEntryRingBuffer, PopEntries) {
+  PrefixedEntryRingBuffer ring(true);
+  byte test_buffer[kTestBufferSize];
+  EXPECT_EQ(ring.SetBuffer(test_buffer), OkStatus());
+
+  size_t entries_read = 0;
+  byte out[kTestBufferSize];
+
+  // Empty buffer reports OUT_OF_RANGE.
+  EXPECT_EQ(ring.PopEntries(out, entries_read).status(),
+            Status::OutOfRange());
+
+  // Push several entries, then pop them all in one call and verify that the
+  // output is the concatenation of the prefixed entries.
+  constexpr std::array<byte, 3> kValue = {
+      byte(0x12), byte(0x34), byte(0x56)};
+  constexpr size_t kEntryCount = 5;
+  for (size_t i = 0; i < kEntryCount; ++i) {
+    ASSERT_EQ(ring.PushBack(kValue, static_cast<uint32_t>(i)), OkStatus());
+  }
+
+  StatusWithSize result = ring.PopEntries(out, entries_read);
+  ASSERT_EQ(result.status(), OkStatus());
+  EXPECT_EQ(entries_read, kEntryCount);
+  // Each entry is 1 user preamble byte + 1 varint size byte + 3 data bytes.
+  ASSERT_EQ(result.size(), kEntryCount * (2 + kValue.size()));
+  for (size_t i = 0; i < kEntryCount; ++i) {
+    const byte* entry = &out[i * (2 + kValue.size())];
+    EXPECT_EQ(entry[0], byte(i));                   // user preamble
+    EXPECT_EQ(entry[1], byte(kValue.size()));       // varint size prefix
+    EXPECT_EQ(memcmp(&entry[2], kValue.data(), kValue.size()), 0);
+  }
+  EXPECT_EQ(ring.EntryCount(), 0u);
+
+  // A destination too small for even one entry reports RESOURCE_EXHAUSTED
+  // and pops nothing.
+  ASSERT_EQ(ring.PushBack(kValue, 0u), OkStatus());
+  EXPECT_EQ(ring.PopEntries(span(out).first(3), entries_read).status(),
+            Status::ResourceExhausted());
+  EXPECT_EQ(ring.EntryCount(), 1u);
+
+  // A destination that fits some but not all entries pops only what fits.
+  ASSERT_EQ(ring.PushBack(kValue, 1u), OkStatus());
+  ASSERT_EQ(ring.PushBack(kValue, 2u), OkStatus());
+  result = ring.PopEntries(span(out).first(11), entries_read);
+  ASSERT_EQ(result.status(), OkStatus());
+  EXPECT_EQ(entries_read, 2u);
+  EXPECT_EQ(result.size(), 10u);
+  EXPECT_EQ(ring.EntryCount(), 1u);
+}
+
+TEST(PrefixedEntryRingBuffer, PopEntriesInvalidatesCachedFrontEntryInfo) {
+  PrefixedEntryRingBuffer ring(false);
+  byte test_buffer[kTestBufferSize];
+  EXPECT_EQ(ring.SetBuffer(test_buffer), OkStatus());
+
+  // Entry A (4 bytes) followed by entry B (10 bytes, different contents).
+  constexpr std::array<byte, 4> kEntryA = {
+      byte(0xA0), byte(0xA1), byte(0xA2), byte(0xA3)};
+  constexpr std::array<byte, 10> kEntryB = {byte(0xB0),
+                                            byte(0xB1),
+                                            byte(0xB2),
+                                            byte(0xB3),
+                                            byte(0xB4),
+                                            byte(0xB5),
+                                            byte(0xB6),
+                                            byte(0xB7),
+                                            byte(0xB8),
+                                            byte(0xB9)};
+  ASSERT_EQ(ring.PushBack(kEntryA), OkStatus());
+  ASSERT_EQ(ring.PushBack(kEntryB), OkStatus());
+
+  // Peek caches entry A's prefix info for the reader.
+  byte out[kTestBufferSize];
+  size_t bytes_read = 0;
+  ASSERT_EQ(ring.PeekFront(out, &bytes_read), OkStatus());
+  EXPECT_EQ(bytes_read, kEntryA.size());
+
+  // Bulk-pop entry A only; the cached info must not survive the read index
+  // advancing.
+  size_t entries_read = 0;
+  ASSERT_EQ(
+      ring.PopEntries(span(out).first(1 + kEntryA.size()), entries_read)
+          .status(),
+      OkStatus());
+  ASSERT_EQ(entries_read, 1u);
+
+  // The next peek must describe entry B, not replay A's cached size.
+  ASSERT_EQ(ring.PeekFront(out, &bytes_read), OkStatus());
+  ASSERT_EQ(bytes_read, kEntryB.size());
+  EXPECT_EQ(memcmp(out, kEntryB.data(), kEntryB.size()), 0);
+
+  // And popping it advances past the full 10-byte entry.
+  EXPECT_EQ(ring.PopFront(), OkStatus());
+  EXPECT_EQ(ring.EntryCount(), 0u);
+}
+
+TEST(PrefixedEntryRingBuffer, PopEntries_WrappedEntries) {
+  PrefixedEntryRingBuffer ring(false);
+  byte test_buffer[16];
+  EXPECT_EQ(ring.SetBuffer(test_buffer), OkStatus());
+
+  // Fill and drain the ring so subsequent entries wrap the buffer end.
+  constexpr std::array<byte, 4> kValue = {
+      byte(0xaa), byte(0xbb), byte(0xcc), byte(0xdd)};
+  size_t entries_read = 0;
+  byte out[16];
+  ASSERT_EQ(ring.PushBack(kValue), OkStatus());
+  ASSERT_EQ(ring.PushBack(kValue), OkStatus());
+  ASSERT_EQ(ring.PopFront(), OkStatus());
+  ASSERT_EQ(ring.PushBack(kValue), OkStatus());  // Wraps the buffer end.
+
+  StatusWithSize result = ring.PopEntries(out, entries_read);
+  ASSERT_EQ(result.status(), OkStatus());
+  EXPECT_EQ(entries_read, 2u);
+  ASSERT_EQ(result.size(), 2 * (1 + kValue.size()));
+  for (size_t i = 0; i < 2; ++i) {
+    const byte* entry = &out[i * (1 + kValue.size())];
+    EXPECT_EQ(entry[0], byte(kValue.size()));
+    EXPECT_EQ(memcmp(&entry[1], kValue.data(), kValue.size()), 0);
+  }
+}
+
 TEST(PrefixedEntryRingBufferMulti, PushBack) {
   PrefixedEntryRingBufferMulti ring;
   byte test_buffer[kTestBufferSize];
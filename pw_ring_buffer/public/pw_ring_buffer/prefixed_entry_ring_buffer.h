@@ -21,6 +21,7 @@
 #include "pw_result/result.h"
 #include "pw_span/span.h"
 #include "pw_status/status.h"
+#include "pw_status/status_with_size.h"
 
 namespace pw {
 namespace ring_buffer {
@@ -101,6 +102,17 @@ class PrefixedEntryRingBufferMulti {
       return buffer_->InternalPeekFrontPreamble(*this, user_preamble_out);
     }
 
+    // Peeks at most `prefix.size()` bytes of the front entry's data (not
+    // including the preamble) along with its user preamble value, copying
+    // only the prefix rather than the whole entry. Lets consumers inspect
+    // entry metadata (e.g. to filter) without paying for a full copy-out.
+    Status PeekFrontPrefix(span<std::byte> prefix,
+                           size_t& bytes_read_out,
+                           uint32_t& user_preamble_out) const {
+      return buffer_->InternalPeekFrontPrefix(
+          *this, prefix, bytes_read_out, user_preamble_out);
+    }
+
     // Same as PeekFront but includes the entry's preamble of optional user
     // value and the varint of the data size.
     // TODO: b/235351847 - Move all other APIs to passing bytes_read by
@@ -132,6 +144,23 @@ class PrefixedEntryRingBufferMulti {
     // OUT_OF_RANGE - No entries in ring buffer to pop.
     Status PopFront() { return buffer_->InternalPopFront(*this); }
 
+    // Pops as many complete entries as fit into the destination span with a
+    // single prefix walk and at most two copies. Each entry is copied with
+    // its full preamble (optional user preamble byte and varint size prefix),
+    // preserving entry boundaries for reframing. The number of entries popped
+    // is written to `entries_read_out` and the number of bytes written is
+    // returned in the size.
+    //
+    // Return values:
+    // OK - One or more entries were popped into the destination span.
+    // FAILED_PRECONDITION - Buffer not initialized.
+    // OUT_OF_RANGE - No entries in ring buffer to read.
+    // RESOURCE_EXHAUSTED - The next entry does not fit in the destination
+    // span; nothing was popped.
+    StatusWithSize PopEntries(span<std::byte> data, size_t& entries_read_out) {
+      return buffer_->InternalPopEntries(*this, data, entries_read_out);
+    }
+
     // Get the size in bytes of the next chunk, not including preamble, to be
     // read.
     //
@@ -177,6 +206,14 @@ class PrefixedEntryRingBufferMulti {
     PrefixedEntryRingBufferMulti* buffer_;
     size_t read_idx_;
     size_t entry_count_;
+
+    // Cached front-entry prefix info, so repeated peeks and the final pop of
+    // the same entry decode its varint prefix once. Valid only while
+    // read_idx_ is unchanged; invalidated on every read index mutation.
+    mutable bool front_info_valid_ = false;
+    mutable size_t front_preamble_bytes_ = 0;
+    mutable uint32_t front_user_preamble_ = 0;
+    mutable size_t front_data_bytes_ = 0;
   };
 
   // An entry returned by the iterator containing the byte span of the entry
@@ -399,6 +436,10 @@ class PrefixedEntryRingBufferMulti {
 
   Status InternalPeekFrontPreamble(const Reader& reader,
                                    uint32_t& user_preamble_out) const;
+  Status InternalPeekFrontPrefix(const Reader& reader,
+                                 span<std::byte> prefix,
+                                 size_t& bytes_read_out,
+                                 uint32_t& user_preamble_out) const;
   // Same as Read but includes the entry's preamble of optional user value and
   // the varint of the data size
   Status InternalPeekFrontWithPreamble(const Reader& reader,
@@ -418,6 +459,12 @@ class PrefixedEntryRingBufferMulti {
   // OUT_OF_RANGE - No entries in ring buffer to pop.
   Status InternalPopFront(Reader& reader);
 
+  // Pop and copy out as many complete entries (with preambles) as fit in the
+  // destination span, using one prefix walk and at most two copies.
+  StatusWithSize InternalPopEntries(Reader& reader,
+                                    span<std::byte> data,
+                                    size_t& entries_read_out);
+
   // Get the size in bytes of the next chunk, not including preamble, to be
   // read.
   size_t InternalFrontEntryDataSizeBytes(const Reader& reader) const;
@@ -444,6 +491,11 @@ class PrefixedEntryRingBufferMulti {
   // FAILED_PRECONDITION - Buffer not initialized.
   Status InternalDering(Reader& reader);
 
+  // Decodes a varint at `source_idx`, reading directly from the contiguous
+  // region when possible and falling back to a wrap-handling copy otherwise.
+  // Returns the encoded size, or 0 on decode failure.
+  size_t RawDecodeVarint(size_t source_idx, uint64_t& value_out) const;
+
   struct EntryInfo {
     size_t preamble_bytes;
     uint32_t user_preamble;
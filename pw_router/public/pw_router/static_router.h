@@ -39,6 +39,19 @@ class StaticRouter {
 
   StaticRouter(span<const Route> routes) : routes_(routes) {}
 
+  // Constructs a router with O(1) direct-index dispatch. `egress_table` is a
+  // dense table where `egress_table[address - base_address]` is the egress
+  // for `address` (nullptr marks a hole with no route); it is typically a
+  // constexpr-constructed array, since concentrator addresses are known at
+  // compile time. Addresses outside the table fall back to a linear scan of
+  // `fallback_routes`, which covers sparse or dynamically chosen addresses.
+  StaticRouter(uint32_t base_address,
+               span<Egress* const> egress_table,
+               span<const Route> fallback_routes = {})
+      : routes_(fallback_routes),
+        egress_table_(egress_table),
+        base_address_(base_address) {}
+
   StaticRouter(const StaticRouter&) = delete;
   StaticRouter(StaticRouter&&) = delete;
   StaticRouter& operator=(const StaticRouter&) = delete;
@@ -63,6 +76,8 @@ class StaticRouter {
 
  private:
   const span<const Route> routes_;
+  const span<Egress* const> egress_table_;
+  const uint32_t base_address_ = 0;
   PW_METRIC_GROUP(metrics_, "static_router");
   PW_METRIC(metrics_, parser_errors_, "parser_errors", 0u);
   PW_METRIC(metrics_, route_errors_, "route_errors", 0u);
@@ -30,15 +30,26 @@ Status StaticRouter::RoutePacket(ConstByteSpan packet, PacketParser& parser) {
     return Status::DataLoss();
   }
 
-  auto route = std::find_if(routes_.begin(), routes_.end(), [&](auto r) {
-    return r.address == *maybe_address;
-  });
-  if (route == routes_.end()) {
-    route_errors_.Increment();
-    return Status::NotFound();
+  // Fast path: a single indexed load plus bounds check when the address
+  // falls within the direct-index egress table.
+  Egress* egress = nullptr;
+  const uint32_t table_index = *maybe_address - base_address_;
+  if (table_index < egress_table_.size()) {
+    egress = egress_table_[table_index];
   }
 
-  if (Status status = route->egress.SendPacket(packet, parser); !status.ok()) {
+  if (egress == nullptr) {
+    auto route = std::find_if(routes_.begin(), routes_.end(), [&](auto r) {
+      return r.address == *maybe_address;
+    });
+    if (route == routes_.end()) {
+      route_errors_.Increment();
+      return Status::NotFound();
+    }
+    egress = &route->egress;
+  }
+
+  if (Status status = egress->SendPacket(packet, parser); !status.ok()) {
     egress_errors_.Increment();
     return Status::Unavailable();
   }
@@ -118,6 +118,39 @@ TEST(StaticRouter, RoutePacket_ReturnsNotFoundOnInvalidRoute) {
             Status::NotFound());
 }
 
+TEST(StaticRouter, RoutePacket_DirectIndexTableDispatches) {
+  static Egress* const egress_table[4] = {
+      &GoodEgress, nullptr, &BadEgress, nullptr};
+  StaticRouter router(/* base_address= */ 100, egress_table);
+  BasicPacketParser parser;
+
+  // address 100 -> table[0] (good), 102 -> table[2] (bad egress).
+  BasicPacket good(100, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(good.data(), parser), OkStatus());
+  BasicPacket bad(102, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(bad.data(), parser), Status::Unavailable());
+
+  // Table holes and out-of-range addresses have no route.
+  BasicPacket hole(101, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(hole.data(), parser), Status::NotFound());
+  BasicPacket outside(99, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(outside.data(), parser), Status::NotFound());
+}
+
+TEST(StaticRouter, RoutePacket_DirectIndexFallsBackToScan) {
+  static Egress* const egress_table[2] = {&GoodEgress, nullptr};
+  static constexpr uint32_t kDynamicAddress = 7777;
+  static const StaticRouter::Route kFallback[] = {
+      {kDynamicAddress, BadEgress}};
+  StaticRouter router(/* base_address= */ 0, egress_table, kFallback);
+  BasicPacketParser parser;
+
+  BasicPacket indexed(0, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(indexed.data(), parser), OkStatus());
+  BasicPacket dynamic(kDynamicAddress, 0xdlu);
+  EXPECT_EQ(router.RoutePacket(dynamic.data(), parser), Status::Unavailable());
+}
+
 TEST(StaticRouter, RoutePacket_TracksNumberOfDrops) {
   BasicPacketParser parser;
   constexpr StaticRouter::Route routes[] = {{1, GoodEgress}, {2, BadEgress}};
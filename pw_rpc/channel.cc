@@ -70,7 +70,15 @@ Status ChannelBase::Send(const Packet& packet) {
   }
 
   PW_CHECK_NOTNULL(output_);
+  PW_RPC_PACKET_EGRESS_HOOK(encoded.value());
+#ifdef PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE
+  // Single-transport builds name their only output type in the config, so
+  // the send is a qualified, inlinable call instead of a virtual dispatch.
+  Status sent = static_cast<PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE*>(output_)
+                    ->PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE::Send(encoded.value());
+#else
   Status sent = output_->Send(encoded.value());
+#endif  // PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE
   encoding_buffer.Release();
 
   if (!sent.ok()) {
@@ -78,6 +86,13 @@ Status ChannelBase::Send(const Packet& packet) {
                  static_cast<unsigned>(id()),
                  sent.code());
 
+    // UNAVAILABLE and RESOURCE_EXHAUSTED signal transient congestion from the
+    // ChannelOutput; pass them through so callers can back off and retry.
+    // Other errors are remapped to UNKNOWN, as the failure reason is not
+    // meaningful to RPC users.
+    if (sent.IsUnavailable() || sent.IsResourceExhausted()) {
+      return sent;
+    }
     return Status::Unknown();
   }
   return OkStatus();
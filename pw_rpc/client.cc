@@ -15,6 +15,8 @@
 // clang-format off
 #include "pw_rpc/internal/log_config.h"  // PW_LOG_* macros must be first.
 
+#include "pw_rpc/internal/config.h"
+
 #include "pw_rpc/client.h"
 // clang-format on
 
@@ -32,6 +34,7 @@ using internal::pwpb::PacketType;
 }  // namespace
 
 Status Client::ProcessPacket(ConstByteSpan data) {
+  PW_RPC_PACKET_INGRESS_HOOK(data);
   PW_TRY_ASSIGN(Packet packet, Endpoint::ProcessPacket(data, Packet::kClient));
 
   // Find an existing call for this RPC, if any.
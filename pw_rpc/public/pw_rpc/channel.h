@@ -124,6 +124,11 @@ class ChannelOutput {
   // even if the current packet could not be sent. Returns any other status if
   // the Channel is no longer able to send packets.
   //
+  // Congested outputs (e.g. a full transmit queue) should return UNAVAILABLE
+  // or RESOURCE_EXHAUSTED: these propagate to the Write()/Finish() caller as
+  // backpressure so it can retry after backing off, while other errors are
+  // reported as UNKNOWN.
+  //
   // The RPC system’s internal lock is held while this function is called. Avoid
   // long-running operations, since these will delay any other users of the RPC
   // system.
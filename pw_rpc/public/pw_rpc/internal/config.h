@@ -233,6 +233,42 @@ static_assert(
 #define PW_RPC_MAKE_UNIQUE_PTR_INCLUDE <memory>
 #endif  // PW_RPC_MAKE_UNIQUE_PTR_INCLUDE
 
+/// @def PW_RPC_PACKET_INGRESS_HOOK
+///
+/// Invoked with the raw encoded packet (as a `pw::ConstByteSpan`) when a
+/// packet enters `Server::ProcessPacket` or `Client::ProcessPacket`, before
+/// any decoding. Platforms use this for latency instrumentation, e.g.
+/// capturing a cycle counter or hardware timestamp and correlating it with
+/// the matching egress hook. Must be cheap; it runs on every packet.
+#ifndef PW_RPC_PACKET_INGRESS_HOOK
+#define PW_RPC_PACKET_INGRESS_HOOK(encoded_packet)
+#endif  // PW_RPC_PACKET_INGRESS_HOOK
+
+/// @def PW_RPC_PACKET_EGRESS_HOOK
+///
+/// Invoked with the encoded outgoing packet (as a `pw::ConstByteSpan`)
+/// immediately before it is handed to the `ChannelOutput`. Together with the
+/// ingress hook, this brackets pw_rpc's processing so dispatch and encoding
+/// latency can be measured against transport timestamps.
+#ifndef PW_RPC_PACKET_EGRESS_HOOK
+#define PW_RPC_PACKET_EGRESS_HOOK(encoded_packet)
+#endif  // PW_RPC_PACKET_EGRESS_HOOK
+
+/// @def PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE
+///
+/// Binds packet egress to a single concrete `ChannelOutput` type at compile
+/// time, analogous to how pw_log binds its backend. When set to the
+/// fully-qualified name of the output class used by every channel in the
+/// build, `internal::ChannelBase::Send` downcasts to that type and invokes
+/// its `Send` with a qualified (non-virtual) call, letting the compiler
+/// inline the transport's framing into the egress path. Only valid on
+/// single-transport builds: every registered `ChannelOutput` must be of
+/// exactly this type (enforced only by the cast). Multi-transport builds
+/// leave this unset and keep the virtual registry.
+#ifdef PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE
+// No default: the virtual path is used unless a type is provided.
+#endif  // PW_RPC_STATIC_CHANNEL_OUTPUT_TYPE
+
 /// Size of the global RPC packet encoding buffer in bytes. If dynamic
 /// allocation is enabled, this value is only used for test helpers that
 /// allocate RPC encoding buffers.
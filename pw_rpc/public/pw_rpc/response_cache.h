@@ -0,0 +1,145 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_rpc/response_cache.h
+///
+/// Optional response cache for read-mostly unary methods. Methods like
+/// device-info or capability queries recompute and re-encode an identical
+/// response for every client -- a reconnect storm repeats that work
+/// thousands of times. A service embeds a `ResponseCache` and consults it at
+/// the top of such handlers: on a hit the stored encoded payload is sent
+/// directly, skipping both handler execution and proto encoding. The
+/// application invalidates explicitly when the underlying data changes.
+///
+/// @code{.cpp}
+///   void DeviceInfo(ConstByteSpan request, RawUnaryResponder& responder) {
+///     if (auto hit = cache_.Lookup(kDeviceInfoId, request); hit.has_value()) {
+///       responder.Finish(*hit).IgnoreError();
+///       return;
+///     }
+///     // ... build and encode the response into `encoded` ...
+///     cache_.Store(kDeviceInfoId, request, encoded);
+///     responder.Finish(encoded).IgnoreError();
+///   }
+/// @endcode
+///
+/// Entries are matched on the full request bytes (the hash is only a fast
+/// reject), so a hit never returns a response for a different request. Not
+/// internally synchronized: guard with the caller's existing serialization
+/// (RPC callbacks on one thread) or an external lock.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include "pw_bytes/span.h"
+
+namespace pw::rpc {
+
+/// Caches up to `kMaxEntries` encoded responses, each for a request of up to
+/// `kMaxRequestSize` bytes and a response of up to `kMaxResponseSize` bytes.
+template <size_t kMaxEntries,
+          size_t kMaxRequestSize,
+          size_t kMaxResponseSize>
+class ResponseCache {
+ public:
+  /// Returns the encoded response cached for this method and request, if
+  /// any. The returned span is valid until the entry is evicted or
+  /// invalidated.
+  std::optional<ConstByteSpan> Lookup(uint32_t method_id,
+                                      ConstByteSpan request) const {
+    if (request.size() > kMaxRequestSize) {
+      return std::nullopt;
+    }
+    const uint32_t hash = Hash(request);
+    for (const Entry& entry : entries_) {
+      if (entry.used && entry.method_id == method_id &&
+          entry.request_hash == hash && entry.request_size == request.size() &&
+          std::memcmp(entry.request.data(),
+                      request.data(),
+                      request.size()) == 0) {
+        return ConstByteSpan(entry.response.data(), entry.response_size);
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// Caches `encoded_response` for this method and request, evicting the
+  /// oldest entry if the cache is full. Oversized requests or responses are
+  /// not cached (the next lookup simply misses).
+  void Store(uint32_t method_id,
+             ConstByteSpan request,
+             ConstByteSpan encoded_response) {
+    if (request.size() > kMaxRequestSize ||
+        encoded_response.size() > kMaxResponseSize) {
+      return;
+    }
+    Entry& entry = entries_[next_slot_];
+    next_slot_ = (next_slot_ + 1) % kMaxEntries;
+
+    entry.used = true;
+    entry.method_id = method_id;
+    entry.request_hash = Hash(request);
+    entry.request_size = request.size();
+    std::memcpy(entry.request.data(), request.data(), request.size());
+    entry.response_size = encoded_response.size();
+    std::memcpy(entry.response.data(),
+                encoded_response.data(),
+                encoded_response.size());
+  }
+
+  /// Drops every cached response.
+  void Invalidate() {
+    for (Entry& entry : entries_) {
+      entry.used = false;
+    }
+  }
+
+  /// Drops every cached response for one method.
+  void InvalidateMethod(uint32_t method_id) {
+    for (Entry& entry : entries_) {
+      if (entry.method_id == method_id) {
+        entry.used = false;
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    std::array<std::byte, kMaxRequestSize> request;
+    std::array<std::byte, kMaxResponseSize> response;
+    uint32_t method_id = 0;
+    uint32_t request_hash = 0;
+    size_t request_size = 0;
+    size_t response_size = 0;
+    bool used = false;
+  };
+
+  // FNV-1a; used only as a fast reject before the exact request compare.
+  static uint32_t Hash(ConstByteSpan data) {
+    uint32_t hash = 2166136261u;
+    for (std::byte b : data) {
+      hash ^= static_cast<uint32_t>(b);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+  std::array<Entry, kMaxEntries> entries_ = {};
+  size_t next_slot_ = 0;
+};
+
+}  // namespace pw::rpc
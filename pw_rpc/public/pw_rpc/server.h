@@ -54,11 +54,12 @@ class Server : public internal::Endpoint {
   void RegisterService(Service& service, OtherServices&... services)
       PW_LOCKS_EXCLUDED(internal::rpc_lock()) {
     internal::RpcLockGuard lock;
+    service.CacheMethodIdOrder();
     services_.push_front(service);  // Register the first service
 
     // Register any additional services by expanding the parameter pack. This
     // is a fold expression of the comma operator.
-    (services_.push_front(services), ...);
+    ((services.CacheMethodIdOrder(), services_.push_front(services)), ...);
   }
 
   // Returns whether a service is registered.
@@ -201,6 +202,9 @@ class Server : public internal::Endpoint {
   void UnregisterServiceLocked(Service& service, OtherServices&... services)
       PW_EXCLUSIVE_LOCKS_REQUIRED(internal::rpc_lock()) {
     services_.remove(service);
+    if (last_service_ == &service) {
+      last_service_ = nullptr;
+    }
     UnregisterServiceLocked(services...);
     AbortCallsForService(service);
   }
@@ -217,6 +221,9 @@ class Server : public internal::Endpoint {
   using Endpoint::GetInternalChannel;
 
   IntrusiveList<Service> services_ PW_GUARDED_BY(internal::rpc_lock());
+
+  // The service that handled the previous packet; see FindMethodLocked.
+  Service* last_service_ PW_GUARDED_BY(internal::rpc_lock()) = nullptr;
 };
 
 }  // namespace pw::rpc
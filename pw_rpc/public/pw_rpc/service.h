@@ -74,10 +74,16 @@ class Service : public IntrusiveList<Service>::Item {
   // Finds the method with the provided method_id. Returns nullptr if no match.
   const internal::Method* FindMethod(uint32_t method_id) const;
 
+  // Records whether the method ids are in ascending order, so FindMethod can
+  // binary search instead of scanning. Called by the server at registration;
+  // codegen emits sorted method tables, so generated services qualify.
+  void CacheMethodIdOrder();
+
   const uint32_t id_;
   const internal::MethodUnion* const methods_;
   const uint16_t method_size_;
   const uint16_t method_count_;
+  bool method_ids_ascending_ = false;
 };
 
 }  // namespace pw::rpc
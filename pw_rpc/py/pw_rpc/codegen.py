@@ -54,6 +54,16 @@ def get_id(item: ProtoService | ProtoServiceMethod) -> str:
     return f'0x{ids.calculate(name):08x}'
 
 
+def methods_by_id(service: ProtoService) -> list[ProtoServiceMethod]:
+    """Service methods sorted by method id.
+
+    The C++ method tables are emitted in this order so the server can binary
+    search them by id; Service::FindMethod checks for ascending ids at
+    registration.
+    """
+    return sorted(service.methods(), key=lambda method: int(get_id(method), 16))
+
+
 def client_call_type(method: ProtoServiceMethod, prefix: str) -> str:
     """Returns Client ReaderWriter/Reader/Writer/Recevier for the call."""
     if method.type() is ProtoServiceMethod.Type.UNARY:
@@ -418,7 +428,7 @@ def _generate_service(gen: CodeGenerator, service: ProtoService) -> None:
         )
 
         with gen.indent(4):
-            for method in service.methods():
+            for method in methods_by_id(service):
                 gen.method_descriptor(method)
 
         gen.line('};\n')
@@ -437,7 +447,7 @@ def _method_lookup_table(gen: CodeGenerator, service: ProtoService) -> None:
     )
 
     with gen.indent(4):
-        for method in service.methods():
+        for method in methods_by_id(service):
             gen.line(f'{get_id(method)},  // Hash of "{method.name()}"')
 
     gen.line('};')
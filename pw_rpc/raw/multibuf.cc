@@ -0,0 +1,30 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_rpc/raw/multibuf.h"
+
+#include "pw_status/status_with_size.h"
+
+namespace pw::rpc {
+
+Status WriteFromMultiBuf(Writer& writer, const multibuf::MultiBuf& payload) {
+  return writer.Write([&payload](ByteSpan buffer) -> StatusWithSize {
+    if (payload.size() > buffer.size()) {
+      return StatusWithSize::ResourceExhausted();
+    }
+    return payload.CopyTo(buffer);
+  });
+}
+
+}  // namespace pw::rpc
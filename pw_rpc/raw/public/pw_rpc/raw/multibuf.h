@@ -0,0 +1,43 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include "pw_multibuf/multibuf.h"
+#include "pw_rpc/writer.h"
+#include "pw_status/status.h"
+
+namespace pw::rpc {
+
+/// @brief Sends a scattered payload as a single raw stream write.
+///
+/// The payload chunks are gathered directly into the packet encoding buffer,
+/// so the payload is copied exactly once and never staged in a contiguous
+/// caller buffer. Useful for forwarding data that arrives as ``MultiBuf``
+/// chunks (e.g. from ``pw_channel`` or DMA buffer pools) over an RPC stream.
+///
+/// @returns @rst
+///
+/// .. pw-status-codes::
+///
+///    OK: The payload was sent.
+///
+///    RESOURCE_EXHAUSTED: The payload does not fit in the packet encoding
+///    buffer.
+///
+/// Otherwise, returns the statuses of ``pw::rpc::Writer::Write``.
+///
+/// @endrst
+Status WriteFromMultiBuf(Writer& writer, const multibuf::MultiBuf& payload);
+
+}  // namespace pw::rpc
@@ -0,0 +1,90 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_rpc/response_cache.h"
+
+#include <cstring>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::rpc {
+namespace {
+
+ConstByteSpan Bytes(const char* str) {
+  return as_bytes(span(str, std::strlen(str)));
+}
+
+TEST(ResponseCache, MissThenHit) {
+  ResponseCache<4, 32, 64> cache;
+  EXPECT_FALSE(cache.Lookup(1, Bytes("req")).has_value());
+
+  cache.Store(1, Bytes("req"), Bytes("encoded-response"));
+  auto hit = cache.Lookup(1, Bytes("req"));
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(hit->size(), std::strlen("encoded-response"));
+  EXPECT_EQ(std::memcmp(hit->data(), "encoded-response", hit->size()), 0);
+}
+
+TEST(ResponseCache, KeyedByMethodAndRequest) {
+  ResponseCache<4, 32, 64> cache;
+  cache.Store(1, Bytes("a"), Bytes("for-a"));
+
+  EXPECT_FALSE(cache.Lookup(2, Bytes("a")).has_value());  // Other method.
+  EXPECT_FALSE(cache.Lookup(1, Bytes("b")).has_value());  // Other request.
+  EXPECT_TRUE(cache.Lookup(1, Bytes("a")).has_value());
+}
+
+TEST(ResponseCache, InvalidateDropsEntries) {
+  ResponseCache<4, 32, 64> cache;
+  cache.Store(1, Bytes("a"), Bytes("r1"));
+  cache.Store(2, Bytes("a"), Bytes("r2"));
+
+  cache.InvalidateMethod(1);
+  EXPECT_FALSE(cache.Lookup(1, Bytes("a")).has_value());
+  EXPECT_TRUE(cache.Lookup(2, Bytes("a")).has_value());
+
+  cache.Invalidate();
+  EXPECT_FALSE(cache.Lookup(2, Bytes("a")).has_value());
+}
+
+TEST(ResponseCache, EvictsOldestWhenFull) {
+  ResponseCache<2, 32, 64> cache;
+  cache.Store(1, Bytes("a"), Bytes("r1"));
+  cache.Store(1, Bytes("b"), Bytes("r2"));
+  cache.Store(1, Bytes("c"), Bytes("r3"));  // Evicts "a".
+
+  EXPECT_FALSE(cache.Lookup(1, Bytes("a")).has_value());
+  EXPECT_TRUE(cache.Lookup(1, Bytes("b")).has_value());
+  EXPECT_TRUE(cache.Lookup(1, Bytes("c")).has_value());
+}
+
+TEST(ResponseCache, OversizedRequestsAndResponsesAreNotCached) {
+  ResponseCache<2, 4, 8> cache;
+  cache.Store(1, Bytes("too-long-request"), Bytes("r"));
+  EXPECT_FALSE(cache.Lookup(1, Bytes("too-long-request")).has_value());
+
+  cache.Store(1, Bytes("ok"), Bytes("response-too-long"));
+  EXPECT_FALSE(cache.Lookup(1, Bytes("ok")).has_value());
+}
+
+TEST(ResponseCache, EmptyRequestIsValidKey) {
+  ResponseCache<2, 4, 8> cache;
+  cache.Store(1, ConstByteSpan(), Bytes("dflt"));
+  auto hit = cache.Lookup(1, ConstByteSpan());
+  ASSERT_TRUE(hit.has_value());
+  EXPECT_EQ(hit->size(), 4u);
+}
+
+}  // namespace
+}  // namespace pw::rpc
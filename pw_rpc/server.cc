@@ -15,6 +15,8 @@
 // clang-format off
 #include "pw_rpc/internal/log_config.h" // PW_LOG_* macros must be first.
 
+#include "pw_rpc/internal/config.h"
+
 #include "pw_rpc/server.h"
 // clang-format on
 
@@ -34,6 +36,7 @@ using internal::pwpb::PacketType;
 }  // namespace
 
 Status Server::ProcessPacket(ConstByteSpan packet_data) {
+  PW_RPC_PACKET_INGRESS_HOOK(packet_data);
   PW_TRY_ASSIGN(Packet packet,
                 Endpoint::ProcessPacket(packet_data, Packet::kServer));
   return ProcessPacket(packet);
@@ -127,6 +130,15 @@ std::tuple<Service*, const internal::Method*> Server::FindMethod(
 
 std::tuple<Service*, const internal::Method*> Server::FindMethodLocked(
     uint32_t service_id, uint32_t method_id) {
+  // Traffic is dominated by repeated calls to the same service, so check the
+  // service that handled the previous packet before scanning the registry.
+  // The cached pointer is validated against the requested ID and cleared by
+  // UnregisterService, so it can never go stale.
+  if (last_service_ != nullptr &&
+      internal::UnwrapServiceId(last_service_->service_id()) == service_id) {
+    return {last_service_, last_service_->FindMethod(method_id)};
+  }
+
   auto service = std::find_if(services_.begin(), services_.end(), [&](auto& s) {
     return internal::UnwrapServiceId(s.service_id()) == service_id;
   });
@@ -135,6 +147,7 @@ std::tuple<Service*, const internal::Method*> Server::FindMethodLocked(
     return {};
   }
 
+  last_service_ = &(*service);
   return {&(*service), service->FindMethod(method_id)};
 }
 
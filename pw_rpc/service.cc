@@ -19,21 +19,59 @@
 
 namespace pw::rpc {
 
+namespace {
+
+// Methods are stored as concrete MethodUnion objects of runtime-known size;
+// index into the array by byte stride.
+const internal::Method& MethodAt(const internal::MethodUnion* methods,
+                                 size_t method_size,
+                                 size_t index) {
+  const auto raw = reinterpret_cast<const std::byte*>(methods);
+  return reinterpret_cast<const internal::MethodUnion*>(raw +
+                                                        index * method_size)
+      ->method();
+}
+
+}  // namespace
+
 const internal::Method* Service::FindMethod(uint32_t method_id) const {
-  const internal::MethodUnion* method_impl = methods_;
+  if (method_ids_ascending_) {
+    size_t lower = 0;
+    size_t upper = method_count_;
+    while (lower < upper) {
+      const size_t middle = (lower + upper) / 2;
+      const internal::Method& method = MethodAt(methods_, method_size_, middle);
+      if (method.id() == method_id) {
+        return &method;
+      }
+      if (method.id() < method_id) {
+        lower = middle + 1;
+      } else {
+        upper = middle;
+      }
+    }
+    return nullptr;
+  }
 
   for (size_t i = 0; i < method_count_; ++i) {
-    const internal::Method* method = &method_impl->method();
-    if (method->id() == method_id) {
-      return method;
+    const internal::Method& method = MethodAt(methods_, method_size_, i);
+    if (method.id() == method_id) {
+      return &method;
     }
-
-    const auto raw = reinterpret_cast<const std::byte*>(method_impl);
-    method_impl =
-        reinterpret_cast<const internal::MethodUnion*>(raw + method_size_);
   }
 
   return nullptr;
 }
 
+void Service::CacheMethodIdOrder() {
+  for (size_t i = 1; i < method_count_; ++i) {
+    if (MethodAt(methods_, method_size_, i - 1).id() >=
+        MethodAt(methods_, method_size_, i).id()) {
+      method_ids_ascending_ = false;
+      return;
+    }
+  }
+  method_ids_ascending_ = method_count_ > 1;
+}
+
 }  // namespace pw::rpc
@@ -0,0 +1,79 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_rpc_transport/batched_frame_sender.h"
+
+#include <array>
+#include <vector>
+
+#include "pw_bytes/array.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::rpc {
+namespace {
+
+class RecordingSender : public RpcFrameSender {
+ public:
+  size_t MaximumTransmissionUnit() const override { return 128; }
+
+  Status Send(RpcFrame frame) override {
+    std::vector<std::byte> bytes(frame.header.begin(), frame.header.end());
+    bytes.insert(bytes.end(), frame.payload.begin(), frame.payload.end());
+    sends.push_back(std::move(bytes));
+    return OkStatus();
+  }
+
+  std::vector<std::vector<std::byte>> sends;
+};
+
+TEST(BatchedRpcFrameSender, AggregatesFramesIntoOneWrite) {
+  RecordingSender inner;
+  BatchedRpcFrameSender<16> sender(inner);
+  EXPECT_EQ(sender.MaximumTransmissionUnit(), 128u);
+
+  constexpr auto kHeader = bytes::Array<0xAA>();
+  constexpr auto kPayload = bytes::Array<1, 2, 3>();
+  ASSERT_EQ(OkStatus(), sender.Send({.header = kHeader, .payload = kPayload}));
+  ASSERT_EQ(OkStatus(), sender.Send({.header = kHeader, .payload = kPayload}));
+  EXPECT_TRUE(inner.sends.empty());  // Still aggregating.
+  EXPECT_EQ(sender.buffered_bytes(), 8u);
+
+  ASSERT_EQ(OkStatus(), sender.Flush());
+  ASSERT_EQ(inner.sends.size(), 1u);
+  EXPECT_EQ(inner.sends[0].size(), 8u);
+  EXPECT_EQ(inner.sends[0][0], std::byte{0xAA});
+  EXPECT_EQ(inner.sends[0][4], std::byte{0xAA});
+}
+
+TEST(BatchedRpcFrameSender, FlushesWhenFullAndPassesThroughJumboFrames) {
+  RecordingSender inner;
+  BatchedRpcFrameSender<8> sender(inner);
+
+  constexpr auto kSix = bytes::Array<1, 2, 3, 4, 5, 6>();
+  ASSERT_EQ(OkStatus(), sender.Send({.header = {}, .payload = kSix}));
+  // The next frame does not fit, forcing a flush of the first.
+  ASSERT_EQ(OkStatus(), sender.Send({.header = {}, .payload = kSix}));
+  ASSERT_EQ(inner.sends.size(), 1u);
+  EXPECT_EQ(inner.sends[0].size(), 6u);
+
+  // A frame larger than the buffer flushes pending data and passes through.
+  constexpr auto kJumbo = bytes::Array<9, 9, 9, 9, 9, 9, 9, 9, 9>();
+  ASSERT_EQ(OkStatus(), sender.Send({.header = {}, .payload = kJumbo}));
+  ASSERT_EQ(inner.sends.size(), 3u);
+  EXPECT_EQ(inner.sends[1].size(), 6u);  // Flushed pending frame.
+  EXPECT_EQ(inner.sends[2].size(), 9u);  // Jumbo pass-through.
+}
+
+}  // namespace
+}  // namespace pw::rpc
@@ -0,0 +1,91 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "pw_bytes/span.h"
+#include "pw_rpc_transport/rpc_transport.h"
+#include "pw_status/status.h"
+
+namespace pw::rpc {
+
+/// `RpcFrameSender` decorator that aggregates multiple frames into one write
+/// to the underlying transport.
+///
+/// Each frame handed to an egress normally becomes its own transport write,
+/// which for socket or mailbox transports costs a syscall or doorbell per
+/// frame. Since frames are already self-delimiting after encoding, their
+/// bytes can be concatenated for stream-style transports: this sender copies
+/// frames into an aggregation buffer and flushes them as a single write when
+/// the buffer cannot fit the next frame, when a frame exceeds the flush
+/// threshold, or on an explicit `Flush()` (e.g. from a timer for latency
+/// bounds).
+///
+/// The inner transport's MTU is reported unchanged, so packets are still
+/// fragmented for the real transport; only the write granularity changes.
+/// Not synchronized: `RpcEgress` already serializes senders with its mutex.
+template <size_t kBufferSize>
+class BatchedRpcFrameSender : public RpcFrameSender {
+ public:
+  explicit BatchedRpcFrameSender(RpcFrameSender& inner) : inner_(inner) {}
+
+  size_t MaximumTransmissionUnit() const override {
+    return inner_.MaximumTransmissionUnit();
+  }
+
+  Status Send(RpcFrame frame) override {
+    const size_t frame_size = frame.header.size() + frame.payload.size();
+    if (frame_size > kBufferSize) {
+      // Too large to stage; flush what we have and pass the frame through.
+      if (Status status = Flush(); !status.ok()) {
+        return status;
+      }
+      return inner_.Send(frame);
+    }
+    if (buffered_ + frame_size > kBufferSize) {
+      if (Status status = Flush(); !status.ok()) {
+        return status;
+      }
+    }
+    std::memcpy(buffer_ + buffered_, frame.header.data(), frame.header.size());
+    buffered_ += frame.header.size();
+    std::memcpy(
+        buffer_ + buffered_, frame.payload.data(), frame.payload.size());
+    buffered_ += frame.payload.size();
+    return OkStatus();
+  }
+
+  /// Writes all aggregated frames to the underlying transport as one frame.
+  Status Flush() {
+    if (buffered_ == 0) {
+      return OkStatus();
+    }
+    const size_t to_send = buffered_;
+    buffered_ = 0;
+    return inner_.Send(
+        RpcFrame{.header = {}, .payload = ConstByteSpan(buffer_, to_send)});
+  }
+
+  /// The number of bytes currently aggregated.
+  size_t buffered_bytes() const { return buffered_; }
+
+ private:
+  RpcFrameSender& inner_;
+  size_t buffered_ = 0;
+  std::byte buffer_[kBufferSize];
+};
+
+}  // namespace pw::rpc
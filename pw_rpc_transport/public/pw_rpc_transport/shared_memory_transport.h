@@ -0,0 +1,177 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "pw_assert/assert.h"
+#include "pw_bytes/span.h"
+#include "pw_function/function.h"
+#include "pw_rpc_transport/rpc_transport.h"
+#include "pw_status/status.h"
+
+namespace pw::rpc {
+
+/// Shared-memory RPC transport for asymmetric multiprocessing (AMP) cores.
+///
+/// Each direction is one `SharedMemoryTransport` over a region visible to
+/// both cores (one region per direction). The sender core writes
+/// length-prefixed frames directly into the shared ring -- the only copy is
+/// from the packet encoding buffer into shared memory, with no intermediate
+/// staging -- and rings the peer's doorbell via the notify callback (e.g. a
+/// mailbox interrupt). The receiving core's `ProcessIncomingFrames` hands the
+/// peer's frames to a callback as views into shared memory, so receive is
+/// zero-copy until the RPC endpoint parses the packet.
+///
+/// The region must be mapped uncached or the cores must be cache-coherent;
+/// the ring indices use atomics with acquire/release ordering for
+/// synchronization. Single producer and single consumer per direction.
+class SharedMemoryTransport : public RpcFrameSender {
+ public:
+  /// Control block placed at the start of the shared region.
+  struct ControlBlock {
+    std::atomic<uint32_t> write_offset;
+    std::atomic<uint32_t> read_offset;
+  };
+
+  static constexpr size_t kFrameHeaderSize = sizeof(uint32_t);
+
+  /// @param[in] region The shared memory region for this direction. The
+  /// first `sizeof(ControlBlock)` bytes hold the ring indices; the initiator
+  /// core must zero the region before both sides attach. The region must be
+  /// aligned for the control block's atomics, and the remaining data area
+  /// (`region.size() - sizeof(ControlBlock)`) must be a power of two: the
+  /// ring offsets are free-running 32-bit counters, and a non-power-of-two
+  /// size breaks the offset-to-index mapping when they wrap (after ~4 GB of
+  /// traffic on a long-lived link).
+  /// @param[in] mtu The maximum RPC frame size to advertise.
+  /// @param[in] notify_peer Invoked after a frame is published, e.g. to ring
+  /// a mailbox doorbell. May be empty if the peer polls.
+  SharedMemoryTransport(ByteSpan region,
+                        size_t mtu,
+                        Function<void()>&& notify_peer = nullptr)
+      : control_(*reinterpret_cast<ControlBlock*>(region.data())),
+        data_(region.subspan(sizeof(ControlBlock))),
+        mtu_(mtu),
+        notify_peer_(std::move(notify_peer)) {
+    PW_ASSERT(reinterpret_cast<uintptr_t>(region.data()) %
+                  alignof(ControlBlock) ==
+              0);
+    PW_ASSERT(!data_.empty() && (data_.size() & (data_.size() - 1)) == 0);
+  }
+
+  size_t MaximumTransmissionUnit() const override { return mtu_; }
+
+  /// Publishes one frame into the shared ring. Returns RESOURCE_EXHAUSTED if
+  /// the peer has not consumed enough space yet.
+  Status Send(RpcFrame frame) override {
+    const uint32_t frame_size =
+        static_cast<uint32_t>(frame.header.size() + frame.payload.size());
+    const size_t record_size = kFrameHeaderSize + frame_size;
+    if (record_size > data_.size()) {
+      return Status::InvalidArgument();
+    }
+
+    const uint32_t write =
+        control_.write_offset.load(std::memory_order_relaxed);
+    const uint32_t read = control_.read_offset.load(std::memory_order_acquire);
+    if (data_.size() - static_cast<size_t>(write - read) < record_size) {
+      return Status::ResourceExhausted();
+    }
+
+    WriteRing(write, &frame_size, kFrameHeaderSize);
+    WriteRing(
+        write + kFrameHeaderSize, frame.header.data(), frame.header.size());
+    WriteRing(write + kFrameHeaderSize + frame.header.size(),
+              frame.payload.data(),
+              frame.payload.size());
+    control_.write_offset.store(write + static_cast<uint32_t>(record_size),
+                                std::memory_order_release);
+    if (notify_peer_ != nullptr) {
+      notify_peer_();
+    }
+    return OkStatus();
+  }
+
+  /// Consumes all frames published by the peer, invoking `handler` with each
+  /// frame's bytes. For contiguous (non-wrapping) frames the span aliases
+  /// shared memory directly; wrapped frames are reassembled into
+  /// `reassembly_buffer`, which must be at least MTU + header bytes.
+  ///
+  /// Call from the receiving core, e.g. from the doorbell interrupt's
+  /// bottom half. Single consumer.
+  Status ProcessIncomingFrames(const Function<void(ConstByteSpan)>& handler,
+                               ByteSpan reassembly_buffer) {
+    while (true) {
+      const uint32_t read =
+          control_.read_offset.load(std::memory_order_relaxed);
+      const uint32_t write =
+          control_.write_offset.load(std::memory_order_acquire);
+      if (read == write) {
+        return OkStatus();
+      }
+
+      uint32_t frame_size;
+      ReadRing(read, &frame_size, kFrameHeaderSize);
+      if (frame_size > data_.size() - kFrameHeaderSize) {
+        return Status::DataLoss();  // Corrupt ring.
+      }
+
+      const size_t data_start = (read + kFrameHeaderSize) % data_.size();
+      if (data_start + frame_size <= data_.size()) {
+        // Zero-copy: the frame is contiguous in shared memory.
+        handler(ConstByteSpan(data_.data() + data_start, frame_size));
+      } else {
+        if (reassembly_buffer.size() < frame_size) {
+          return Status::ResourceExhausted();
+        }
+        ReadRing(read + kFrameHeaderSize, reassembly_buffer.data(), frame_size);
+        handler(reassembly_buffer.first(frame_size));
+      }
+      control_.read_offset.store(read + kFrameHeaderSize + frame_size,
+                                 std::memory_order_release);
+    }
+  }
+
+ private:
+  void WriteRing(uint32_t offset, const void* source, size_t size) {
+    const size_t start = offset % data_.size();
+    const size_t first =
+        size < data_.size() - start ? size : data_.size() - start;
+    std::memcpy(data_.data() + start, source, first);
+    std::memcpy(data_.data(),
+                static_cast<const std::byte*>(source) + first,
+                size - first);
+  }
+
+  void ReadRing(uint32_t offset, void* destination, size_t size) {
+    const size_t start = offset % data_.size();
+    const size_t first =
+        size < data_.size() - start ? size : data_.size() - start;
+    std::memcpy(destination, data_.data() + start, first);
+    std::memcpy(static_cast<std::byte*>(destination) + first,
+                data_.data(),
+                size - first);
+  }
+
+  ControlBlock& control_;
+  ByteSpan data_;
+  size_t mtu_;
+  Function<void()> notify_peer_;
+};
+
+}  // namespace pw::rpc
@@ -0,0 +1,87 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_rpc_transport/shared_memory_transport.h"
+
+#include <array>
+#include <vector>
+
+#include "pw_bytes/array.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::rpc {
+namespace {
+
+class SharedMemoryTransportTest : public ::testing::Test {
+ protected:
+  SharedMemoryTransportTest() {
+    region_.fill(std::byte{0});
+    transport_.emplace(region_, /*mtu=*/32, [this] { doorbells_ += 1; });
+  }
+
+  std::array<std::byte, sizeof(SharedMemoryTransport::ControlBlock) + 64>
+      region_;
+  std::optional<SharedMemoryTransport> transport_;
+  int doorbells_ = 0;
+};
+
+TEST_F(SharedMemoryTransportTest, SendsAndReceivesFrames) {
+  constexpr auto kHeader = bytes::Array<0xAB>();
+  constexpr auto kPayload = bytes::Array<1, 2, 3, 4>();
+  ASSERT_EQ(OkStatus(),
+            transport_->Send({.header = kHeader, .payload = kPayload}));
+  ASSERT_EQ(OkStatus(), transport_->Send({.header = {}, .payload = kPayload}));
+  EXPECT_EQ(doorbells_, 2);
+
+  std::vector<std::vector<std::byte>> frames;
+  std::array<std::byte, 64> reassembly;
+  ASSERT_EQ(OkStatus(),
+            transport_->ProcessIncomingFrames(
+                [&frames](ConstByteSpan frame) {
+                  frames.emplace_back(frame.begin(), frame.end());
+                },
+                reassembly));
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0].size(), 5u);
+  EXPECT_EQ(frames[0][0], std::byte{0xAB});
+  EXPECT_EQ(frames[1].size(), 4u);
+}
+
+TEST_F(SharedMemoryTransportTest, ReportsBackpressureWhenFull) {
+  constexpr auto kPayload =
+      bytes::Array<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>();
+  // Each record is 4 + 16 bytes; the 64-byte ring fits three.
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(OkStatus(), transport_->Send({.header = {}, .payload = kPayload}));
+  }
+  EXPECT_EQ(Status::ResourceExhausted(),
+            transport_->Send({.header = {}, .payload = kPayload}));
+
+  // Draining frees space for more frames, including wrapped ones.
+  std::array<std::byte, 64> reassembly;
+  int received = 0;
+  ASSERT_EQ(OkStatus(),
+            transport_->ProcessIncomingFrames(
+                [&received](ConstByteSpan) { received += 1; }, reassembly));
+  EXPECT_EQ(received, 3);
+  ASSERT_EQ(OkStatus(), transport_->Send({.header = {}, .payload = kPayload}));
+  received = 0;
+  ASSERT_EQ(OkStatus(),
+            transport_->ProcessIncomingFrames(
+                [&received](ConstByteSpan) { received += 1; }, reassembly));
+  EXPECT_EQ(received, 1);
+}
+
+}  // namespace
+}  // namespace pw::rpc
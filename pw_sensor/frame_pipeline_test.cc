@@ -0,0 +1,130 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sensor/frame_pipeline.h"
+
+#include <array>
+#include <cstring>
+
+#include "pw_allocator/testing.h"
+#include "pw_multibuf/header_chunk_region_tracker.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::sensor {
+namespace {
+
+using ::pw::allocator::test::AllocatorForTest;
+using ::pw::multibuf::HeaderChunkRegionTracker;
+using ::pw::multibuf::OwnedChunk;
+
+class FramePipelineTest : public ::testing::Test {
+ protected:
+  OwnedChunk MakeFrame(uint64_t timestamp, uint32_t sample_count) {
+    std::optional<OwnedChunk> chunk =
+        HeaderChunkRegionTracker::AllocateRegionAsChunk(
+            allocator_, sizeof(FrameHeader) + sample_count * sizeof(int16_t));
+    PW_ASSERT(chunk.has_value());
+    FrameHeader header = {
+        .timestamp = timestamp,
+        .measurement_type = 0,
+        .sample_count = sample_count,
+        .sample_stride_bytes = sizeof(int16_t),
+    };
+    std::memcpy(chunk->data(), &header, sizeof(header));
+    return std::move(*chunk);
+  }
+
+  static uint64_t Timestamp(const OwnedChunk& frame) {
+    FrameHeader header;
+    std::memcpy(&header, frame->data(), sizeof(header));
+    return header.timestamp;
+  }
+
+  AllocatorForTest<2048> allocator_;
+};
+
+TEST_F(FramePipelineTest, PublishFansOutToAllSubscribersWithoutCopying) {
+  FramePublisher publisher;
+  FrameSubscriber<4> fusion;
+  FrameSubscriber<4> logging;
+  publisher.Subscribe(fusion);
+  publisher.Subscribe(logging);
+
+  OwnedChunk frame = MakeFrame(100, 16);
+  const std::byte* sample_data = frame->data();
+  EXPECT_EQ(publisher.Publish(std::move(frame)), 2u);
+
+  std::optional<OwnedChunk> fusion_frame = fusion.Pop();
+  std::optional<OwnedChunk> logging_frame = logging.Pop();
+  ASSERT_TRUE(fusion_frame.has_value());
+  ASSERT_TRUE(logging_frame.has_value());
+
+  // Clones alias the same region: no sample bytes were copied.
+  EXPECT_EQ((*fusion_frame)->data(), sample_data);
+  EXPECT_EQ((*logging_frame)->data(), sample_data);
+  EXPECT_EQ(Timestamp(*fusion_frame), 100u);
+}
+
+TEST_F(FramePipelineTest, SlowSubscriberDropsOldestFrames) {
+  FramePublisher publisher;
+  FrameSubscriber<2> slow;
+  publisher.Subscribe(slow);
+
+  EXPECT_EQ(publisher.Publish(MakeFrame(1, 4)), 1u);
+  EXPECT_EQ(publisher.Publish(MakeFrame(2, 4)), 1u);
+  EXPECT_EQ(publisher.Publish(MakeFrame(3, 4)), 1u);
+
+  EXPECT_EQ(slow.dropped_frames(), 1u);
+  EXPECT_EQ(slow.pending_frames(), 2u);
+
+  // The newest frames survive; the oldest was evicted.
+  std::optional<OwnedChunk> frame = slow.Pop();
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(Timestamp(*frame), 2u);
+}
+
+TEST_F(FramePipelineTest, PopOnEmptyReturnsNullopt) {
+  FrameSubscriber<2> subscriber;
+  EXPECT_FALSE(subscriber.Pop().has_value());
+}
+
+TEST_F(FramePipelineTest, UnsubscribeStopsDelivery) {
+  FramePublisher publisher;
+  FrameSubscriber<2> subscriber;
+  publisher.Subscribe(subscriber);
+  publisher.Unsubscribe(subscriber);
+  EXPECT_EQ(publisher.Publish(MakeFrame(1, 4)), 0u);
+  EXPECT_EQ(subscriber.pending_frames(), 0u);
+}
+
+TEST(DecimateTest, KeepsEveryNthSample) {
+  constexpr std::array<int16_t, 8> in = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::array<int16_t, 4> out = {};
+  EXPECT_EQ(Decimate<int16_t>(in, 2, out), 4u);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[1], 2);
+  EXPECT_EQ(out[3], 6);
+}
+
+TEST(DecimateTest, AverageQ15DecimatesWithAveraging) {
+  constexpr std::array<int16_t, 6> in = {100, 200, -100, -200, 30000, 30000};
+  std::array<int16_t, 3> out = {};
+  EXPECT_EQ(DecimateAverageQ15(in, 2, out), 3u);
+  EXPECT_EQ(out[0], 150);
+  EXPECT_EQ(out[1], -150);
+  EXPECT_EQ(out[2], 30000);  // No intermediate saturation.
+}
+
+}  // namespace
+}  // namespace pw::sensor
@@ -0,0 +1,180 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_sensor/frame_pipeline.h
+///
+/// Zero-copy sample frame distribution for high-rate sensor streams. Drivers
+/// batch samples into a `pw_multibuf` chunk with a `FrameHeader` up front and
+/// hand the chunk to a `FramePublisher`, which fans it out to subscribers by
+/// cloning the chunk -- clones alias the same region, so a 6.6 kHz IMU feed
+/// reaches fusion, logging, and RPC streaming consumers with no per-sample
+/// copies and no per-sample virtual calls. Each subscriber owns a bounded
+/// frame queue with drop-oldest overflow, so one slow consumer cannot stall
+/// the producer or the other consumers.
+///
+/// The pipeline is deliberately not internally synchronized: publish and pop
+/// are expected to run on one `pw_async2` dispatcher (drivers post frames as
+/// tasks, decimation/conversion stages and consumers poll their
+/// subscriptions). Multi-threaded use requires external locking, matching
+/// `pw::multibuf::MultiBuf`'s own contract.
+
+#include <cstdint>
+#include <optional>
+
+#include "pw_containers/inline_deque.h"
+#include "pw_containers/intrusive_list.h"
+#include "pw_multibuf/chunk.h"
+#include "pw_span/span.h"
+
+namespace pw::sensor {
+
+/// Header at the start of every sample frame chunk. Samples follow
+/// immediately, in the producer-documented format for `measurement_type`.
+struct FrameHeader {
+  /// Timestamp of the first sample; units are producer-defined (typically
+  /// the platform's sensor timebase).
+  uint64_t timestamp;
+  /// The `kMeasurementType` token of the samples (see pw_sensor/types.h).
+  uint64_t measurement_type;
+  /// Number of samples in the frame.
+  uint32_t sample_count;
+  /// Sample stride in bytes, so consumers can walk unfamiliar formats.
+  uint32_t sample_stride_bytes;
+};
+
+/// A subscription to a `FramePublisher` with a bounded queue of pending
+/// frames. Use the `FrameSubscriber<kMaxQueuedFrames>` template, which
+/// provides the storage; this base is the capacity-generic handle stages and
+/// consumers operate on.
+class FrameSubscriberBase
+    : public IntrusiveList<FrameSubscriberBase>::Item {
+ public:
+  /// Takes the oldest pending frame, or `std::nullopt` if none are queued.
+  std::optional<multibuf::OwnedChunk> Pop() {
+    if (queue_.empty()) {
+      return std::nullopt;
+    }
+    multibuf::OwnedChunk frame = std::move(queue_.front());
+    queue_.pop_front();
+    return frame;
+  }
+
+  /// Number of frames waiting in the queue.
+  size_t pending_frames() const { return queue_.size(); }
+
+  /// Frames evicted because the queue was full when new frames arrived.
+  /// The newest data is kept on overflow, as consumers of live sensor
+  /// streams want the freshest samples.
+  uint32_t dropped_frames() const { return dropped_frames_; }
+
+ protected:
+  explicit FrameSubscriberBase(InlineDeque<multibuf::OwnedChunk>& queue)
+      : queue_(queue) {}
+
+ private:
+  friend class FramePublisher;
+
+  void Push(multibuf::OwnedChunk&& frame) {
+    if (queue_.full()) {
+      queue_.pop_front();
+      ++dropped_frames_;
+    }
+    queue_.push_back(std::move(frame));
+  }
+
+  InlineDeque<multibuf::OwnedChunk>& queue_;
+  uint32_t dropped_frames_ = 0;
+};
+
+/// A `FrameSubscriberBase` with storage for up to `kMaxQueuedFrames` pending
+/// frames.
+template <size_t kMaxQueuedFrames>
+class FrameSubscriber : public FrameSubscriberBase {
+ public:
+  FrameSubscriber() : FrameSubscriberBase(queue_) {}
+
+ private:
+  InlineDeque<multibuf::OwnedChunk, kMaxQueuedFrames> queue_;
+};
+
+/// Fans sample frames out to registered subscribers without copying sample
+/// data: each subscriber receives a clone of the published chunk, and clones
+/// share the underlying region.
+class FramePublisher {
+ public:
+  /// Registers a subscriber. Frames published after registration are
+  /// delivered to it.
+  void Subscribe(FrameSubscriberBase& subscriber) {
+    subscribers_.push_back(subscriber);
+  }
+
+  /// Removes a subscriber; its queued frames remain poppable.
+  void Unsubscribe(FrameSubscriberBase& subscriber) {
+    subscribers_.remove(subscriber);
+  }
+
+  /// Delivers `frame` to every subscriber and releases the publisher's
+  /// reference. Returns the number of subscribers that received the frame;
+  /// delivery to a subscriber fails only if cloning the chunk fails (chunk
+  /// metadata exhaustion), in which case that subscriber's drop counter is
+  /// not incremented but the frame is not delivered to it.
+  size_t Publish(multibuf::OwnedChunk&& frame) {
+    size_t delivered = 0;
+    for (FrameSubscriberBase& subscriber : subscribers_) {
+      std::optional<multibuf::OwnedChunk> clone = frame->Clone();
+      if (clone.has_value()) {
+        subscriber.Push(std::move(*clone));
+        ++delivered;
+      }
+    }
+    return delivered;
+  }
+
+ private:
+  IntrusiveList<FrameSubscriberBase> subscribers_;
+};
+
+/// Decimates by keeping every `factor`-th sample. `out` must hold at least
+/// `in.size() / factor` samples; returns the number written. The loop is
+/// straight-line strided copying, which auto-vectorizes for power-of-two
+/// factors.
+template <typename T>
+size_t Decimate(span<const T> in, size_t factor, span<T> out) {
+  const size_t count = in.size() / factor;
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = in[i * factor];
+  }
+  return count;
+}
+
+/// Decimates Q15 samples by averaging each group of `factor` samples with a
+/// 32-bit accumulator (no intermediate saturation), acting as a crude
+/// anti-aliasing filter ahead of the rate reduction. Returns the number of
+/// output samples written.
+inline size_t DecimateAverageQ15(span<const int16_t> in,
+                                 size_t factor,
+                                 span<int16_t> out) {
+  const size_t count = in.size() / factor;
+  for (size_t i = 0; i < count; ++i) {
+    int32_t accumulator = 0;
+    for (size_t j = 0; j < factor; ++j) {
+      accumulator += in[i * factor + j];
+    }
+    out[i] = static_cast<int16_t>(accumulator / static_cast<int32_t>(factor));
+  }
+  return count;
+}
+
+}  // namespace pw::sensor
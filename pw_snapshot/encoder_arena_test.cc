@@ -0,0 +1,53 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_snapshot/encoder_arena.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::snapshot {
+namespace {
+
+TEST(SnapshotEncoderArena, EncodesAndTracksHighWater) {
+  SnapshotEncoderArena<64> arena;
+
+  {
+    protobuf::MemoryEncoder encoder = arena.StartCapture();
+    ASSERT_EQ(OkStatus(), encoder.WriteUint32(1, 42));
+    Result<ConstByteSpan> snapshot = arena.Finish(encoder);
+    ASSERT_EQ(OkStatus(), snapshot.status());
+    EXPECT_EQ(snapshot->size(), 2u);  // Key byte + value byte.
+    EXPECT_EQ(arena.high_water_bytes(), 2u);
+  }
+
+  // A second, larger capture reuses the storage and raises the mark.
+  {
+    protobuf::MemoryEncoder encoder = arena.StartCapture();
+    ASSERT_EQ(OkStatus(), encoder.WriteString(2, "snapshot"));
+    Result<ConstByteSpan> snapshot = arena.Finish(encoder);
+    ASSERT_EQ(OkStatus(), snapshot.status());
+    EXPECT_GT(arena.high_water_bytes(), 2u);
+  }
+}
+
+TEST(SnapshotEncoderArena, PropagatesEncoderErrors) {
+  SnapshotEncoderArena<4> arena;
+  protobuf::MemoryEncoder encoder = arena.StartCapture();
+  (void)encoder.WriteString(1, "does not fit in the arena");
+  EXPECT_EQ(arena.Finish(encoder).status(), Status::ResourceExhausted());
+  EXPECT_EQ(arena.high_water_bytes(), 0u);
+}
+
+}  // namespace
+}  // namespace pw::snapshot
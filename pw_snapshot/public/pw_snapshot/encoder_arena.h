@@ -0,0 +1,65 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_snapshot/encoder_arena.h
+///
+/// Preallocated storage for encoding snapshots. Crash and fault handlers must
+/// not allocate or depend on runtime setup, so the proto encoding buffer for
+/// a snapshot should be reserved at build time and reused for every capture.
+/// `SnapshotEncoderArena` owns that storage, hands out a fresh
+/// `pw::protobuf::MemoryEncoder` per capture, and tracks the high-water mark
+/// so the arena can be sized from real captures rather than guesses.
+
+#include <cstddef>
+
+#include "pw_bytes/span.h"
+#include "pw_protobuf/encoder.h"
+
+namespace pw::snapshot {
+
+/// Statically sized encoding arena for snapshot capture.
+template <size_t kCapacityBytes>
+class SnapshotEncoderArena {
+ public:
+  /// Begins a capture, returning an encoder over the arena's storage.
+  /// Discards any previous capture. Nested messages (e.g. snapshot metadata,
+  /// thread info) encode in place, as with any `MemoryEncoder`.
+  protobuf::MemoryEncoder StartCapture() {
+    return protobuf::MemoryEncoder(buffer_);
+  }
+
+  /// Completes a capture, recording the encoded size in the high-water mark
+  /// and returning the encoded snapshot (valid until the next capture).
+  Result<ConstByteSpan> Finish(const protobuf::MemoryEncoder& encoder) {
+    if (!encoder.status().ok()) {
+      return encoder.status();
+    }
+    if (encoder.size() > high_water_bytes_) {
+      high_water_bytes_ = encoder.size();
+    }
+    return ConstByteSpan(buffer_, encoder.size());
+  }
+
+  /// The largest snapshot encoded so far, for tuning `kCapacityBytes`.
+  size_t high_water_bytes() const { return high_water_bytes_; }
+
+  static constexpr size_t capacity_bytes() { return kCapacityBytes; }
+
+ private:
+  std::byte buffer_[kCapacityBytes];
+  size_t high_water_bytes_ = 0;
+};
+
+}  // namespace pw::snapshot
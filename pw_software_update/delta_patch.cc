@@ -0,0 +1,108 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_software_update/delta_patch.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include "pw_status/try.h"
+#include "pw_varint/stream.h"
+
+namespace pw::software_update {
+namespace {
+
+constexpr char kMagic[4] = {'P', 'W', 'D', 'P'};
+constexpr uint64_t kFormatVersion = 0;
+
+constexpr std::byte kCommandCopy{0x00};
+constexpr std::byte kCommandInsert{0x01};
+
+constexpr size_t kChunkSizeBytes = 128;
+
+Status ReadVarint(stream::Reader& reader, uint64_t& value) {
+  StatusWithSize result = varint::Read(reader, &value);
+  if (!result.ok()) {
+    return result.status().IsOutOfRange() ? Status::DataLoss()
+                                          : result.status();
+  }
+  return OkStatus();
+}
+
+// Streams `length` bytes from `reader` to `output` through a small buffer.
+Status StreamBytes(stream::Reader& reader,
+                   stream::Writer& output,
+                   uint64_t length) {
+  std::array<std::byte, kChunkSizeBytes> buffer;
+  while (length > 0) {
+    const size_t chunk =
+        static_cast<size_t>(std::min<uint64_t>(length, buffer.size()));
+    Result<ByteSpan> read = reader.Read(span(buffer).first(chunk));
+    if (!read.ok()) {
+      return read.status().IsOutOfRange() ? Status::DataLoss() : read.status();
+    }
+    PW_TRY(output.Write(read.value()));
+    length -= read->size();
+  }
+  return OkStatus();
+}
+
+}  // namespace
+
+Status ApplyDeltaPatch(stream::SeekableReader& source,
+                       stream::Reader& patch,
+                       stream::Writer& output) {
+  // Validate the header.
+  std::array<std::byte, sizeof(kMagic)> magic;
+  Result<ByteSpan> read = patch.Read(magic);
+  if (!read.ok() || read->size() != sizeof(kMagic) ||
+      std::memcmp(magic.data(), kMagic, sizeof(kMagic)) != 0) {
+    return Status::DataLoss();
+  }
+  uint64_t version;
+  PW_TRY(ReadVarint(patch, version));
+  if (version != kFormatVersion) {
+    return Status::DataLoss();
+  }
+
+  while (true) {
+    std::byte command;
+    Result<ByteSpan> command_read = patch.Read(span(&command, 1));
+    if (command_read.status().IsOutOfRange()) {
+      return OkStatus();  // Clean end of patch.
+    }
+    if (!command_read.ok()) {
+      return command_read.status();
+    }
+
+    if (command == kCommandCopy) {
+      uint64_t offset;
+      uint64_t length;
+      PW_TRY(ReadVarint(patch, offset));
+      PW_TRY(ReadVarint(patch, length));
+      PW_TRY(source.Seek(static_cast<ptrdiff_t>(offset)));
+      PW_TRY(StreamBytes(source, output, length));
+    } else if (command == kCommandInsert) {
+      uint64_t length;
+      PW_TRY(ReadVarint(patch, length));
+      PW_TRY(StreamBytes(patch, output, length));
+    } else {
+      return Status::DataLoss();
+    }
+  }
+}
+
+}  // namespace pw::software_update
@@ -0,0 +1,114 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_software_update/delta_patch.h"
+
+#include <array>
+#include <cstring>
+
+#include "pw_stream/memory_stream.h"
+#include "pw_unit_test/framework.h"
+#include "pw_varint/varint.h"
+
+namespace pw::software_update {
+namespace {
+
+// Builds patches for tests.
+class PatchBuilder {
+ public:
+  PatchBuilder() : writer_(buffer_) {
+    constexpr char kMagic[4] = {'P', 'W', 'D', 'P'};
+    PW_TEST_EXPECT_OK(writer_.Write(as_bytes(span(kMagic))));
+    WriteVarint(0);  // Version.
+  }
+
+  PatchBuilder& Copy(uint64_t offset, uint64_t length) {
+    const std::byte command{0x00};
+    PW_TEST_EXPECT_OK(writer_.Write(span(&command, 1)));
+    WriteVarint(offset);
+    WriteVarint(length);
+    return *this;
+  }
+
+  PatchBuilder& Insert(std::string_view data) {
+    const std::byte command{0x01};
+    PW_TEST_EXPECT_OK(writer_.Write(span(&command, 1)));
+    WriteVarint(data.size());
+    PW_TEST_EXPECT_OK(writer_.Write(as_bytes(span(data))));
+    return *this;
+  }
+
+  ConstByteSpan patch() const { return writer_.WrittenData(); }
+
+ private:
+  void WriteVarint(uint64_t value) {
+    std::array<std::byte, varint::kMaxVarint64SizeBytes> encoded;
+    const size_t size = varint::Encode(value, encoded);
+    PW_TEST_EXPECT_OK(writer_.Write(span(encoded).first(size)));
+  }
+
+  std::array<std::byte, 256> buffer_;
+  stream::MemoryWriter writer_;
+};
+
+TEST(ApplyDeltaPatch, CopiesAndInserts) {
+  constexpr std::string_view kSource = "The quick brown fox jumps";
+  PatchBuilder builder;
+  builder.Copy(4, 5).Insert(" red ").Copy(16, 3).Insert("!");
+
+  stream::MemoryReader source(as_bytes(span(kSource)));
+  stream::MemoryReader patch(builder.patch());
+  std::array<std::byte, 64> out_buffer = {};
+  stream::MemoryWriter output(out_buffer);
+
+  ASSERT_EQ(OkStatus(), ApplyDeltaPatch(source, patch, output));
+  const ConstByteSpan written = output.WrittenData();
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(written.data()),
+                             written.size()),
+            "quick red fox!");
+}
+
+TEST(ApplyDeltaPatch, EmptyPatchProducesEmptyOutput) {
+  PatchBuilder builder;
+  stream::MemoryReader source((ConstByteSpan()));
+  stream::MemoryReader patch(builder.patch());
+  std::array<std::byte, 8> out_buffer = {};
+  stream::MemoryWriter output(out_buffer);
+
+  ASSERT_EQ(OkStatus(), ApplyDeltaPatch(source, patch, output));
+  EXPECT_EQ(output.WrittenData().size(), 0u);
+}
+
+TEST(ApplyDeltaPatch, RejectsBadMagicAndTruncation) {
+  constexpr std::string_view kNotAPatch = "nope";
+  stream::MemoryReader source((ConstByteSpan()));
+  std::array<std::byte, 8> out_buffer = {};
+
+  {
+    stream::MemoryReader patch(as_bytes(span(kNotAPatch)));
+    stream::MemoryWriter output(out_buffer);
+    EXPECT_EQ(Status::DataLoss(), ApplyDeltaPatch(source, patch, output));
+  }
+
+  // An insert command whose literal bytes are missing is DATA_LOSS.
+  PatchBuilder builder;
+  builder.Insert("x");
+  ConstByteSpan truncated = builder.patch().first(builder.patch().size() - 1);
+  stream::MemoryReader patch(truncated);
+  stream::MemoryWriter output(out_buffer);
+  EXPECT_EQ(Status::DataLoss(), ApplyDeltaPatch(source, patch, output));
+}
+
+}  // namespace
+}  // namespace pw::software_update
@@ -26,6 +26,14 @@
 #define PW_SOFTWARE_UPDATE_MAX_TARGET_PAYLOAD_SIZE (100 * 1024 * 1024)
 #endif  // PW_SOFTWARE_UPDATE_MAX_TARGET_PAYLOAD_SIZE
 
+// The size of the stack buffer used to stream payload and metadata bytes
+// while computing SHA256 measurements during bundle verification. Larger
+// buffers reduce the number of reads against the underlying (often flash)
+// stream.
+#ifndef PW_SOFTWARE_UPDATE_VERIFICATION_READ_BUFFER_SIZE
+#define PW_SOFTWARE_UPDATE_VERIFICATION_READ_BUFFER_SIZE 256
+#endif  // PW_SOFTWARE_UPDATE_VERIFICATION_READ_BUFFER_SIZE
+
 // Not recommended. Disable compilation of bundle verification.
 #ifndef PW_SOFTWARE_UPDATE_DISABLE_BUNDLE_VERIFICATION
 #define PW_SOFTWARE_UPDATE_DISABLE_BUNDLE_VERIFICATION (false)
@@ -0,0 +1,61 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_software_update/delta_patch.h
+///
+/// Streaming binary delta (diff/patch) support for update payloads. A patch
+/// is a sequence of copy and insert commands applied against the currently
+/// installed image, so an update bundle can carry only the bytes that
+/// changed. The applier streams: it reads the patch and writes the new image
+/// through `pw_stream` interfaces with a small fixed buffer, so multi-megabyte
+/// images never need to be resident in RAM.
+///
+/// Patch format (little-endian varints):
+///
+///   "PWDP" magic (4 bytes), format version varint (currently 0), then
+///   commands until the patch stream ends:
+///
+///   - 0x00 (copy):   varint source offset, varint length. Copies bytes from
+///                    the source (installed) image.
+///   - 0x01 (insert): varint length, then that many literal bytes.
+
+#include "pw_status/status.h"
+#include "pw_stream/stream.h"
+
+namespace pw::software_update {
+
+/// Applies a delta patch.
+///
+/// @param[in] source The installed image; must support seeking (e.g. a
+/// `BlobStore::BlobReader` or memory-mapped flash stream).
+/// @param[in] patch The patch, in the format described above.
+/// @param[out] output Receives the new image.
+///
+/// @returns @rst
+///
+/// .. pw-status-codes::
+///
+///    OK: The patch applied completely.
+///
+///    DATA_LOSS: The patch is malformed or truncated.
+///
+/// Errors from the source, patch, or output streams are passed through.
+///
+/// @endrst
+Status ApplyDeltaPatch(stream::SeekableReader& source,
+                       stream::Reader& patch,
+                       stream::Writer& output);
+
+}  // namespace pw::software_update
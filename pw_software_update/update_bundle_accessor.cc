@@ -147,10 +147,11 @@ Status VerifyMetadataSignatures(protobuf::Bytes message,
     // The function assume that all keys are ECDSA keys. This is guaranteed
     // by the fact that all trusted roots have undergone content check.
 
-    // computes the sha256 hash
+    // Computes the sha256 hash, streaming through a chunk-sized buffer.
     std::byte sha256_digest[32];
+    std::byte read_buffer[PW_SOFTWARE_UPDATE_VERIFICATION_READ_BUFFER_SIZE];
     stream::IntervalReader bytes_reader = message.GetBytesReader();
-    PW_TRY(crypto::sha256::Hash(bytes_reader, sha256_digest));
+    PW_TRY(crypto::sha256::Hash(bytes_reader, sha256_digest, read_buffer));
     Result<bool> res = VerifyEcdsaSignature(key_val, sha256_digest, sig);
     PW_TRY(res.status());
     if (res.value()) {
@@ -804,7 +805,8 @@ Status UpdateBundleAccessor::VerifyInBundleTargetPayload(
   }
 
   std::byte actual_sha256[crypto::sha256::kDigestSizeBytes] = {};
-  PW_TRY(crypto::sha256::Hash(payload_reader, actual_sha256));
+  std::byte read_buffer[PW_SOFTWARE_UPDATE_VERIFICATION_READ_BUFFER_SIZE];
+  PW_TRY(crypto::sha256::Hash(payload_reader, actual_sha256, read_buffer));
   Result<bool> hash_equal = expected_sha256.Equal(actual_sha256);
   PW_TRY(hash_equal.status());
   if (!hash_equal.value()) {
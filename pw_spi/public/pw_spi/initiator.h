@@ -15,10 +15,13 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <type_traits>
+#include <utility>
 
 #include "pw_assert/assert.h"
 #include "pw_bytes/span.h"
+#include "pw_function/function.h"
 #include "pw_status/status.h"
 
 namespace pw::spi {
@@ -89,7 +92,25 @@ class Initiator {
   // bits-per-word.
   // Returns OkStatus() on success, and implementation-specific values on
   // failure.
-  Status Configure(const Config& config) { return DoConfigure(config); }
+  //
+  // Reconfiguration is skipped when `config` matches the last successfully
+  // applied configuration, so repeated transactions against the same device
+  // (the common case on single-device buses, where Device re-applies its
+  // config per transaction) do not reprogram clock dividers every time.
+  // Backends whose hardware state can change behind the driver's back must
+  // call InvalidateConfigurationCache().
+  Status Configure(const Config& config) {
+    if (last_config_.has_value() && *last_config_ == config) {
+      return OkStatus();
+    }
+    const Status status = DoConfigure(config);
+    if (status.ok()) {
+      last_config_ = config;
+    } else {
+      last_config_.reset();
+    }
+    return status;
+  }
 
   // Perform a synchronous read/write operation on the SPI bus.  Data from the
   // `write_buffer` object is written to the bus, while the `read_buffer` is
@@ -105,11 +126,48 @@ class Initiator {
     return DoWriteRead(write_buffer, read_buffer);
   }
 
+  // Starts an asynchronous read/write operation on the SPI bus with the same
+  // data semantics as WriteRead(). Returns once the transfer is started; the
+  // completion callback is invoked with the transfer status when it finishes,
+  // possibly from an interrupt context, so it must be interrupt-safe and
+  // short (e.g. releasing a semaphore or posting to a work queue). The
+  // buffers must remain valid until the callback runs, and only one
+  // asynchronous transfer may be in flight per initiator.
+  //
+  // The default implementation performs the transfer synchronously and
+  // invokes the callback before returning, so backends without DMA or
+  // interrupt-driven engines behave identically to WriteRead().
+  Status StartWriteRead(ConstByteSpan write_buffer,
+                        ByteSpan read_buffer,
+                        Function<void(Status)>&& on_completion) {
+    return DoStartWriteRead(
+        write_buffer, read_buffer, std::move(on_completion));
+  }
+
+ protected:
+  // Drops the cached configuration so the next Configure call reaches the
+  // hardware. Backends call this after resets, power-gating, or any event
+  // that may desynchronize peripheral registers from the cached config.
+  void InvalidateConfigurationCache() { last_config_.reset(); }
+
  private:
   // Subclass API:
   virtual Status DoConfigure(const Config& config) = 0;
   virtual Status DoWriteRead(ConstByteSpan write_buffer,
                              ByteSpan read_buffer) = 0;
+
+  // Asynchronous transfer hook; backends with DMA completion interrupts (or
+  // io_uring on Linux) override this to avoid blocking a thread for the
+  // duration of the transfer.
+  virtual Status DoStartWriteRead(ConstByteSpan write_buffer,
+                                  ByteSpan read_buffer,
+                                  Function<void(Status)>&& on_completion) {
+    on_completion(DoWriteRead(write_buffer, read_buffer));
+    return OkStatus();
+  }
+
+  // Last configuration successfully applied to the hardware, if any.
+  std::optional<Config> last_config_;
 };
 
 }  // namespace pw::spi
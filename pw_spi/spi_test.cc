@@ -99,6 +99,124 @@ TEST_F(SpiResponderTestDevice, CompilationSucceeds) { EXPECT_TRUE(true); }
 static_assert(kConfig == kConfig);
 static_assert(!(kConfig != kConfig));
 
+TEST(Initiator, ConfigureSkipsReapplyingUnchangedConfig) {
+  // Initiator that counts how often the hardware is actually reprogrammed.
+  class CountingInitiator : public Initiator {
+   public:
+    int configure_calls() const { return configure_calls_; }
+    void SimulateHardwareReset() { InvalidateConfigurationCache(); }
+
+   private:
+    Status DoConfigure(const Config&) override {
+      ++configure_calls_;
+      return OkStatus();
+    }
+    Status DoWriteRead(ConstByteSpan, ByteSpan) override { return OkStatus(); }
+
+    int configure_calls_ = 0;
+  };
+
+  CountingInitiator initiator;
+  EXPECT_EQ(initiator.Configure(kConfig), OkStatus());
+  EXPECT_EQ(initiator.Configure(kConfig), OkStatus());
+  EXPECT_EQ(initiator.configure_calls(), 1);  // Second call was a no-op.
+
+  // A different config reaches the hardware.
+  Config other = kConfig;
+  other.bit_order = BitOrder::kLsbFirst;
+  EXPECT_EQ(initiator.Configure(other), OkStatus());
+  EXPECT_EQ(initiator.configure_calls(), 2);
+
+  // Invalidation forces the next Configure through.
+  initiator.SimulateHardwareReset();
+  EXPECT_EQ(initiator.Configure(other), OkStatus());
+  EXPECT_EQ(initiator.configure_calls(), 3);
+}
+
+TEST(Initiator, ConfigureFailureIsNotCached) {
+  class FailingInitiator : public Initiator {
+   public:
+    int configure_calls() const { return configure_calls_; }
+    void set_result(Status status) { result_ = status; }
+
+   private:
+    Status DoConfigure(const Config&) override {
+      ++configure_calls_;
+      return result_;
+    }
+    Status DoWriteRead(ConstByteSpan, ByteSpan) override { return OkStatus(); }
+
+    Status result_ = Status::Internal();
+    int configure_calls_ = 0;
+  };
+
+  FailingInitiator initiator;
+  EXPECT_EQ(initiator.Configure(kConfig), Status::Internal());
+  initiator.set_result(OkStatus());
+  // The failed attempt was not cached; the retry reaches the hardware.
+  EXPECT_EQ(initiator.Configure(kConfig), OkStatus());
+  EXPECT_EQ(initiator.configure_calls(), 2);
+}
+
+TEST(Initiator, StartWriteReadDefaultsToSynchronousCompletion) {
+  // Initiator whose synchronous transfer reports a fixed status.
+  class SyncInitiator : public Initiator {
+   private:
+    Status DoConfigure(const Config&) override { return OkStatus(); }
+    Status DoWriteRead(ConstByteSpan, ByteSpan) override {
+      return Status::DeadlineExceeded();
+    }
+  };
+
+  SyncInitiator initiator;
+  Status completion_status = Status::Unknown();
+  EXPECT_EQ(initiator.StartWriteRead(
+                ConstByteSpan(),
+                ByteSpan(),
+                [&completion_status](Status status) {
+                  completion_status = status;
+                }),
+            OkStatus());
+  // The default implementation completes before returning.
+  EXPECT_EQ(completion_status, Status::DeadlineExceeded());
+}
+
+TEST(Initiator, StartWriteReadOverrideDefersCompletion) {
+  // Initiator that stores the callback like a DMA-complete IRQ would.
+  class AsyncInitiator : public Initiator {
+   public:
+    void CompleteTransfer(Status status) {
+      Function<void(Status)> callback = std::move(on_completion_);
+      callback(status);
+    }
+
+   private:
+    Status DoConfigure(const Config&) override { return OkStatus(); }
+    Status DoWriteRead(ConstByteSpan, ByteSpan) override { return OkStatus(); }
+    Status DoStartWriteRead(ConstByteSpan,
+                            ByteSpan,
+                            Function<void(Status)>&& on_completion) override {
+      on_completion_ = std::move(on_completion);
+      return OkStatus();
+    }
+
+    Function<void(Status)> on_completion_;
+  };
+
+  AsyncInitiator initiator;
+  Status completion_status = Status::Unknown();
+  EXPECT_EQ(initiator.StartWriteRead(
+                ConstByteSpan(),
+                ByteSpan(),
+                [&completion_status](Status status) {
+                  completion_status = status;
+                }),
+            OkStatus());
+  EXPECT_EQ(completion_status, Status::Unknown());  // Still in flight.
+  initiator.CompleteTransfer(OkStatus());
+  EXPECT_EQ(completion_status, OkStatus());
+}
+
 TEST(Config, Equals) {
   Config lhs = kConfig;
   Config rhs = kConfig;
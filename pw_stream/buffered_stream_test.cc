@@ -0,0 +1,115 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_stream/buffered_stream.h"
+
+#include <array>
+
+#include "pw_bytes/array.h"
+#include "pw_stream/memory_stream.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::stream {
+namespace {
+
+TEST(BufferedWriter, CoalescesSmallWrites) {
+  std::array<std::byte, 64> sink_buffer = {};
+  MemoryWriter sink(sink_buffer);
+  std::array<std::byte, 16> coalesce_buffer = {};
+  BufferedWriter writer(sink, coalesce_buffer);
+
+  constexpr auto kChunk = bytes::Array<1, 2, 3, 4>();
+  // Three 4-byte writes stay buffered; nothing reaches the sink.
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(OkStatus(), writer.Write(kChunk));
+  }
+  EXPECT_EQ(sink.bytes_written(), 0u);
+  EXPECT_EQ(writer.buffered_bytes(), 12u);
+
+  // The fourth write fills the buffer, flushing all 16 bytes at once.
+  ASSERT_EQ(OkStatus(), writer.Write(kChunk));
+  EXPECT_EQ(sink.bytes_written(), 16u);
+  EXPECT_EQ(writer.buffered_bytes(), 0u);
+
+  // Explicit flush drains a partial buffer.
+  ASSERT_EQ(OkStatus(), writer.Write(kChunk));
+  ASSERT_EQ(OkStatus(), writer.Flush());
+  EXPECT_EQ(sink.bytes_written(), 20u);
+
+  for (size_t i = 0; i < 20u; ++i) {
+    EXPECT_EQ(sink_buffer[i], kChunk[i % 4]);
+  }
+}
+
+TEST(BufferedWriter, LargeWritesBypassBuffer) {
+  std::array<std::byte, 64> sink_buffer = {};
+  MemoryWriter sink(sink_buffer);
+  std::array<std::byte, 8> coalesce_buffer = {};
+  BufferedWriter writer(sink, coalesce_buffer);
+
+  constexpr auto kSmall = bytes::Array<9, 9>();
+  constexpr auto kLarge =
+      bytes::Array<1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12>();
+
+  ASSERT_EQ(OkStatus(), writer.Write(kSmall));
+  // The large write flushes the buffered bytes first, preserving order.
+  ASSERT_EQ(OkStatus(), writer.Write(kLarge));
+  EXPECT_EQ(sink.bytes_written(), kSmall.size() + kLarge.size());
+  EXPECT_EQ(sink_buffer[0], std::byte{9});
+  EXPECT_EQ(sink_buffer[2], std::byte{1});
+  EXPECT_EQ(sink_buffer[13], std::byte{12});
+}
+
+TEST(BufferedWriter, FlushThreshold) {
+  std::array<std::byte, 64> sink_buffer = {};
+  MemoryWriter sink(sink_buffer);
+  std::array<std::byte, 16> coalesce_buffer = {};
+  BufferedWriter writer(sink, coalesce_buffer, /*flush_threshold=*/4);
+
+  constexpr auto kChunk = bytes::Array<5, 6>();
+  ASSERT_EQ(OkStatus(), writer.Write(kChunk));
+  EXPECT_EQ(sink.bytes_written(), 0u);
+  ASSERT_EQ(OkStatus(), writer.Write(kChunk));  // Crosses the threshold.
+  EXPECT_EQ(sink.bytes_written(), 4u);
+}
+
+TEST(BufferedReader, ReadsAheadAndServesFromBuffer) {
+  constexpr auto kData =
+      bytes::Array<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>();
+  MemoryReader source(kData);
+  std::array<std::byte, 8> readahead = {};
+  BufferedReader reader(source, readahead);
+
+  std::array<std::byte, 2> small = {};
+  for (size_t i = 0; i < 8; i += 2) {
+    auto result = reader.Read(small);
+    ASSERT_EQ(result.status(), OkStatus());
+    ASSERT_EQ(result->size(), 2u);
+    EXPECT_EQ(small[0], kData[i]);
+    EXPECT_EQ(small[1], kData[i + 1]);
+  }
+  // The underlying reader was asked for one 8-byte block, not four reads.
+  EXPECT_EQ(source.ConservativeReadLimit(), kData.size() - 8u);
+
+  // A large read with an empty buffer goes straight to the source.
+  std::array<std::byte, 8> large = {};
+  auto result = reader.Read(large);
+  ASSERT_EQ(result.status(), OkStatus());
+  EXPECT_EQ(result->size(), 8u);
+  EXPECT_EQ(large[0], kData[8]);
+  EXPECT_EQ(large[7], kData[15]);
+}
+
+}  // namespace
+}  // namespace pw::stream
@@ -0,0 +1,158 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "pw_bytes/span.h"
+#include "pw_result/result.h"
+#include "pw_status/status.h"
+#include "pw_status/status_with_size.h"
+#include "pw_stream/stream.h"
+
+namespace pw::stream {
+
+/// Decorator that coalesces small writes to an underlying `Writer` into a
+/// caller-provided buffer, turning bursts of tiny writes into one write of up
+/// to the buffer size. Writes at least as large as the buffer bypass it (after
+/// flushing any buffered bytes) and go straight to the underlying writer.
+///
+/// The buffer is flushed when it fills, when `Flush()` is called, and when a
+/// write crosses the configured `flush_threshold` (by default, only when
+/// full). Time-based flushing is not built in, since this module has no timer
+/// dependency; drive `Flush()` from a timer or work queue for that policy.
+///
+/// Buffered bytes are lost if the `BufferedWriter` is destroyed without a
+/// final `Flush()`.
+class BufferedWriter : public NonSeekableWriter {
+ public:
+  /// @param[in] writer The underlying writer.
+  /// @param[in] buffer The coalescing buffer.
+  /// @param[in] flush_threshold Flush once at least this many bytes are
+  /// buffered. 0 (the default) flushes only when the buffer is full.
+  constexpr BufferedWriter(Writer& writer,
+                           ByteSpan buffer,
+                           size_t flush_threshold = 0)
+      : writer_(writer),
+        buffer_(buffer),
+        flush_threshold_(
+            flush_threshold == 0 ? buffer.size_bytes() : flush_threshold),
+        buffered_(0) {}
+
+  BufferedWriter(const BufferedWriter&) = delete;
+  BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+  /// Writes any buffered bytes to the underlying writer.
+  Status Flush() {
+    if (buffered_ == 0) {
+      return OkStatus();
+    }
+    const size_t to_write = buffered_;
+    buffered_ = 0;
+    return writer_.Write(buffer_.first(to_write));
+  }
+
+  /// The number of bytes currently buffered.
+  size_t buffered_bytes() const { return buffered_; }
+
+ private:
+  Status DoWrite(ConstByteSpan data) override {
+    // Writes that can never fit through the buffer are passed through after
+    // flushing, preserving write ordering.
+    if (data.size_bytes() >= buffer_.size_bytes()) {
+      if (Status status = Flush(); !status.ok()) {
+        return status;
+      }
+      return writer_.Write(data);
+    }
+
+    if (buffered_ + data.size_bytes() > buffer_.size_bytes()) {
+      if (Status status = Flush(); !status.ok()) {
+        return status;
+      }
+    }
+    std::memcpy(buffer_.data() + buffered_, data.data(), data.size_bytes());
+    buffered_ += data.size_bytes();
+
+    if (buffered_ >= flush_threshold_) {
+      return Flush();
+    }
+    return OkStatus();
+  }
+
+  size_t ConservativeLimit(LimitType type) const override {
+    if (type != LimitType::kWrite) {
+      return 0;
+    }
+    return writer_.ConservativeWriteLimit();
+  }
+
+  Writer& writer_;
+  const ByteSpan buffer_;
+  const size_t flush_threshold_;
+  size_t buffered_;
+};
+
+/// Decorator that reads ahead from an underlying `Reader` into a
+/// caller-provided buffer, serving small reads from the buffer so each
+/// underlying read is up to the buffer size.
+class BufferedReader : public NonSeekableReader {
+ public:
+  constexpr BufferedReader(Reader& reader, ByteSpan buffer)
+      : reader_(reader), buffer_(buffer), available_(0), offset_(0) {}
+
+  BufferedReader(const BufferedReader&) = delete;
+  BufferedReader& operator=(const BufferedReader&) = delete;
+
+  /// The number of buffered bytes not yet consumed.
+  size_t buffered_bytes() const { return available_ - offset_; }
+
+ private:
+  StatusWithSize DoRead(ByteSpan destination) override {
+    // Reads larger than the buffer are served directly once the buffer is
+    // drained.
+    if (buffered_bytes() == 0 &&
+        destination.size_bytes() >= buffer_.size_bytes()) {
+      const Result<ByteSpan> result = reader_.Read(destination);
+      if (!result.ok()) {
+        return StatusWithSize(result.status(), 0);
+      }
+      return StatusWithSize(result->size_bytes());
+    }
+
+    if (buffered_bytes() == 0) {
+      const Result<ByteSpan> result = reader_.Read(buffer_);
+      if (!result.ok()) {
+        return StatusWithSize(result.status(), 0);
+      }
+      available_ = result->size_bytes();
+      offset_ = 0;
+    }
+
+    const size_t to_copy = destination.size_bytes() < buffered_bytes()
+                               ? destination.size_bytes()
+                               : buffered_bytes();
+    std::memcpy(destination.data(), buffer_.data() + offset_, to_copy);
+    offset_ += to_copy;
+    return StatusWithSize(to_copy);
+  }
+
+  Reader& reader_;
+  const ByteSpan buffer_;
+  size_t available_;
+  size_t offset_;
+};
+
+}  // namespace pw::stream
@@ -15,6 +15,7 @@
 
 #include <cstdint>
 
+#include "pw_bytes/span.h"
 #include "pw_result/result.h"
 #include "pw_span/span.h"
 #include "pw_stream/stream.h"
@@ -55,6 +56,12 @@ class SocketStream : public NonSeekableReaderWriter {
                  const void* optval,
                  unsigned int optlen);
 
+  // Writes multiple buffers to the socket as a single vectored send
+  // (sendmsg), avoiding the per-buffer syscall and TCP segmentation cost of
+  // calling Write() once per buffer. Partial sends are retried until all
+  // buffers are written. Returns OUT_OF_RANGE if the connection is closed.
+  Status WriteVector(span<const ConstByteSpan> buffers);
+
   // Get the connection ready state (true if ready, false otherwise).
   bool IsReady();
 
@@ -14,6 +14,8 @@
 
 #include "pw_stream/socket_stream.h"
 
+#include <array>
+
 #if defined(_WIN32) && _WIN32
 #include <fcntl.h>
 #include <io.h>
@@ -221,6 +223,75 @@ Status SocketStream::DoWrite(span<const std::byte> data) {
   return OkStatus();
 }
 
+Status SocketStream::WriteVector(span<const ConstByteSpan> buffers) {
+#if defined(_WIN32)
+  // Winsock has no sendmsg; write the buffers sequentially.
+  for (const ConstByteSpan& buffer : buffers) {
+    if (Status status = Write(buffer); !status.ok()) {
+      return status;
+    }
+  }
+  return OkStatus();
+#else   // !defined(_WIN32)
+  int send_flags = 0;
+#if defined(__linux__)
+  // Use MSG_NOSIGNAL to avoid getting a SIGPIPE signal when the remote
+  // peer drops the connection. This is supported on Linux only.
+  send_flags |= MSG_NOSIGNAL;
+#endif  // defined(__linux__)
+
+  size_t total_bytes = 0;
+  for (const ConstByteSpan& buffer : buffers) {
+    total_bytes += buffer.size_bytes();
+  }
+
+  ConnectionOwnership ownership(this);
+  if (ownership.fd() == kInvalidFd) {
+    return Status::Unknown();
+  }
+
+  // Retry until everything is sent, rebuilding the iovec array past whatever
+  // prefix a partial send consumed.
+  constexpr size_t kMaxIovecs = 16;
+  size_t bytes_sent_total = 0;
+  while (bytes_sent_total < total_bytes) {
+    std::array<iovec, kMaxIovecs> iovecs;
+    size_t num_iovecs = 0;
+    size_t offset = bytes_sent_total;
+    for (const ConstByteSpan& buffer : buffers) {
+      if (num_iovecs == iovecs.size()) {
+        break;
+      }
+      if (offset >= buffer.size_bytes()) {
+        offset -= buffer.size_bytes();
+        continue;
+      }
+      iovecs[num_iovecs].iov_base =
+          const_cast<std::byte*>(buffer.data() + offset);
+      iovecs[num_iovecs].iov_len = buffer.size_bytes() - offset;
+      num_iovecs += 1;
+      offset = 0;
+    }
+
+    msghdr message = {};
+    message.msg_iov = iovecs.data();
+    message.msg_iovlen = num_iovecs;
+
+    const ssize_t bytes_sent = sendmsg(ownership.fd(), &message, send_flags);
+    if (bytes_sent < 0) {
+      if (errno == EPIPE) {
+        // An EPIPE indicates that the connection is closed. Return an
+        // OutOfRange error.
+        return Status::OutOfRange();
+      }
+      return Status::Unknown();
+    }
+    bytes_sent_total += static_cast<size_t>(bytes_sent);
+  }
+  return OkStatus();
+#endif  // defined(_WIN32)
+}
+
 StatusWithSize SocketStream::DoRead(ByteSpan dest) {
   ConnectionOwnership ownership(this);
   if (ownership.fd() == kInvalidFd) {
@@ -14,8 +14,11 @@
 
 #include "pw_stream/socket_stream.h"
 
+#include <algorithm>
+#include <array>
 #include <thread>
 
+#include "pw_bytes/array.h"
 #include "pw_result/result.h"
 #include "pw_status/status.h"
 #include "pw_unit_test/framework.h"
@@ -138,6 +141,51 @@ TEST(SocketStreamTest, ReadWrite) {
   server.Close();
 }
 
+TEST(SocketStreamTest, WriteVector) {
+  ServerSocket server;
+  EXPECT_EQ(server.Listen(), OkStatus());
+
+  Result<SocketStream> server_stream = Status::Unavailable();
+  auto accept_thread = std::thread{[&]() { server_stream = server.Accept(); }};
+
+  SocketStream client;
+  EXPECT_EQ(client.Connect("localhost", server.port()), OkStatus());
+
+  accept_thread.join();
+  ASSERT_EQ(server_stream.status(), OkStatus());
+
+  // Send several scattered buffers in one vectored write and verify the
+  // peer receives their concatenation.
+  constexpr auto kPart1 = bytes::Array<'v', 'e', 'c'>();
+  constexpr auto kPart2 = bytes::Array<'t', 'o', 'r', 'e', 'd'>();
+  constexpr auto kPart3 = bytes::Array<'!', '!'>();
+  const std::array<ConstByteSpan, 3> buffers = {kPart1, kPart2, kPart3};
+
+  Status write_status = Status::Unavailable();
+  auto write_thread =
+      std::thread{[&]() { write_status = client.WriteVector(buffers); }};
+
+  std::array<std::byte, 10> read_buffer = {};
+  size_t total_read = 0;
+  while (total_read < read_buffer.size()) {
+    Result<ByteSpan> read_result = server_stream->Read(
+        span(read_buffer).subspan(total_read));
+    ASSERT_EQ(read_result.status(), OkStatus());
+    total_read += read_result->size();
+  }
+  write_thread.join();
+  EXPECT_EQ(write_status, OkStatus());
+
+  constexpr auto kExpected =
+      bytes::Array<'v', 'e', 'c', 't', 'o', 'r', 'e', 'd', '!', '!'>();
+  EXPECT_TRUE(std::equal(
+      kExpected.begin(), kExpected.end(), read_buffer.begin()));
+
+  client.Close();
+  server_stream->Close();
+  server.Close();
+}
+
 TEST(SocketStreamTest, MultipleClients) {
   ServerSocket server;
   EXPECT_EQ(server.Listen(), OkStatus());
@@ -0,0 +1,66 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_string/format_fast.h"
+
+#include <cstring>
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::string {
+namespace {
+
+#if __cplusplus >= 202002L
+
+TEST(FormatFast, AllSpecifiers) {
+  char buffer[64];
+  StatusWithSize result = FormatFast<"x=%d y=%u hex=%X pct=%% s=%s c=%c!">(
+      span(buffer), -42, 7u, 0xbeefu, "hi", 'z');
+  ASSERT_EQ(OkStatus(), result.status());
+  EXPECT_STREQ(buffer, "x=-42 y=7 hex=BEEF pct=% s=hi c=z!");
+  EXPECT_EQ(result.size(), std::strlen(buffer));
+}
+
+TEST(FormatFast, NoArguments) {
+  char buffer[32];
+  ASSERT_EQ(OkStatus(),
+            FormatFast<"battery at 100%%">(span(buffer)).status());
+  EXPECT_STREQ(buffer, "battery at 100%");
+}
+
+TEST(FormatFast, TruncationReportsResourceExhausted) {
+  char buffer[6];
+  StatusWithSize result = FormatFast<"value=%d">(span(buffer), 123456);
+  EXPECT_EQ(Status::ResourceExhausted(), result.status());
+  EXPECT_EQ(buffer[result.size()], '\0');
+}
+
+TEST(FormatFast, LowercaseHex) {
+  char buffer[16];
+  ASSERT_EQ(OkStatus(), FormatFast<"%x">(span(buffer), 0xabcu).status());
+  EXPECT_STREQ(buffer, "abc");
+}
+
+TEST(FormatFast, NullStringPrintsNull) {
+  char buffer[16];
+  const char* null_string = nullptr;
+  ASSERT_EQ(OkStatus(),
+            FormatFast<"s=%s">(span(buffer), null_string).status());
+  EXPECT_STREQ(buffer, "s=(null)");
+}
+
+#endif  // __cplusplus >= 202002L
+
+}  // namespace
+}  // namespace pw::string
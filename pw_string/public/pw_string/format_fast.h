@@ -0,0 +1,265 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "pw_span/span.h"
+#include "pw_status/status_with_size.h"
+#include "pw_string/type_to_string.h"
+
+/// `pw::string::FormatFast` formats a compile-time format string without the
+/// runtime cost of parsing printf flags: the format string is validated and
+/// its specifiers are matched against the argument types at compile time, and
+/// formatting is straight-line copies plus integer/string conversion kernels.
+///
+/// Only the unadorned specifiers `%d`, `%i`, `%u`, `%x`, `%X`, `%c`, `%s`,
+/// and `%%` are supported; no flags, widths, or precisions. Requires C++20.
+namespace pw::string {
+
+#if __cplusplus >= 202002L
+
+/// Wraps a string literal so it can be used as a template argument.
+template <size_t kSize>
+struct FormatLiteral {
+  constexpr FormatLiteral(const char (&string)[kSize]) {
+    for (size_t i = 0; i < kSize; ++i) {
+      value[i] = string[i];
+    }
+  }
+
+  char value[kSize];
+  static constexpr size_t size() { return kSize - 1; }  // Excludes the '\0'.
+};
+
+namespace internal {
+
+// Returns the number of specifiers, or size_t(-1) if the format string
+// contains an unsupported specifier.
+template <FormatLiteral kFormat>
+constexpr size_t CountSpecifiers() {
+  size_t count = 0;
+  for (size_t i = 0; i < kFormat.size(); ++i) {
+    if (kFormat.value[i] != '%') {
+      continue;
+    }
+    ++i;
+    if (i >= kFormat.size()) {
+      return static_cast<size_t>(-1);  // Trailing '%'.
+    }
+    switch (kFormat.value[i]) {
+      case '%':
+        break;  // Literal percent; consumes no argument.
+      case 'd':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'c':
+      case 's':
+        ++count;
+        break;
+      default:
+        return static_cast<size_t>(-1);
+    }
+  }
+  return count;
+}
+
+// Returns the argument-consuming specifier characters in order.
+template <FormatLiteral kFormat, size_t kCount>
+constexpr std::array<char, kCount> Specifiers() {
+  std::array<char, kCount> specifiers{};
+  size_t count = 0;
+  for (size_t i = 0; i < kFormat.size(); ++i) {
+    if (kFormat.value[i] != '%') {
+      continue;
+    }
+    ++i;
+    if (i < kFormat.size() && kFormat.value[i] != '%') {
+      specifiers[count++] = kFormat.value[i];
+    }
+  }
+  return specifiers;
+}
+
+// Compile-time check that one argument matches one specifier.
+template <char kSpecifier, typename Arg>
+constexpr bool SpecifierMatches() {
+  using T = std::remove_cv_t<std::remove_reference_t<Arg>>;
+  switch (kSpecifier) {
+    case 'd':
+    case 'i':
+      return std::is_integral_v<T> && std::is_signed_v<T>;
+    case 'u':
+    case 'x':
+    case 'X':
+      return std::is_integral_v<T> && std::is_unsigned_v<T>;
+    case 'c':
+      return std::is_same_v<T, char>;
+    case 's':
+      return std::is_convertible_v<T, const char*>;
+    default:
+      return false;
+  }
+}
+
+inline StatusWithSize FormatArgument(char, span<char> buffer, char value) {
+  if (buffer.empty()) {
+    return StatusWithSize::ResourceExhausted();
+  }
+  buffer[0] = value;
+  return StatusWithSize(1);
+}
+
+inline StatusWithSize FormatArgument(char,
+                                     span<char> buffer,
+                                     const char* value) {
+  return CopyEntireStringOrNull(value, buffer);
+}
+
+template <typename T,
+          typename = std::enable_if_t<std::is_integral_v<T> &&
+                                      !std::is_same_v<T, char>>>
+StatusWithSize FormatArgument(char specifier, span<char> buffer, T value) {
+  if (specifier == 'x' || specifier == 'X') {
+    StatusWithSize result =
+        IntToHexString(static_cast<uint64_t>(value), buffer);
+    if (specifier == 'X') {
+      for (size_t i = 0; i < result.size(); ++i) {
+        if (buffer[i] >= 'a' && buffer[i] <= 'f') {
+          buffer[i] = static_cast<char>(buffer[i] - 'a' + 'A');
+        }
+      }
+    }
+    return result;
+  }
+  return IntToString(value, buffer);
+}
+
+// Checks every argument against its specifier at compile time.
+template <FormatLiteral kFormat, typename... Args, size_t... kIndices>
+constexpr bool ArgumentsMatchSpecifiers(std::index_sequence<kIndices...>) {
+  [[maybe_unused]] constexpr std::array<char, sizeof...(Args)> kSpecifiers =
+      Specifiers<kFormat, sizeof...(Args)>();
+  return (SpecifierMatches<kSpecifiers[kIndices], Args>() && ...);
+}
+
+}  // namespace internal
+
+/// Formats the compile-time format string `kFormat` into `buffer`,
+/// null-terminating the result. Returns the number of characters written
+/// (excluding the null terminator), with RESOURCE_EXHAUSTED if the output was
+/// truncated.
+template <FormatLiteral kFormat, typename... Args>
+StatusWithSize FormatFast(span<char> buffer, Args... args) {
+  constexpr size_t kSpecifiers = internal::CountSpecifiers<kFormat>();
+  static_assert(kSpecifiers != static_cast<size_t>(-1),
+                "FormatFast supports only %d, %i, %u, %x, %X, %c, %s, and %%, "
+                "with no flags, widths, or precisions");
+  static_assert(kSpecifiers == sizeof...(Args),
+                "The number of arguments must match the format specifiers");
+  static_assert(internal::ArgumentsMatchSpecifiers<kFormat, Args...>(
+                    std::index_sequence_for<Args...>{}),
+                "Argument types must match their format specifiers: signed "
+                "integers for %d/%i, unsigned for %u/%x/%X, char for %c, and "
+                "C strings for %s");
+
+  if (buffer.empty()) {
+    return StatusWithSize::ResourceExhausted();
+  }
+
+  // Reserve space for the null terminator up front.
+  span<char> remaining = buffer.first(buffer.size() - 1);
+  size_t written = 0;
+  bool out_of_space = false;
+  size_t index = 0;
+
+  // Copies literal characters up to the next specifier (or the end).
+  const auto copy_literal_run = [&](size_t end) {
+    const size_t run = end - index;
+    const size_t to_copy = std::min(run, remaining.size() - written);
+    std::memcpy(remaining.data() + written, &kFormat.value[index], to_copy);
+    written += to_copy;
+    out_of_space = out_of_space || to_copy < run;
+    index = end;
+  };
+
+  [[maybe_unused]] const auto format_one = [&](auto arg) {
+    // Find the next argument-consuming specifier.
+    while (index < kFormat.size()) {
+      const void* next = std::memchr(
+          &kFormat.value[index], '%', kFormat.size() - index);
+      const size_t percent =
+          next == nullptr
+              ? kFormat.size()
+              : static_cast<size_t>(static_cast<const char*>(next) -
+                                    kFormat.value);
+      copy_literal_run(percent);
+      if (index >= kFormat.size()) {
+        return;
+      }
+      const char specifier = kFormat.value[index + 1];
+      if (specifier == '%') {
+        if (written < remaining.size()) {
+          remaining[written++] = '%';
+        } else {
+          out_of_space = true;
+        }
+        index += 2;
+        continue;
+      }
+      index += 2;
+      const StatusWithSize result = internal::FormatArgument(
+          specifier, remaining.subspan(written), arg);
+      written += result.size();
+      out_of_space = out_of_space || !result.ok();
+      return;
+    }
+  };
+  (format_one(args), ...);
+
+  // Copy the remainder of the format string, handling trailing "%%".
+  while (index < kFormat.size()) {
+    if (kFormat.value[index] == '%') {
+      if (written < remaining.size()) {
+        remaining[written++] = '%';
+      } else {
+        out_of_space = true;
+      }
+      index += 2;
+      continue;
+    }
+    const void* next =
+        std::memchr(&kFormat.value[index], '%', kFormat.size() - index);
+    const size_t percent =
+        next == nullptr ? kFormat.size()
+                        : static_cast<size_t>(
+                              static_cast<const char*>(next) - kFormat.value);
+    copy_literal_run(percent);
+  }
+
+  buffer[written] = '\0';
+  return StatusWithSize(out_of_space ? Status::ResourceExhausted() : OkStatus(),
+                        written);
+}
+
+#endif  // __cplusplus >= 202002L
+
+}  // namespace pw::string
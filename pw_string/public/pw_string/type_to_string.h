@@ -161,6 +161,15 @@ namespace internal {
 
 // Powers of 10 (except 0) as an array. This table is fairly large (160 B), but
 // avoids having to recalculate these values for each DecimalDigitCount call.
+// Lookup table of two-digit pairs ("00", "01", ..., "99"), so the conversion
+// loop emits two digits per division instead of one.
+inline constexpr const char* kTwoDigitPairs =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 inline constexpr std::array<uint64_t, 20> kPowersOf10{
     0ull,
     10ull,                    // 10^1
@@ -239,10 +248,17 @@ constexpr StatusWithSize IntToString(uint64_t value, span<char> buffer) {
       value /= max_uint32_base_power;
     }
 
-    // Write the specified number of digits, with leading 0s.
-    for (uint_fast8_t i = 0; i < digit_count; ++i) {
+    // Write the specified number of digits, with leading 0s, two digits per
+    // division using the pair lookup table.
+    while (digit_count >= 2) {
+      const uint32_t pair = (lower_digits % (base * base)) * 2;
+      lower_digits /= base * base;
+      buffer[--remaining] = internal::kTwoDigitPairs[pair + 1];
+      buffer[--remaining] = internal::kTwoDigitPairs[pair];
+      digit_count = static_cast<uint_fast8_t>(digit_count - 2);
+    }
+    if (digit_count != 0) {
       buffer[--remaining] = static_cast<char>(lower_digits % base + '0');
-      lower_digits /= base;
     }
   }
   return StatusWithSize(total_digits);
@@ -19,6 +19,7 @@
 #include <array>
 #include <cstdint>
 #include <string_view>
+#include <type_traits>
 
 #include "pw_result/result.h"
 #include "pw_status/status.h"
@@ -168,8 +169,35 @@ constexpr pw::Result<utf::CodePointAndSize> ReadCodePoint(
 }
 
 /// Determines if `str` is a valid UTF-8 string.
+///
+/// ASCII runs, the overwhelmingly common case, are validated eight bytes at
+/// a time with a branch-free word test; only bytes with the high bit set go
+/// through the code point decoder.
 constexpr bool IsStringValid(std::string_view str) {
   while (!str.empty()) {
+    // Word-wide ASCII fast path: eight bytes are ASCII iff no byte has its
+    // high bit set. Skipped in constant evaluation, where the loop below is
+    // used unconditionally.
+#ifdef __cpp_lib_is_constant_evaluated
+    if (!std::is_constant_evaluated()) {
+      while (str.size() >= sizeof(uint64_t)) {
+        uint64_t word;
+        __builtin_memcpy(&word, str.data(), sizeof(word));
+        if ((word & UINT64_C(0x8080808080808080)) != 0) {
+          break;
+        }
+        str = str.substr(sizeof(word));
+      }
+      if (str.empty()) {
+        return true;
+      }
+    }
+#endif  // __cpp_lib_is_constant_evaluated
+    // Single-byte ASCII characters skip the decoder.
+    if (static_cast<unsigned char>(str.front()) < 0x80) {
+      str = str.substr(1);
+      continue;
+    }
     auto rslt = utf8::ReadCodePoint(str);
     if (!rslt.ok() || !utf::IsValidCharacter(rslt->code_point())) {
       return false;
@@ -0,0 +1,51 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sync/adaptive_thread_notification.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::sync {
+namespace {
+
+TEST(AdaptiveThreadNotification, ReleaseThenAcquireTakesSpinPath) {
+  AdaptiveThreadNotification notification;
+  notification.release();
+  notification.acquire();  // Must not block: the flag is already set.
+}
+
+TEST(AdaptiveThreadNotification, TryAcquire) {
+  AdaptiveThreadNotification notification;
+  EXPECT_FALSE(notification.try_acquire());
+  notification.release();
+  EXPECT_TRUE(notification.try_acquire());
+  EXPECT_FALSE(notification.try_acquire());
+}
+
+TEST(AdaptiveThreadNotification, MultipleReleasesSaturate) {
+  AdaptiveThreadNotification notification;
+  notification.release();
+  notification.release();
+  EXPECT_TRUE(notification.try_acquire());
+  EXPECT_FALSE(notification.try_acquire());
+}
+
+TEST(AdaptiveThreadNotification, ZeroSpinBudgetFallsStraightToBackend) {
+  AdaptiveThreadNotification notification(/* max_spin_rounds= */ 0);
+  notification.release();
+  notification.acquire();  // Served by the backend latch.
+}
+
+}  // namespace
+}  // namespace pw::sync
@@ -0,0 +1,95 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "pw_sync/thread_notification.h"
+
+namespace pw::sync {
+
+/// `ThreadNotification` with an adaptive spin-then-block acquire, for
+/// multicore pipelines where the notifier usually signals within
+/// microseconds. Backends block immediately, so even an instant
+/// notification pays the scheduler's full block/unblock round trip;
+/// `AdaptiveThreadNotification` first spins on an atomic flag with
+/// exponential backoff -- catching short cross-core handoffs with no
+/// scheduler involvement -- and falls back to the blocking backend for long
+/// waits, keeping idle waiting power-friendly.
+///
+/// The spin budget is tunable per instance: pass the maximum number of
+/// backoff rounds (each round roughly doubles the pause between flag
+/// checks; 0 disables spinning entirely). Same contract as
+/// `ThreadNotification`: single consumer, multiple notifiers,
+/// release-from-ISR per the backend's rules.
+class AdaptiveThreadNotification {
+ public:
+  explicit AdaptiveThreadNotification(uint32_t max_spin_rounds = 10)
+      : max_spin_rounds_(max_spin_rounds) {}
+
+  AdaptiveThreadNotification(const AdaptiveThreadNotification&) = delete;
+  AdaptiveThreadNotification& operator=(const AdaptiveThreadNotification&) =
+      delete;
+
+  /// Blocks until notified, spinning first. Single consumer only.
+  void acquire() {
+    uint32_t pause_iterations = 1;
+    for (uint32_t round = 0; round < max_spin_rounds_; ++round) {
+      if (notified_.exchange(false, std::memory_order_acquire)) {
+        return;
+      }
+      for (uint32_t i = 0; i < pause_iterations; ++i) {
+        // Keep the pause loop from being optimized away.
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+      }
+      pause_iterations <<= 1;
+    }
+
+    // Slow path: block on the backend. A release may have been consumed by
+    // an earlier spin while the backend latch stayed set, so re-check the
+    // flag after each wake rather than trusting the latch alone.
+    while (true) {
+      notification_.acquire();
+      if (notified_.exchange(false, std::memory_order_acquire)) {
+        return;
+      }
+    }
+  }
+
+  /// Returns whether the thread has been notified; never blocks or spins.
+  bool try_acquire() {
+    if (!notified_.exchange(false, std::memory_order_acquire)) {
+      return false;
+    }
+    // Consume the backend latch set by the matching release, so it does not
+    // cause a spurious wake for a later acquire.
+    static_cast<void>(notification_.try_acquire());
+    return true;
+  }
+
+  /// Notifies the waiting thread. Callable per the backend's
+  /// release-context rules (thread and, where supported, interrupt).
+  void release() {
+    notified_.store(true, std::memory_order_release);
+    notification_.release();
+  }
+
+ private:
+  const uint32_t max_spin_rounds_;
+  std::atomic<bool> notified_{false};
+  ThreadNotification notification_;
+};
+
+}  // namespace pw::sync
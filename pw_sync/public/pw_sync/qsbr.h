@@ -0,0 +1,141 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_sync/qsbr.h
+///
+/// Quiescent-state-based reclamation (QSBR) for read-mostly data structures.
+/// Intrusive containers cannot be read lock-free while writers unlink nodes:
+/// a reader may still hold a pointer to a node the writer wants to free.
+/// QSBR removes the read-side cost of solving this: readers perform plain
+/// loads and a single relaxed store per quiescent announcement -- zero
+/// atomic read-modify-write operations -- while writers retire unlinked
+/// nodes and reclaim them only after every registered reader has passed
+/// through a quiescent state (a point where it holds no container
+/// references).
+///
+/// Typical use for a routing/config table read 10^5 times per write:
+/// readers traverse with no synchronization and call `Quiesce` at their loop
+/// boundary (e.g. once per dispatcher poll or packet batch); the writer
+/// unlinks a node, `Retire`s it, and calls `ReclaimExpired` periodically.
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "pw_allocator/deallocator.h"
+#include "pw_assert/assert.h"
+
+namespace pw::sync {
+
+/// QSBR domain tracking up to `kMaxReaders` reader threads and
+/// `kMaxRetired` concurrently retired allocations.
+///
+/// Reader methods (`Quiesce`) are wait-free and safe to call concurrently
+/// from their owning threads. Writer methods (`Retire`, `ReclaimExpired`,
+/// `RegisterReader`) must be externally serialized -- a single writer
+/// thread, or the writer-side lock the structure already has.
+template <size_t kMaxReaders, size_t kMaxRetired>
+class Qsbr {
+ public:
+  using ReaderId = size_t;
+
+  /// Registers the calling thread as a reader. Readers must be registered
+  /// before the structure is shared.
+  ReaderId RegisterReader() {
+    PW_ASSERT(reader_count_ < kMaxReaders);
+    const ReaderId id = reader_count_++;
+    reader_epochs_[id].store(global_epoch_.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+    return id;
+  }
+
+  /// Announces that reader `id` holds no references into protected
+  /// structures. One relaxed load and one release store; no RMW.
+  void Quiesce(ReaderId id) {
+    reader_epochs_[id].store(global_epoch_.load(std::memory_order_relaxed),
+                             std::memory_order_release);
+  }
+
+  /// Retires memory that has been unlinked from the structure. The pointer
+  /// is freed via `deallocator` by a later `ReclaimExpired` call, once every
+  /// reader has quiesced past this point. Returns false (and does not take
+  /// ownership) if the retired table is full; callers should
+  /// `ReclaimExpired` and retry.
+  [[nodiscard]] bool Retire(void* ptr, Deallocator& deallocator) {
+    for (Retired& slot : retired_) {
+      if (slot.ptr == nullptr) {
+        slot.ptr = ptr;
+        slot.deallocator = &deallocator;
+        slot.epoch = global_epoch_.load(std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Advances the grace-period epoch and frees every retired allocation
+  /// that all registered readers have quiesced past. Returns the number
+  /// freed.
+  size_t ReclaimExpired() {
+    // Publish a new epoch; nodes retired before this point are reclaimable
+    // once every reader has announced quiescence at or after it.
+    const uint32_t reclaim_epoch =
+        global_epoch_.fetch_add(1, std::memory_order_acq_rel);
+
+    uint32_t min_reader_epoch = reclaim_epoch + 1;
+    for (size_t i = 0; i < reader_count_; ++i) {
+      const uint32_t seen = reader_epochs_[i].load(std::memory_order_acquire);
+      if (static_cast<int32_t>(seen - min_reader_epoch) < 0) {
+        min_reader_epoch = seen;
+      }
+    }
+
+    size_t freed = 0;
+    for (Retired& slot : retired_) {
+      if (slot.ptr != nullptr &&
+          static_cast<int32_t>(slot.epoch - min_reader_epoch) < 0) {
+        slot.deallocator->Deallocate(slot.ptr);
+        slot.ptr = nullptr;
+        ++freed;
+      }
+    }
+    return freed;
+  }
+
+  /// Retired allocations not yet reclaimed.
+  size_t retired_count() const {
+    size_t count = 0;
+    for (const Retired& slot : retired_) {
+      if (slot.ptr != nullptr) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+ private:
+  struct Retired {
+    void* ptr = nullptr;
+    Deallocator* deallocator = nullptr;
+    uint32_t epoch = 0;
+  };
+
+  std::atomic<uint32_t> global_epoch_{1};
+  std::array<std::atomic<uint32_t>, kMaxReaders> reader_epochs_ = {};
+  size_t reader_count_ = 0;
+  std::array<Retired, kMaxRetired> retired_ = {};
+};
+
+}  // namespace pw::sync
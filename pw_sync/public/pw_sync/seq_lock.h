@@ -0,0 +1,102 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace pw::sync {
+
+/// A sequence lock: wait-free publication of multi-word data by a single
+/// writer, with lock-free retrying readers.
+///
+/// The writer is never blocked by readers, making this suited to telemetry
+/// and state snapshots updated from a high-priority context (or an interrupt)
+/// and read from lower-priority contexts. Readers retry if a write overlapped
+/// their read, so reads are not wait-free but never block the writer.
+///
+/// Only one writer may be active at a time; serialize writers externally if
+/// there are several.
+class SeqLock {
+ public:
+  constexpr SeqLock() : sequence_(0) {}
+
+  /// Marks the start of a write. Only one writer at a time.
+  void WriteBegin() {
+    sequence_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /// Marks the end of a write, publishing the data to readers.
+  void WriteEnd() {
+    std::atomic_thread_fence(std::memory_order_release);
+    sequence_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Begins a read attempt, returning a token for `ReadRetry`.
+  uint32_t ReadBegin() const {
+    const uint32_t sequence = sequence_.load(std::memory_order_acquire);
+    return sequence;
+  }
+
+  /// Returns true if the read overlapped a write and must be retried.
+  bool ReadRetry(uint32_t token) const {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (token & 1u) != 0 ||
+           sequence_.load(std::memory_order_relaxed) != token;
+  }
+
+ private:
+  std::atomic<uint32_t> sequence_;
+};
+
+/// A value published through a `SeqLock`. `T` must be trivially copyable;
+/// reads return a consistent snapshot without ever blocking the writer.
+template <typename T>
+class SeqLocked {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SeqLocked requires a trivially copyable type");
+
+  constexpr SeqLocked() : value_{} {}
+  explicit constexpr SeqLocked(const T& initial) : value_(initial) {}
+
+  /// Publishes a new value. Wait-free; single writer only.
+  void Write(const T& value) {
+    lock_.WriteBegin();
+    std::memcpy(const_cast<std::remove_volatile_t<T>*>(&value_),
+                &value,
+                sizeof(T));
+    lock_.WriteEnd();
+  }
+
+  /// Returns a consistent snapshot, retrying if a write overlapped.
+  T Read() const {
+    T snapshot;
+    uint32_t token;
+    do {
+      token = lock_.ReadBegin();
+      std::memcpy(&snapshot, const_cast<const T*>(&value_), sizeof(T));
+    } while (lock_.ReadRetry(token));
+    return snapshot;
+  }
+
+ private:
+  SeqLock lock_;
+  T value_;
+};
+
+}  // namespace pw::sync
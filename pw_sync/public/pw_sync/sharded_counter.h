@@ -0,0 +1,77 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace pw::sync {
+
+/// A counter sharded across cache lines for low-contention hot-path
+/// instrumentation on multi-core systems.
+///
+/// A single shared atomic counter incremented from several cores bounces its
+/// cache line between them on every increment. `ShardedCounter` keeps one
+/// relaxed atomic per shard, each on its own (destructively interfering)
+/// cache line; callers increment the shard for their core, so increments stay
+/// core-local and uncontended. Reads sum all shards and are approximate while
+/// writers are running, which is the usual contract for statistics counters.
+///
+/// Increments are lock-free and interrupt-safe. Size `kShards` to the number
+/// of cores (or contexts) that update the counter.
+template <size_t kShards>
+class ShardedCounter {
+ public:
+  static_assert(kShards > 0);
+
+  constexpr ShardedCounter() : shards_{} {}
+
+  /// Adds to the shard for the caller's core or context. `shard` values
+  /// beyond `kShards` wrap, so a raw CPU number can be passed directly.
+  void Increment(size_t shard, uint32_t amount = 1) {
+    shards_[shard % kShards].value.fetch_add(amount,
+                                             std::memory_order_relaxed);
+  }
+
+  /// Sums all shards. Approximate while writers are running.
+  uint64_t Total() const {
+    uint64_t total = 0;
+    for (const Shard& shard : shards_) {
+      total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  /// Resets every shard to zero. Not atomic with respect to writers.
+  void Reset() {
+    for (Shard& shard : shards_) {
+      shard.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  // 64 bytes covers the destructive interference size of the supported
+  // targets; std::hardware_destructive_interference_size is deliberately not
+  // used since its value is ABI-unstable across compiler flags.
+  static constexpr size_t kShardAlignment = 64;
+
+  struct alignas(kShardAlignment) Shard {
+    std::atomic<uint32_t> value;
+  };
+
+  Shard shards_[kShards];
+};
+
+}  // namespace pw::sync
@@ -0,0 +1,91 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sync/qsbr.h"
+
+#include "pw_allocator/testing.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::sync {
+namespace {
+
+using AllocatorForTest = ::pw::allocator::test::AllocatorForTest<512>;
+
+TEST(QsbrTest, RetiredMemoryIsNotFreedUntilAllReadersQuiesce) {
+  AllocatorForTest allocator;
+  Qsbr<2, 4> qsbr;
+  const auto reader_a = qsbr.RegisterReader();
+  const auto reader_b = qsbr.RegisterReader();
+
+  void* node = allocator.Allocate(allocator::Layout(16, 4));
+  ASSERT_NE(node, nullptr);
+  ASSERT_TRUE(qsbr.Retire(node, allocator));
+  EXPECT_EQ(qsbr.retired_count(), 1u);
+
+  // No reader has quiesced since the retire: nothing can be freed.
+  EXPECT_EQ(qsbr.ReclaimExpired(), 0u);
+
+  // Only one reader quiesced: still unsafe.
+  qsbr.Quiesce(reader_a);
+  EXPECT_EQ(qsbr.ReclaimExpired(), 0u);
+
+  // Both quiesced past the retire point: now reclaimed.
+  qsbr.Quiesce(reader_a);
+  qsbr.Quiesce(reader_b);
+  EXPECT_EQ(qsbr.ReclaimExpired(), 1u);
+  EXPECT_EQ(qsbr.retired_count(), 0u);
+  EXPECT_EQ(allocator.deallocate_ptr(), node);
+}
+
+TEST(QsbrTest, NoReadersMeansImmediateReclaim) {
+  AllocatorForTest allocator;
+  Qsbr<2, 4> qsbr;
+
+  void* node = allocator.Allocate(allocator::Layout(16, 4));
+  ASSERT_TRUE(qsbr.Retire(node, allocator));
+  // With no registered readers there is nothing to wait for.
+  EXPECT_EQ(qsbr.ReclaimExpired(), 1u);
+}
+
+TEST(QsbrTest, RetireTableFullReportsFailure) {
+  AllocatorForTest allocator;
+  Qsbr<1, 2> qsbr;
+
+  void* a = allocator.Allocate(allocator::Layout(8, 4));
+  void* b = allocator.Allocate(allocator::Layout(8, 4));
+  void* c = allocator.Allocate(allocator::Layout(8, 4));
+  ASSERT_TRUE(qsbr.Retire(a, allocator));
+  ASSERT_TRUE(qsbr.Retire(b, allocator));
+  EXPECT_FALSE(qsbr.Retire(c, allocator));
+  allocator.Deallocate(c);
+}
+
+TEST(QsbrTest, StaleReaderBlocksReclamationIndefinitely) {
+  AllocatorForTest allocator;
+  Qsbr<2, 4> qsbr;
+  const auto active = qsbr.RegisterReader();
+  (void)qsbr.RegisterReader();  // Never quiesces.
+
+  void* node = allocator.Allocate(allocator::Layout(16, 4));
+  ASSERT_TRUE(qsbr.Retire(node, allocator));
+
+  for (int i = 0; i < 5; ++i) {
+    qsbr.Quiesce(active);
+    EXPECT_EQ(qsbr.ReclaimExpired(), 0u);
+  }
+  EXPECT_EQ(qsbr.retired_count(), 1u);
+}
+
+}  // namespace
+}  // namespace pw::sync
@@ -0,0 +1,57 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sync/seq_lock.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::sync {
+namespace {
+
+struct Telemetry {
+  uint32_t uptime;
+  uint32_t packets;
+  uint32_t errors;
+};
+
+TEST(SeqLocked, ReadsBackWrites) {
+  SeqLocked<Telemetry> shared;
+  shared.Write(Telemetry{.uptime = 1, .packets = 2, .errors = 3});
+
+  const Telemetry snapshot = shared.Read();
+  EXPECT_EQ(snapshot.uptime, 1u);
+  EXPECT_EQ(snapshot.packets, 2u);
+  EXPECT_EQ(snapshot.errors, 3u);
+}
+
+TEST(SeqLock, ReaderObservesInProgressWrite) {
+  SeqLock lock;
+  const uint32_t before = lock.ReadBegin();
+  EXPECT_FALSE(lock.ReadRetry(before));  // No write happened.
+
+  lock.WriteBegin();
+  // A read starting during the write must retry.
+  const uint32_t during = lock.ReadBegin();
+  EXPECT_TRUE(lock.ReadRetry(during));
+  lock.WriteEnd();
+
+  // A read spanning the whole write must also retry.
+  EXPECT_TRUE(lock.ReadRetry(before));
+
+  const uint32_t after = lock.ReadBegin();
+  EXPECT_FALSE(lock.ReadRetry(after));
+}
+
+}  // namespace
+}  // namespace pw::sync
@@ -0,0 +1,41 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sync/sharded_counter.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::sync {
+namespace {
+
+TEST(ShardedCounter, SumsAcrossShards) {
+  ShardedCounter<4> counter;
+  counter.Increment(0);
+  counter.Increment(1, 10);
+  counter.Increment(2, 100);
+  counter.Increment(7, 1000);  // Wraps to shard 3.
+  EXPECT_EQ(counter.Total(), 1111u);
+
+  counter.Reset();
+  EXPECT_EQ(counter.Total(), 0u);
+}
+
+TEST(ShardedCounter, ShardsDoNotShareCacheLines) {
+  ShardedCounter<2> counter;
+  // Each shard is padded to at least a cache line.
+  EXPECT_GE(sizeof(counter), 2u * 64u);
+}
+
+}  // namespace
+}  // namespace pw::sync
@@ -38,14 +38,23 @@ static_assert(configSUPPORT_STATIC_ALLOCATION != 0,
 
 void CountingSemaphore::release(ptrdiff_t update) {
   if (interrupt::InInterruptContext()) {
+    // Accumulate the wake decision across the whole update and request the
+    // context switch once at the end, rather than once per count. This keeps
+    // the ISR's added latency for a multi-count release to a single yield
+    // request and avoids per-iteration pended-switch bookkeeping on ports
+    // where portYIELD_FROM_ISR does more than set a flag.
+    BaseType_t woke_higher_task = pdFALSE;
     for (; update > 0; --update) {
-      BaseType_t woke_higher_task = pdFALSE;
+      BaseType_t woke_this_give = pdFALSE;
       const BaseType_t result = xSemaphoreGiveFromISR(
           reinterpret_cast<SemaphoreHandle_t>(&native_type_),
-          &woke_higher_task);
+          &woke_this_give);
       PW_DCHECK_UINT_EQ(result, pdTRUE, "Overflowed counting semaphore.");
-      portYIELD_FROM_ISR(woke_higher_task);
+      if (woke_this_give == pdTRUE) {
+        woke_higher_task = pdTRUE;
+      }
     }
+    portYIELD_FROM_ISR(woke_higher_task);
   } else {  // Task context
     for (; update > 0; --update) {
       const BaseType_t result =
@@ -0,0 +1,106 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+
+#include "pw_assert/assert.h"
+#include "pw_bytes/span.h"
+
+namespace pw::sys_io {
+
+/// Bounded-latency transmit staging ring for `pw_sys_io` backends that drain
+/// via DMA or a TX interrupt (e.g. a Cortex-M UART backend).
+///
+/// Busy-wait `WriteByte` implementations make logging latency depend on the
+/// wire: a log line stalls the caller for its transmission time. Backends
+/// instead push into this ring from `pw_sys_io_WriteByte`/`WriteBytes` in
+/// O(1) and kick the DMA engine; the DMA-complete interrupt asks for the next
+/// contiguous region to transmit and releases it when done. Push-side latency
+/// is then bounded by a memcpy, and only overflow (ring full) ever drops.
+///
+/// Single producer (the logging context) and single consumer (the DMA/ISR
+/// drain); the indices use acquire/release atomics so no lock or interrupt
+/// masking is needed between them.
+class TxRing {
+ public:
+  /// `buffer`'s size must be a power of two: the ring indices are
+  /// free-running 32-bit counters mapped with a modulo, and a
+  /// non-power-of-two size breaks the mapping when they wrap (after 4 GB of
+  /// transmitted data).
+  explicit TxRing(ByteSpan buffer) : buffer_(buffer) {
+    PW_ASSERT(!buffer_.empty() &&
+              (buffer_.size() & (buffer_.size() - 1)) == 0);
+  }
+
+  /// Stages bytes for transmission. O(1) plus the copy; returns the number
+  /// of bytes accepted (less than `data.size()` only when the ring fills).
+  size_t Push(ConstByteSpan data) {
+    const uint32_t write = write_.load(std::memory_order_relaxed);
+    const uint32_t read = read_.load(std::memory_order_acquire);
+    const size_t free_bytes = buffer_.size() - (write - read);
+    const size_t to_copy = data.size() < free_bytes ? data.size() : free_bytes;
+
+    const size_t start = write % buffer_.size();
+    const size_t first = to_copy < buffer_.size() - start
+                             ? to_copy
+                             : buffer_.size() - start;
+    std::memcpy(buffer_.data() + start, data.data(), first);
+    std::memcpy(buffer_.data(), data.data() + first, to_copy - first);
+    write_.store(write + static_cast<uint32_t>(to_copy),
+                 std::memory_order_release);
+    return to_copy;
+  }
+
+  /// Returns the next contiguous staged region, suitable for handing to a
+  /// DMA engine directly (no copy). Empty when nothing is staged. Call
+  /// `Release` with the transmitted size when the transfer completes.
+  ConstByteSpan NextDmaRegion() const {
+    const uint32_t read = read_.load(std::memory_order_relaxed);
+    const uint32_t write = write_.load(std::memory_order_acquire);
+    const size_t pending = write - read;
+    if (pending == 0) {
+      return ConstByteSpan();
+    }
+    const size_t start = read % buffer_.size();
+    const size_t contiguous = buffer_.size() - start;
+    return ConstByteSpan(buffer_.data() + start,
+                         pending < contiguous ? pending : contiguous);
+  }
+
+  /// Releases transmitted bytes back to the producer. Call from the
+  /// DMA-complete interrupt with the size actually sent.
+  void Release(size_t bytes) {
+    read_.store(read_.load(std::memory_order_relaxed) +
+                    static_cast<uint32_t>(bytes),
+                std::memory_order_release);
+  }
+
+  /// Bytes currently staged.
+  size_t pending_bytes() const {
+    return write_.load(std::memory_order_acquire) -
+           read_.load(std::memory_order_acquire);
+  }
+
+  bool empty() const { return pending_bytes() == 0; }
+
+ private:
+  ByteSpan buffer_;
+  std::atomic<uint32_t> write_{0};
+  std::atomic<uint32_t> read_{0};
+};
+
+}  // namespace pw::sys_io
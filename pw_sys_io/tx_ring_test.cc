@@ -0,0 +1,69 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_sys_io/tx_ring.h"
+
+#include <array>
+
+#include "pw_bytes/array.h"
+#include "pw_unit_test/framework.h"
+
+namespace pw::sys_io {
+namespace {
+
+TEST(TxRing, StagesAndDrainsInOrder) {
+  std::array<std::byte, 8> storage;
+  TxRing ring(storage);
+
+  constexpr auto kData = bytes::Array<1, 2, 3, 4, 5>();
+  EXPECT_EQ(ring.Push(kData), kData.size());
+  EXPECT_EQ(ring.pending_bytes(), 5u);
+
+  ConstByteSpan region = ring.NextDmaRegion();
+  ASSERT_EQ(region.size(), 5u);
+  EXPECT_EQ(region[0], std::byte{1});
+  ring.Release(region.size());
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(TxRing, WrapsWithTwoDmaRegions) {
+  std::array<std::byte, 8> storage;
+  TxRing ring(storage);
+
+  constexpr auto kSix = bytes::Array<1, 2, 3, 4, 5, 6>();
+  ASSERT_EQ(ring.Push(kSix), 6u);
+  ring.Release(ring.NextDmaRegion().size());  // Drain all six.
+
+  // This push wraps the end of the storage.
+  ASSERT_EQ(ring.Push(kSix), 6u);
+  ConstByteSpan first = ring.NextDmaRegion();
+  EXPECT_EQ(first.size(), 2u);  // Up to the end of the buffer.
+  ring.Release(first.size());
+  ConstByteSpan second = ring.NextDmaRegion();
+  EXPECT_EQ(second.size(), 4u);  // The wrapped remainder.
+  EXPECT_EQ(second[0], std::byte{3});
+  ring.Release(second.size());
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(TxRing, FullRingAcceptsPartialPush) {
+  std::array<std::byte, 4> storage;
+  TxRing ring(storage);
+  constexpr auto kSix = bytes::Array<1, 2, 3, 4, 5, 6>();
+  EXPECT_EQ(ring.Push(kSix), 4u);  // Only what fits.
+  EXPECT_EQ(ring.Push(kSix), 0u);  // Full.
+}
+
+}  // namespace
+}  // namespace pw::sys_io
@@ -0,0 +1,50 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_system/deferred_init.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace {
+
+int init_order = 0;
+int first_ran_at = 0;
+int second_ran_at = 0;
+
+PW_SYSTEM_DEFERRED_INIT(first) { first_ran_at = ++init_order; }
+PW_SYSTEM_DEFERRED_INIT(second) { second_ran_at = ++init_order; }
+
+TEST(DeferredInit, RunsOnceInRegistrationOrder) {
+  // Nothing runs until RunAll is invoked.
+  EXPECT_EQ(init_order, 0);
+
+  pw::system::DeferredInit::RunAll();
+  EXPECT_EQ(first_ran_at, 1);
+  EXPECT_EQ(second_ran_at, 2);
+
+  // A second RunAll is a no-op.
+  pw::system::DeferredInit::RunAll();
+  EXPECT_EQ(init_order, 2);
+}
+
+TEST(DeferredInit, LateRegistrationsRunOnNextRunAll) {
+  int ran = 0;
+  pw::system::DeferredInit late([&ran] { ran += 1; });
+  pw::system::DeferredInit::RunAll();
+  EXPECT_EQ(ran, 1);
+  pw::system::DeferredInit::RunAll();
+  EXPECT_EQ(ran, 1);
+}
+
+}  // namespace
@@ -0,0 +1,75 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_system/deferred_init.h
+///
+/// Deferred initialization for components that do not need to run before the
+/// scheduler starts. Registering init work as a `DeferredInit` moves it off
+/// the boot path: registrations are collected in a static list with no
+/// allocation or init-order dependencies, and `DeferredInit::RunAll()` is
+/// invoked once from a low-priority context (e.g. the pw_system work queue)
+/// after the system is up, trimming time-to-first-function while keeping
+/// component setup declarative.
+///
+/// @code{.cpp}
+///   PW_SYSTEM_DEFERRED_INIT(telemetry) {
+///     StartTelemetryService();  // Runs after the scheduler starts.
+///   }
+/// @endcode
+
+#include "pw_containers/intrusive_list.h"
+#include "pw_function/function.h"
+
+namespace pw::system {
+
+/// A unit of initialization deferred until after system start. Instances are
+/// typically defined at namespace scope via `PW_SYSTEM_DEFERRED_INIT`.
+class DeferredInit : public IntrusiveList<DeferredInit>::Item {
+ public:
+  explicit DeferredInit(Function<void()>&& init) : init_(std::move(init)) {
+    list().push_back(*this);
+  }
+
+  /// Runs all registered deferred initializers in registration order. Called
+  /// once by the system's init task after the scheduler starts; safe to call
+  /// again (each initializer runs only once).
+  static void RunAll() {
+    for (DeferredInit& entry : list()) {
+      if (!entry.ran_) {
+        entry.ran_ = true;
+        entry.init_();
+      }
+    }
+  }
+
+ private:
+  static IntrusiveList<DeferredInit>& list() {
+    static IntrusiveList<DeferredInit> instances;
+    return instances;
+  }
+
+  Function<void()> init_;
+  bool ran_ = false;
+};
+
+}  // namespace pw::system
+
+/// Defines a deferred initializer with the provided name. The block following
+/// the macro is the initializer body.
+#define PW_SYSTEM_DEFERRED_INIT(name)                             \
+  static void _pw_system_deferred_init_##name();                  \
+  static ::pw::system::DeferredInit _pw_system_deferred_##name(   \
+      _pw_system_deferred_init_##name);                           \
+  static void _pw_system_deferred_init_##name()
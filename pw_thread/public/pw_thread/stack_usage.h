@@ -0,0 +1,70 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "pw_function/function.h"
+#include "pw_status/status.h"
+#include "pw_thread/thread_info.h"
+#include "pw_thread/thread_iteration.h"
+
+namespace pw::thread {
+
+/// Stack usage telemetry for one thread, derived from the iteration
+/// backend's `ThreadInfo`.
+struct StackUsage {
+  /// The thread's name, or empty if the backend does not report one.
+  std::string_view name;
+  /// Total stack size in bytes, or 0 if the stack bounds are unknown.
+  uintptr_t stack_size_bytes;
+  /// Estimated peak (high-water) usage in bytes, or 0 if unknown.
+  uintptr_t peak_used_bytes;
+};
+
+/// Invokes `callback` with the stack usage of every thread the iteration
+/// backend reports, for periodic telemetry export (e.g. into pw_metric
+/// counters or a log line) without capturing full snapshots.
+///
+/// Forwards the status of `ForEachThread`. Fields the backend does not
+/// report are zero; callers should treat `peak_used_bytes == 0` with a
+/// nonzero stack size as "unknown", not "unused".
+inline Status ForEachThreadStackUsage(
+    const Function<void(const StackUsage&)>& callback) {
+  return ForEachThread([&callback](const ThreadInfo& info) {
+    StackUsage usage = {};
+    if (info.thread_name().has_value()) {
+      const auto name = *info.thread_name();
+      usage.name = std::string_view(
+          reinterpret_cast<const char*>(name.data()), name.size());
+    }
+    // Stacks may grow up or down; normalize to sizes.
+    if (info.stack_low_addr().has_value() &&
+        info.stack_high_addr().has_value()) {
+      usage.stack_size_bytes = *info.stack_high_addr() - *info.stack_low_addr();
+    }
+    if (info.stack_peak_addr().has_value() &&
+        info.stack_high_addr().has_value() &&
+        *info.stack_high_addr() >= *info.stack_peak_addr()) {
+      // Full-descending stacks: peak usage extends from the high address
+      // down to the deepest (lowest) touched address.
+      usage.peak_used_bytes = *info.stack_high_addr() - *info.stack_peak_addr();
+    }
+    callback(usage);
+    return true;  // Continue iterating.
+  });
+}
+
+}  // namespace pw::thread
@@ -0,0 +1,59 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <string_view>
+
+#include "pw_kvs/key_value_store.h"
+#include "pw_string/string.h"
+#include "pw_tls_client/session_ticket_store.h"
+
+namespace pw::tls_client {
+
+// SessionTicketStore backed by a pw_kvs KeyValueStore, persisting tickets
+// across reboots. Keys are "tls1/<server_name>"; server names longer than
+// the KVS key limit are truncated, which keeps distinct prefixes distinct in
+// practice (tickets are advisory: a wrong match only costs a failed
+// resumption and a full handshake).
+class KvsSessionTicketStore : public SessionTicketStore {
+ public:
+  explicit KvsSessionTicketStore(kvs::KeyValueStore& kvs) : kvs_(kvs) {}
+
+  StatusWithSize Load(std::string_view server_name, ByteSpan out) override {
+    return kvs_.Get(MakeKey(server_name), out);
+  }
+
+  Status Store(std::string_view server_name, ConstByteSpan ticket) override {
+    return kvs_.Put(MakeKey(server_name), ticket);
+  }
+
+  Status Invalidate(std::string_view server_name) override {
+    const Status status = kvs_.Delete(MakeKey(server_name));
+    return status.IsNotFound() ? OkStatus() : status;
+  }
+
+ private:
+  using Key = InlineString<kvs::internal::Entry::kMaxKeyLength>;
+
+  static Key MakeKey(std::string_view server_name) {
+    Key key("tls1/");
+    key.append(server_name.substr(
+        0, std::min(server_name.size(), key.capacity() - key.size())));
+    return key;
+  }
+
+  kvs::KeyValueStore& kvs_;
+};
+
+}  // namespace pw::tls_client
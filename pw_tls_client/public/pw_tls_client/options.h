@@ -19,6 +19,7 @@
 #include "pw_assert/assert.h"
 #include "pw_assert/check.h"
 #include "pw_stream/stream.h"
+#include "pw_tls_client/session_ticket_store.h"
 #include "pw_string/util.h"
 
 namespace pw::tls_client {
@@ -51,9 +52,24 @@ class SessionOptions {
 
   constexpr std::string_view server_name() const { return server_name_; }
 
+  // Sets a store for TLS session tickets, enabling session resumption: the
+  // backend offers a previously stored ticket for this server during the
+  // handshake and persists fresh tickets it receives. Without a store every
+  // Open() performs a full handshake. The store must outlive the Session.
+  constexpr SessionOptions& set_session_ticket_store(
+      SessionTicketStore& store) {
+    ticket_store_ = &store;
+    return *this;
+  }
+
+  constexpr SessionTicketStore* session_ticket_store() const {
+    return ticket_store_;
+  }
+
  private:
   std::string_view server_name_;
   pw::stream::ReaderWriter* transport_ = nullptr;
+  SessionTicketStore* ticket_store_ = nullptr;
 
   // TODO(zyecheng): Expand the list as necessary to cover aspects such as
   // certificate verification/revocation check policies.
@@ -0,0 +1,53 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <string_view>
+
+#include "pw_bytes/span.h"
+#include "pw_status/status.h"
+#include "pw_status/status_with_size.h"
+
+namespace pw::tls_client {
+
+// Pluggable persistence for TLS session tickets, enabling session resumption
+// across connections and reboots. A full handshake per reconnect costs
+// seconds and kilobytes of traffic on devices that reconnect after every
+// sleep cycle; with a stored ticket the backend performs an abbreviated
+// handshake instead.
+//
+// Backends serialize their library's session state (e.g. the mbedtls
+// mbedtls_ssl_session save format or a BoringSSL SSL_SESSION) and hand it to
+// the store keyed by server name; on the next Session::Open for the same
+// server they load and offer it for resumption. Tickets are opaque to the
+// store. Implementations decide retention (RAM, pw_kvs, file) and must
+// tolerate Load returning NOT_FOUND after data loss.
+class SessionTicketStore {
+ public:
+  virtual ~SessionTicketStore() = default;
+
+  // Loads the ticket for `server_name` into `out`. Returns the ticket size,
+  // NOT_FOUND if none is stored, or RESOURCE_EXHAUSTED if `out` is too
+  // small.
+  virtual StatusWithSize Load(std::string_view server_name, ByteSpan out) = 0;
+
+  // Stores (replacing) the ticket for `server_name`.
+  virtual Status Store(std::string_view server_name,
+                       ConstByteSpan ticket) = 0;
+
+  // Removes the ticket, e.g. after the server rejects resumption.
+  virtual Status Invalidate(std::string_view server_name) = 0;
+};
+
+}  // namespace pw::tls_client
@@ -40,6 +40,26 @@ TEST(CsvParser, ReadFile) {
   EXPECT_EQ(result[2][2], "4");
 }
 
+TEST(CsvTokenIndex, FindsLinesByToken) {
+  constexpr std::string_view kCsv =
+      "0000000a,2024-01-01,,\"Hello, world\"\n"
+      "000000ff,,,Second\n"
+      "0000000a,,,Duplicate\n";
+  pw::tokenizer::CsvTokenIndex index(kCsv);
+  EXPECT_EQ(index.size(), 3u);
+
+  auto matches = index.Find(0xA);
+  ASSERT_EQ(matches.size(), 2u);
+  EXPECT_EQ(matches[0][3], "Hello, world");
+  EXPECT_EQ(matches[1][3], "Duplicate");
+
+  matches = index.Find(0xFF);
+  ASSERT_EQ(matches.size(), 1u);
+  EXPECT_EQ(matches[0][3], "Second");
+
+  EXPECT_TRUE(index.Find(0x1234).empty());
+}
+
 TEST(CsvParser, EmptyLines) {
   static constexpr const char kCsv[] = "\n\n\r\n\r\n";
   const auto result = ParseCsv(kCsv);
@@ -210,6 +210,19 @@ Detokenizer::Detokenizer(const TokenDatabase& database) {
   }
 }
 
+void Detokenizer::AddDatabase(const TokenDatabase& database) {
+  AddDatabase(kDefaultDomain, database);
+}
+
+void Detokenizer::AddDatabase(std::string_view domain,
+                              const TokenDatabase& database) {
+  auto& domain_entries = database_[std::string(domain)];
+  for (const auto& entry : database) {
+    domain_entries[entry.token].emplace_back(entry.string,
+                                             entry.date_removed);
+  }
+}
+
 Result<Detokenizer> Detokenizer::FromElfSection(
     span<const std::byte> elf_section) {
   size_t index = 0;
@@ -379,6 +392,35 @@ DetokenizedString Detokenizer::DetokenizeBase64Message(
   return Detokenize(buffer);
 }
 
+Status Detokenizer::DetokenizeTextBatch(span<const std::string_view> messages,
+                                        allocator::Allocator& allocator,
+                                        span<std::string_view> out_views,
+                                        const unsigned max_passes) const {
+  if (out_views.size() < messages.size()) {
+    return Status::InvalidArgument();
+  }
+
+  Status status = OkStatus();
+  for (size_t i = 0; i < messages.size(); ++i) {
+    const std::string result = DetokenizeText(messages[i], max_passes);
+    if (result.empty()) {
+      out_views[i] = std::string_view();
+      continue;
+    }
+
+    char* storage = static_cast<char*>(
+        allocator.Allocate(allocator::Layout(result.size(), 1)));
+    if (storage == nullptr) {
+      out_views[i] = std::string_view();
+      status = Status::ResourceExhausted();
+      continue;
+    }
+    std::memcpy(storage, result.data(), result.size());
+    out_views[i] = std::string_view(storage, result.size());
+  }
+  return status;
+}
+
 std::string Detokenizer::DetokenizeText(std::string_view text,
                                         const unsigned max_passes) const {
   NestedMessageDetokenizer detokenizer(*this);
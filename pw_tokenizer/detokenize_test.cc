@@ -19,6 +19,7 @@
 
 #include "pw_stream/memory_stream.h"
 #include "pw_tokenizer/example_binary_with_tokenized_strings.h"
+#include "pw_allocator/testing.h"
 #include "pw_unit_test/framework.h"
 
 namespace pw::tokenizer {
@@ -92,6 +93,37 @@ class Detokenize : public ::testing::Test {
   Detokenizer detok_;
 };
 
+TEST_F(Detokenize, HotSwapPublishesNewDatabaseAtomically) {
+  HotSwappableDetokenizer shared;
+
+  // The initial (empty) database cannot detokenize anything.
+  std::shared_ptr<const Detokenizer> before = shared.snapshot();
+  EXPECT_EQ(before->Detokenize("\1\0\0\0"sv).BestString(), "");
+
+  shared.Replace(Detokenizer(TokenDatabase::Create<kTestDatabase>()));
+
+  // The pre-swap snapshot is immutable and still usable; new snapshots see
+  // the new database.
+  EXPECT_EQ(before->Detokenize("\1\0\0\0"sv).BestString(), "");
+  EXPECT_EQ(shared.snapshot()->Detokenize("\1\0\0\0"sv).BestString(), "One");
+}
+
+TEST_F(Detokenize, HotSwapOldSnapshotFreesWhenDrained) {
+  HotSwappableDetokenizer shared(
+      Detokenizer(TokenDatabase::Create<kTestDatabase>()));
+  std::shared_ptr<const Detokenizer> batch = shared.snapshot();
+  std::weak_ptr<const Detokenizer> old_database = batch;
+
+  shared.Replace(Detokenizer(TokenDatabase::Create<kTestDatabase>()));
+  // The in-flight batch keeps the old database alive...
+  EXPECT_FALSE(old_database.expired());
+  EXPECT_EQ(batch->Detokenize("\5\0\0\0"sv).BestString(), "TWO");
+
+  // ...and it frees once the batch drains.
+  batch.reset();
+  EXPECT_TRUE(old_database.expired());
+}
+
 TEST_F(Detokenize, NoFormatting) {
   EXPECT_EQ(detok_.Detokenize("\1\0\0\0"sv).BestString(), "One");
   EXPECT_EQ(detok_.Detokenize("\5\0\0\0"sv).BestString(), "TWO");
@@ -148,6 +180,37 @@ TEST_F(Detokenize, FromElfFile) {
             "Jello, world!");
 }
 
+TEST_F(Detokenize, AddDatabase_ExtendsExistingDetokenizer) {
+  // A second database with one new token (0x1000) and the same entry layout.
+  static constexpr char kExtraData[] =
+      "TOKENS\0\0\x01\0\0\0\0\0\0\0"
+      "\x00\x10\x00\x00\xff\xff\xff\xff"
+      "Extra!\0";
+  constexpr TokenDatabase kExtra = TokenDatabase::Create<kExtraData>();
+
+  // Before merging, the new token is unknown but existing tokens work.
+  EXPECT_EQ(detok_.Detokenize("\x00\x10\x00\x00"sv).BestString(), "");
+  EXPECT_EQ(detok_.Detokenize("\x01\0\0\0"sv).BestString(), "One");
+
+  detok_.AddDatabase(kExtra);
+  EXPECT_EQ(detok_.Detokenize("\x00\x10\x00\x00"sv).BestString(), "Extra!");
+  EXPECT_EQ(detok_.Detokenize("\x01\0\0\0"sv).BestString(), "One");
+}
+
+TEST_F(Detokenize, AddDatabase_ByDomain) {
+  static constexpr char kExtraData[] =
+      "TOKENS\0\0\x01\0\0\0\0\0\0\0"
+      "\x00\x20\x00\x00\xff\xff\xff\xff"
+      "Sharded\0";
+  constexpr TokenDatabase kExtra = TokenDatabase::Create<kExtraData>();
+
+  detok_.AddDatabase("shard", kExtra);
+  // The entry is registered under its domain, not the default domain.
+  EXPECT_EQ(detok_.Detokenize("\x00\x20\x00\x00"sv).BestString(), "");
+  EXPECT_EQ(detok_.database().count("shard"), 1u);
+  EXPECT_EQ(detok_.database().at("shard").count(0x2000u), 1u);
+}
+
 TEST_F(Detokenize, FromCsvFile_DefaultDomain) {
   pw::Result<Detokenizer> detok_csv = Detokenizer::FromCsv(kCsvDefaultDomain);
   PW_TEST_ASSERT_OK(detok_csv);
@@ -271,6 +334,38 @@ TEST_F(Detokenize, Base64_NoArguments) {
   }
 }
 
+TEST_F(Detokenize, DetokenizeTextBatch) {
+  allocator::test::AllocatorForTest<1024> arena;
+
+  constexpr std::array<std::string_view, 4> kMessages = {
+      ONE, "123" FOUR ", 56", NEST_ONE NEST_ONE, "plain text"};
+  std::array<std::string_view, 4> views;
+
+  ASSERT_EQ(OkStatus(), detok_.DetokenizeTextBatch(kMessages, arena, views));
+  EXPECT_EQ(views[0], "One");
+  EXPECT_EQ(views[1], "123FOUR, 56");
+  EXPECT_EQ(views[2], "OneOne");
+  EXPECT_EQ(views[3], "plain text");
+}
+
+TEST_F(Detokenize, DetokenizeTextBatch_UndersizedOutput) {
+  allocator::test::AllocatorForTest<256> arena;
+  constexpr std::array<std::string_view, 2> kMessages = {ONE, TWO};
+  std::array<std::string_view, 1> views;
+  EXPECT_EQ(Status::InvalidArgument(),
+            detok_.DetokenizeTextBatch(kMessages, arena, views));
+}
+
+TEST_F(Detokenize, DetokenizeTextBatch_AllocatorExhausted) {
+  allocator::test::AllocatorForTest<32> arena;
+  const std::string long_message(100, 'x');
+  const std::array<std::string_view, 1> messages = {long_message};
+  std::array<std::string_view, 1> views;
+  EXPECT_EQ(Status::ResourceExhausted(),
+            detok_.DetokenizeTextBatch(messages, arena, views));
+  EXPECT_TRUE(views[0].empty());
+}
+
 TEST_F(Detokenize, OptionallyTokenizedData) {
   for (auto [data, expected] : TestCases(
            Case{ONE, "One"},
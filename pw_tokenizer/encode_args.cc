@@ -36,11 +36,47 @@ enum class ArgType : uint8_t {
 };
 
 size_t EncodeInt(int value, const span<std::byte>& output) {
+  // Straight-line fast path for small values, which are the overwhelming
+  // majority of logged integers: after zig-zag encoding they fit in one or
+  // two varint bytes.
+  const uint32_t zigzag = pw_varint_ZigZagEncode32(value);
+  if (zigzag < 0x80u) {
+    if (output.empty()) {
+      return 0;
+    }
+    output[0] = static_cast<std::byte>(zigzag);
+    return 1;
+  }
+  if (zigzag < 0x4000u) {
+    if (output.size() < 2) {
+      return 0;
+    }
+    output[0] = static_cast<std::byte>(zigzag | 0x80u);
+    output[1] = static_cast<std::byte>(zigzag >> 7);
+    return 2;
+  }
   // Use the 64-bit function to avoid instantiating both 32-bit and 64-bit.
   return pw_tokenizer_EncodeInt64(value, output.data(), output.size());
 }
 
 size_t EncodeInt64(int64_t value, const span<std::byte>& output) {
+  // Same one- and two-byte fast path as EncodeInt.
+  const uint64_t zigzag = pw_varint_ZigZagEncode64(value);
+  if (zigzag < 0x80u) {
+    if (output.empty()) {
+      return 0;
+    }
+    output[0] = static_cast<std::byte>(zigzag);
+    return 1;
+  }
+  if (zigzag < 0x4000u) {
+    if (output.size() < 2) {
+      return 0;
+    }
+    output[0] = static_cast<std::byte>(zigzag | 0x80u);
+    output[1] = static_cast<std::byte>(zigzag >> 7);
+    return 2;
+  }
   return pw_tokenizer_EncodeInt64(value, output.data(), output.size());
 }
 
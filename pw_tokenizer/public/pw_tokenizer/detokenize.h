@@ -24,13 +24,16 @@
 //
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "pw_allocator/allocator.h"
 #include "pw_result/result.h"
 #include "pw_span/span.h"
 #include "pw_stream/stream.h"
@@ -153,6 +156,22 @@ class Detokenizer {
   std::string DetokenizeText(std::string_view text,
                              unsigned max_passes = 3) const;
 
+  /// Detokenizes a batch of text messages, copying each result into storage
+  /// allocated from `allocator` and writing one view per message to
+  /// `out_views`, which must have at least `messages.size()` entries. The
+  /// views remain valid until their storage is reclaimed from the allocator;
+  /// with an arena-style allocator, a whole burst of messages can be
+  /// detokenized and released together without per-message heap churn.
+  ///
+  /// Messages that fail to decode are copied as-is, matching
+  /// `DetokenizeText`. If an allocation fails, the corresponding view is
+  /// empty and `RESOURCE_EXHAUSTED` is returned after processing the
+  /// remaining messages.
+  Status DetokenizeTextBatch(span<const std::string_view> messages,
+                             allocator::Allocator& allocator,
+                             span<std::string_view> out_views,
+                             unsigned max_passes = 3) const;
+
   /// Deprecated version of `DetokenizeText` with no recursive detokenization.
   /// @deprecated Call `DetokenizeText` instead.
   [[deprecated("Use DetokenizeText() instead")]] std::string DetokenizeBase64(
@@ -176,6 +195,21 @@ class Detokenizer {
   std::string DecodeOptionallyTokenizedData(
       const span<const std::byte>& optionally_tokenized_data);
 
+  /// Adds all entries from another token database to this detokenizer, for
+  /// incrementally extending a running host detokenizer when new binaries
+  /// (and their tokens) appear, without rebuilding it and losing in-flight
+  /// state. Entries are merged into the default domain; duplicate tokens
+  /// accumulate as additional candidate strings, matching construction
+  /// behavior.
+  void AddDatabase(const TokenDatabase& database);
+
+  /// Adds entries from a token database under a specific domain, enabling
+  /// domain-sharded deployments: keep one database per domain (e.g. per
+  /// image, core, or subsystem) and load each into a running detokenizer
+  /// only when messages for that domain first appear, rather than loading
+  /// one monolithic database up front.
+  void AddDatabase(std::string_view domain, const TokenDatabase& database);
+
   const DomainTokenEntriesMap& database() const { return database_; }
 
  private:
@@ -184,4 +218,40 @@ class Detokenizer {
 
 /// @}
 
+/// Shares one `Detokenizer` between many consumers with atomic hot swap, for
+/// long-lived multi-client hosts (e.g. a gateway detokenizing logs from
+/// hundreds of device connections) where database updates must not require a
+/// restart.
+///
+/// Consumers call `snapshot()` once per message batch and detokenize through
+/// the returned shared pointer: one atomic load per batch, no further
+/// synchronization. `Replace` atomically publishes a new database; in-flight
+/// batches keep their snapshot until they drop it, so old databases free
+/// when the last batch using them drains.
+class HotSwappableDetokenizer {
+ public:
+  /// Starts with an empty database; all tokens are unknown until `Replace`.
+  HotSwappableDetokenizer()
+      : current_(std::make_shared<const Detokenizer>(TokenDatabase())) {}
+
+  explicit HotSwappableDetokenizer(Detokenizer&& initial)
+      : current_(std::make_shared<const Detokenizer>(std::move(initial))) {}
+
+  /// Returns an immutable snapshot of the current database. Safe to call
+  /// concurrently with `Replace` from any thread.
+  std::shared_ptr<const Detokenizer> snapshot() const {
+    return current_.load(std::memory_order_acquire);
+  }
+
+  /// Atomically publishes `replacement`. Existing snapshots are unaffected
+  /// and release the previous database when the last one drops.
+  void Replace(Detokenizer&& replacement) {
+    current_.store(std::make_shared<const Detokenizer>(std::move(replacement)),
+                   std::memory_order_release);
+  }
+
+ private:
+  std::atomic<std::shared_ptr<const Detokenizer>> current_;
+};
+
 }  // namespace pw::tokenizer
@@ -18,6 +18,8 @@
 #include <cstdint>
 #include <iterator>
 
+#include "pw_span/span.h"
+
 namespace pw::tokenizer {
 
 /// Reads entries from a v0 binary token string database. This class does not
@@ -263,6 +265,19 @@ class TokenDatabase {
   /// Returns all entries associated with this token. This is `O(n)`.
   Entries Find(uint32_t token) const;
 
+  /// Returns all entries associated with this token using a binary search
+  /// over the sorted token array and a string-offset index built with
+  /// `BuildStringOffsetIndex()`. This is `O(log n)` and avoids walking the
+  /// string table. If the index is smaller than `size()`, falls back to the
+  /// linear `Find()`.
+  Entries Find(uint32_t token, span<const uint32_t> string_offset_index) const;
+
+  /// Populates an index of string-table offsets for use with the indexed
+  /// `Find()` overload. `string_offset_index` must have at least `size()`
+  /// entries. This walks the database once; call it at startup and reuse the
+  /// index for all lookups. Returns the number of offsets written.
+  size_type BuildStringOffsetIndex(span<uint32_t> string_offset_index) const;
+
   /// Returns the total number of entries (unique token-string pairs).
   constexpr size_type size() const {
     return (end_.data - begin_.data) / sizeof(RawEntry);
@@ -13,7 +13,10 @@
 // the License.
 #pragma once
 
+#include <algorithm>
+#include <cstdlib>
 #include <optional>
+#include <string_view>
 #include <string>
 #include <vector>
 
@@ -81,4 +84,71 @@ void ParseCsv(std::string_view csv, Function handle_line) {
   return result;
 }
 
+
+/// Index over a CSV token database for random access to individual tokens
+/// without reparsing the whole file per lookup. The file is parsed once at
+/// construction to record each line's token and byte offset; `Find` then
+/// reparses only the matching lines. The CSV contents must outlive the
+/// index (e.g. a memory-mapped database file).
+class CsvTokenIndex {
+ public:
+  explicit CsvTokenIndex(std::string_view csv) : csv_(csv) {
+    internal::CsvParser parser;
+    size_t line_start = 0;
+    for (size_t i = 0; i < csv.size(); ++i) {
+      if (auto line = parser.ParseCharacter(csv[i]); line.has_value()) {
+        RecordLine(*line, line_start, i + 1);
+        line_start = i + 1;
+      }
+    }
+    if (auto line = parser.Flush(); line.has_value()) {
+      RecordLine(*line, line_start, csv.size());
+    }
+    std::sort(index_.begin(), index_.end(), [](const Entry& a, const Entry& b) {
+      return a.token < b.token;
+    });
+  }
+
+  /// Returns the parsed fields of every line with the provided token.
+  std::vector<std::vector<std::string>> Find(uint32_t token) const {
+    std::vector<std::vector<std::string>> lines;
+    auto it = std::lower_bound(
+        index_.begin(), index_.end(), token, [](const Entry& e, uint32_t t) {
+          return e.token < t;
+        });
+    for (; it != index_.end() && it->token == token; ++it) {
+      ParseCsv(csv_.substr(it->offset, it->size),
+               [&lines](std::vector<std::string>&& fields) {
+                 lines.push_back(std::move(fields));
+               });
+    }
+    return lines;
+  }
+
+  /// The number of indexed lines.
+  size_t size() const { return index_.size(); }
+
+ private:
+  struct Entry {
+    uint32_t token;
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  void RecordLine(const std::vector<std::string>& fields,
+                  size_t start,
+                  size_t end) {
+    if (fields.empty()) {
+      return;
+    }
+    const unsigned long token = std::strtoul(fields[0].c_str(), nullptr, 16);
+    index_.push_back(Entry{static_cast<uint32_t>(token),
+                           static_cast<uint32_t>(start),
+                           static_cast<uint32_t>(end - start)});
+  }
+
+  std::string_view csv_;
+  std::vector<Entry> index_;
+};
+
 }  // namespace pw::tokenizer
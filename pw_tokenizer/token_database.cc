@@ -38,4 +38,55 @@ TokenDatabase::Entries TokenDatabase::Find(const uint32_t token) const {
   return Entries(first, last);
 }
 
+TokenDatabase::Entries TokenDatabase::Find(
+    uint32_t token, span<const uint32_t> string_offset_index) const {
+  const size_type entry_count = size();
+  if (string_offset_index.size() < entry_count) {
+    return Find(token);
+  }
+
+  const auto token_at = [this](size_type index) {
+    return ReadUint32(begin_.data + index * sizeof(RawEntry));
+  };
+
+  // Binary search for the first entry with a token >= the search token.
+  size_type low = 0;
+  size_type high = entry_count;
+  while (low < high) {
+    const size_type mid = low + (high - low) / 2;
+    if (token_at(mid) < token) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  size_type last = low;
+  while (last < entry_count && token_at(last) == token) {
+    ++last;
+  }
+
+  const auto make_iterator = [this, &string_offset_index,
+                              entry_count](size_type index) {
+    if (index == entry_count) {
+      return end();
+    }
+    return iterator(begin_.data + index * sizeof(RawEntry),
+                    end_.data + string_offset_index[index]);
+  };
+
+  return Entries(make_iterator(low), make_iterator(last));
+}
+
+TokenDatabase::size_type TokenDatabase::BuildStringOffsetIndex(
+    span<uint32_t> string_offset_index) const {
+  size_type count = 0;
+  for (iterator it = begin(); it != end() && count < string_offset_index.size();
+       ++it) {
+    string_offset_index[count++] =
+        static_cast<uint32_t>(it->string - end_.data);
+  }
+  return count;
+}
+
 }  // namespace pw::tokenizer
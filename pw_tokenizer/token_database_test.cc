@@ -127,6 +127,33 @@ TEST(TokenDatabase, ValidCheck) {
                              "hi\0hello\0"sv));
 }
 
+TEST(TokenDatabase, IndexedFind_MatchesLinearFind) {
+  std::array<uint32_t, 3> index = {};
+  ASSERT_EQ(kBasicDatabase.BuildStringOffsetIndex(index),
+            kBasicDatabase.size());
+
+  for (uint32_t token : {0u, 1u, 2u, 3u, 0xFEu, 0xFFu, 0x100u, 0xFFFFFFFFu}) {
+    TokenDatabase::Entries linear = kBasicDatabase.Find(token);
+    TokenDatabase::Entries indexed = kBasicDatabase.Find(token, index);
+    ASSERT_EQ(linear.size(), indexed.size());
+    auto linear_it = linear.begin();
+    for (const auto& entry : indexed) {
+      EXPECT_EQ(entry.token, linear_it->token);
+      EXPECT_STREQ(entry.string, linear_it->string);
+      ++linear_it;
+    }
+  }
+}
+
+TEST(TokenDatabase, IndexedFind_UndersizedIndexFallsBack) {
+  std::array<uint32_t, 1> too_small = {};
+  kBasicDatabase.BuildStringOffsetIndex(too_small);
+
+  TokenDatabase::Entries entries = kBasicDatabase.Find(0xFFu, too_small);
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_STREQ(entries.begin()->string, ":)");
+}
+
 TEST(TokenDatabase, Iterator) {
   auto it = kBasicDatabase.begin();
   EXPECT_EQ(it->token, 1u);
@@ -73,4 +73,26 @@ Status BaseTraceService::Stop() {
   return OkStatus();
 }
 
+Status BaseTraceService::Flush() {
+  auto ring_buffer = trace::GetBuffer();
+
+  std::byte chunk[128];
+  while (ring_buffer->EntryCount() > 0) {
+    size_t entries_popped = 0;
+    const StatusWithSize popped =
+        ring_buffer->PopEntries(chunk, entries_popped);
+    if (!popped.ok()) {
+      // RESOURCE_EXHAUSTED means the next entry exceeds the chunk buffer;
+      // anything else is unexpected here.
+      return popped.status();
+    }
+    if (Status status = trace_writer_.Write(span(chunk).first(popped.size()));
+        !status.ok()) {
+      PW_LOG_ERROR("Failed to write trace data: %d", status.code());
+      return status;
+    }
+  }
+  return OkStatus();
+}
+
 }  // namespace pw::trace
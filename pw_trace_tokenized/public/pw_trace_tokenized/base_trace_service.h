@@ -32,6 +32,15 @@ class BaseTraceService {
   Status Start();
   Status Stop();
 
+  /// Streams the currently buffered trace entries to the writer without
+  /// stopping tracing, enabling continuous capture: drive this periodically
+  /// (e.g. from a work queue) to drain the ring before it wraps, instead of
+  /// tracing until Stop and transferring one snapshot. Entries are drained in
+  /// bulk with their prefixes intact, so the output matches the raw-buffer
+  /// format the host decoder already consumes. Call from a context that does
+  /// not preempt trace-event production into the ring.
+  Status Flush();
+
  private:
   TokenizedTracer& tokenized_tracer_;
   stream::Writer& trace_writer_;
@@ -0,0 +1,51 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_trace_tokenized/sample_profiler.h
+///
+/// Always-on sampling profiler built on the tokenized trace stream. A
+/// platform drives `PW_TRACE_PROFILER_SAMPLE()` from a periodic interrupt
+/// (e.g. SysTick), passing the interrupted program counter and optionally the
+/// active thread; each sample becomes one compact tokenized trace event,
+/// timestamped by the trace time source and decoded offline into a
+/// statistical profile. The cost per sample is one trace event (a token plus
+/// varint-encoded data), so sampling can stay enabled in production.
+
+#include <stdint.h>
+
+#include "pw_trace/trace.h"
+
+/// Records one profiling sample. Call from a periodic sampling interrupt with
+/// the interrupted context's program counter.
+#define PW_TRACE_PROFILER_SAMPLE(program_counter)                      \
+  do {                                                                 \
+    uintptr_t _pw_trace_profiler_pc = (program_counter);               \
+    PW_TRACE_INSTANT_DATA("profile_sample",                            \
+                          "@pw_py_map_of_pc",                          \
+                          &_pw_trace_profiler_pc,                      \
+                          sizeof(_pw_trace_profiler_pc));              \
+  } while (0)
+
+/// Records one profiling sample attributed to a thread, for per-thread
+/// profiles. `thread_id` groups the samples when decoding.
+#define PW_TRACE_PROFILER_SAMPLE_THREAD(program_counter, thread_id)    \
+  do {                                                                 \
+    uintptr_t _pw_trace_profiler_data[2] = {(program_counter),         \
+                                            (uintptr_t)(thread_id)};   \
+    PW_TRACE_INSTANT_DATA("profile_sample_thread",                     \
+                          "@pw_py_map_of_pc_and_thread",               \
+                          _pw_trace_profiler_data,                     \
+                          sizeof(_pw_trace_profiler_data));            \
+  } while (0)
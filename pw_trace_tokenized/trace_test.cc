@@ -16,6 +16,7 @@
 #define PW_TRACE_MODULE_NAME "TST"
 
 #include "pw_trace/trace.h"
+#include "pw_trace_tokenized/sample_profiler.h"
 #include "pw_trace_tokenized/trace_tokenized.h"
 #include "pw_trace_tokenized/trace_callback.h"
 // clang-format on
@@ -269,6 +270,24 @@ TEST(TokenizedTrace, Instant) {
   EXPECT_TRUE(test_interface.GetEvents().empty());
 }
 
+TEST(TokenizedTrace, ProfilerSample) {
+  TraceTestInterface test_interface;
+
+  PW_TRACE_PROFILER_SAMPLE(reinterpret_cast<uintptr_t>(&test_interface));
+  PW_TRACE_PROFILER_SAMPLE_THREAD(reinterpret_cast<uintptr_t>(&test_interface),
+                                  7);
+
+  EXPECT_TRACE_DATA(test_interface,
+                    PW_TRACE_TYPE_INSTANT,
+                    "profile_sample",
+                    "@pw_py_map_of_pc");
+  EXPECT_TRACE_DATA(test_interface,
+                    PW_TRACE_TYPE_INSTANT,
+                    "profile_sample_thread",
+                    "@pw_py_map_of_pc_and_thread");
+  EXPECT_TRUE(test_interface.GetEvents().empty());
+}
+
 TEST(TokenizedTrace, Duration) {
   TraceTestInterface test_interface;
 
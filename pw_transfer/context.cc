@@ -211,6 +211,23 @@ void Context::UpdateTransferParameters(TransmitAction action) {
         break;
 
       case TransmitAction::kExtend:
+#if PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+        {
+          // Only grow the window while doing so still improves the measured
+          // rate. If the rate has plateaued, the link is saturated and a
+          // larger window would only add queueing and hurt loss recovery.
+          const size_t window_rate = window_rate_.GetRateBytesPerSecond();
+          window_rate_.Reset();
+          if (last_window_rate_bytes_per_second_ != 0 && window_rate != 0 &&
+              window_rate < last_window_rate_bytes_per_second_ +
+                                last_window_rate_bytes_per_second_ / 10) {
+            last_window_rate_bytes_per_second_ = window_rate;
+            break;
+          }
+          last_window_rate_bytes_per_second_ = window_rate;
+        }
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+
         // Window was received successfully without packet loss and should grow.
         // Double the window size during slow start, or increase it by a single
         // chunk in congestion avoidance.
@@ -406,6 +423,10 @@ void Context::Initialize(const NewTransferEvent& new_transfer) {
   log_chunks_before_rate_limit_ = log_chunks_before_rate_limit_cfg_;
 
   transfer_rate_.Reset();
+#if PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+  window_rate_.Reset();
+  last_window_rate_bytes_per_second_ = 0;
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
 }
 
 void Context::HandleChunkEvent(const ChunkEvent& event) {
@@ -861,6 +882,18 @@ void Context::HandleReceiveChunk(const Chunk& chunk) {
                        static_cast<unsigned>(session_id_),
                        static_cast<unsigned>(offset_),
                        static_cast<unsigned>(chunk.offset()));
+        } else {
+          // Not a retry: this is the in-flight tail of the previous window
+          // arriving out of order behind the lost chunk. Drop it quietly --
+          // the retransmit request is already out, and resending parameters
+          // per stale chunk would flood the link and shrink the window once
+          // per chunk.
+          PW_LOG_DEBUG(
+              "Transfer %u ignoring out-of-order chunk with offset %u during "
+              "recovery (expected %u)",
+              static_cast<unsigned>(session_id_),
+              static_cast<unsigned>(chunk.offset()),
+              static_cast<unsigned>(offset_));
         }
 
         last_chunk_offset_ = chunk.offset();
@@ -961,6 +994,9 @@ void Context::HandleReceivedData(const Chunk& chunk) {
     }
 
     transfer_rate_.Update(chunk.payload().size());
+#if PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+    window_rate_.Update(chunk.payload().size());
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
   }
 
   // Update the transfer state.
@@ -38,6 +38,15 @@
 #define PW_TRANSFER_CONFIG_DEBUG_DATA_CHUNKS 0
 #endif  // PW_TRANSFER_CONFIG_DEBUG_DATA_CHUNKS
 
+// Enables rate-based window auto-tuning. When enabled, the receive window
+// stops growing once growing it no longer improves the rate measured over the
+// previous window by at least 10%, avoiding queue buildup on links whose
+// usable bandwidth is reached before packet loss occurs. The window still
+// shrinks on loss as usual.
+#ifndef PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+#define PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW 0
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+
 #ifdef PW_TRANSFER_DEFAULT_MAX_RETRIES
 #pragma message(                                      \
     "PW_TRANSFER_DEFAULT_MAX_RETRIES is deprecated; " \
@@ -58,6 +67,15 @@
 #ifndef PW_TRANSFER_DEFAULT_MAX_CLIENT_RETRIES
 
 // Continue to accept the old deprecated setting until projects have migrated.
+// Enables rate-based window auto-tuning. When enabled, the receive window
+// stops growing once growing it no longer improves the rate measured over the
+// previous window by at least 10%, avoiding queue buildup on links whose
+// usable bandwidth is reached before packet loss occurs. The window still
+// shrinks on loss as usual.
+#ifndef PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+#define PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW 0
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+
 #ifdef PW_TRANSFER_DEFAULT_MAX_RETRIES
 #define PW_TRANSFER_DEFAULT_MAX_CLIENT_RETRIES PW_TRANSFER_DEFAULT_MAX_RETRIES
 #else
@@ -78,6 +96,15 @@ static_assert(PW_TRANSFER_DEFAULT_MAX_CLIENT_RETRIES >= 0 &&
 #ifndef PW_TRANSFER_DEFAULT_MAX_SERVER_RETRIES
 
 // Continue to accept the old deprecated setting until projects have migrated.
+// Enables rate-based window auto-tuning. When enabled, the receive window
+// stops growing once growing it no longer improves the rate measured over the
+// previous window by at least 10%, avoiding queue buildup on links whose
+// usable bandwidth is reached before packet loss occurs. The window still
+// shrinks on loss as usual.
+#ifndef PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+#define PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW 0
+#endif  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW
+
 #ifdef PW_TRANSFER_DEFAULT_MAX_RETRIES
 #define PW_TRANSFER_DEFAULT_MAX_SERVER_RETRIES PW_TRANSFER_DEFAULT_MAX_RETRIES
 #else
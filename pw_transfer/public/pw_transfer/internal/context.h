@@ -449,6 +449,12 @@ class Context {
   uint16_t log_chunks_before_rate_limit_;
 
   RateEstimate transfer_rate_;
+
+  // Rate measured over the most recent receive window, used by
+  // PW_TRANSFER_CONFIG_ADAPTIVE_WINDOW to decide whether growing the window
+  // is still improving throughput.
+  RateEstimate window_rate_;
+  size_t last_window_rate_bytes_per_second_ = 0;
 };
 
 }  // namespace pw::transfer::internal
@@ -422,6 +422,11 @@ class TransferThread : public thread::ThreadCore {
   span<ClientContext> client_transfers_;
   span<ServerContext> server_transfers_;
 
+  // Rotating start offset for the timeout scan, so that simultaneously ready
+  // transfers take turns sending first instead of always being serviced in
+  // context-array order.
+  size_t timeout_scan_offset_ = 0;
+
   // Identifier to use for the next started transfer, unique over the RPC
   // channel between the transfer client and server.
   //
@@ -1378,6 +1378,55 @@ TEST_F(WriteTransfer, OnlySendParametersUpdateOnceAfterDrop) {
   EXPECT_EQ(handler_.finalize_write_status, OkStatus());
 }
 
+TEST_F(WriteTransfer, SingleLossCausesSingleParameterRetransmit) {
+  ctx_.SendClientStream(EncodeChunk(
+      Chunk(ProtocolVersion::kLegacy, Chunk::Type::kStart).set_session_id(7)));
+  transfer_thread_.WaitUntilEventIsProcessed();
+
+  ASSERT_EQ(ctx_.total_responses(), 1u);
+
+  constexpr span data(kData);
+
+  // Deliver offset 0, lose offset 8, then deliver the rest of the in-flight
+  // window out of order behind the loss.
+  ctx_.SendClientStream<64>(
+      EncodeChunk(Chunk(ProtocolVersion::kLegacy, Chunk::Type::kData)
+                      .set_session_id(7)
+                      .set_offset(0)
+                      .set_payload(data.first(8))));
+  transfer_thread_.WaitUntilEventIsProcessed();
+  ASSERT_EQ(ctx_.total_responses(), 1u);
+
+  for (uint32_t i = 9; i < kData.size(); ++i) {
+    ctx_.SendClientStream<64>(
+        EncodeChunk(Chunk(ProtocolVersion::kLegacy, Chunk::Type::kData)
+                        .set_session_id(7)
+                        .set_offset(i)
+                        .set_payload(data.subspan(i, 1))));
+    transfer_thread_.WaitUntilEventIsProcessed();
+
+    // The first out-of-order chunk triggers exactly one parameter
+    // retransmit; the rest of the stale tail is dropped quietly.
+    ASSERT_EQ(ctx_.total_responses(), 2u);
+  }
+
+  Chunk chunk = DecodeChunk(ctx_.responses().back());
+  EXPECT_EQ(chunk.session_id(), 7u);
+  EXPECT_EQ(chunk.offset(), 8u);
+
+  // Sending the expected offset resumes the transfer to completion.
+  ctx_.SendClientStream<64>(
+      EncodeChunk(Chunk(ProtocolVersion::kLegacy, Chunk::Type::kData)
+                      .set_session_id(7)
+                      .set_offset(8)
+                      .set_payload(data.subspan(8))
+                      .set_remaining_bytes(0)));
+  transfer_thread_.WaitUntilEventIsProcessed();
+
+  EXPECT_TRUE(handler_.finalize_write_called);
+  EXPECT_EQ(handler_.finalize_write_status, OkStatus());
+}
+
 TEST_F(WriteTransfer, ResendParametersIfSentRepeatedChunkDuringRecovery) {
   ctx_.SendClientStream(EncodeChunk(
       Chunk(ProtocolVersion::kLegacy, Chunk::Type::kStart).set_session_id(7)));
@@ -68,15 +68,27 @@ void TransferThread::Run() {
     }
 
     // Regardless of whether an event was received or not, check for any
-    // transfers which have timed out and process them if so.
-    for (Context& context : client_transfers_) {
-      if (context.timed_out()) {
-        context.HandleEvent({.type = EventType::kClientTimeout});
-      }
-    }
-    for (Context& context : server_transfers_) {
-      if (context.timed_out()) {
-        context.HandleEvent({.type = EventType::kServerTimeout});
+    // transfers which have timed out and process them if so. The scan starts
+    // at a rotating offset so that when several transfers are ready to send
+    // at once (e.g. expired interchunk delays on a saturated link), they take
+    // turns going first rather than always being serviced in array order.
+    const size_t client_count = client_transfers_.size();
+    const size_t total_transfers = client_count + server_transfers_.size();
+    if (total_transfers > 0) {
+      const size_t start = timeout_scan_offset_++ % total_transfers;
+      for (size_t i = 0; i < total_transfers; ++i) {
+        const size_t index = (start + i) % total_transfers;
+        if (index < client_count) {
+          Context& context = client_transfers_[index];
+          if (context.timed_out()) {
+            context.HandleEvent({.type = EventType::kClientTimeout});
+          }
+        } else {
+          Context& context = server_transfers_[index - client_count];
+          if (context.timed_out()) {
+            context.HandleEvent({.type = EventType::kServerTimeout});
+          }
+        }
       }
     }
   }
@@ -21,6 +21,7 @@
 #include "pw_assert/assert.h"
 #include "pw_bytes/span.h"
 #include "pw_chrono/system_clock.h"
+#include "pw_result/result.h"
 #include "pw_status/status.h"
 #include "pw_status/status_with_size.h"
 #include "pw_uart/uart_base.h"
@@ -248,6 +249,38 @@ class Uart : public UartBase {
   /// @endrst
   Status FlushOutput() { return DoFlushOutput(); }
 
+  /// Borrows a driver-owned, DMA-capable transmit buffer to fill in place.
+  /// After writing up to `min_size` (or more, up to the returned span's size)
+  /// bytes into the span, call `CommitWrite()` with the number of bytes
+  /// actually written to queue them for transmission with no intermediate
+  /// copy. Only one write buffer may be outstanding at a time.
+  ///
+  /// Backends that cannot lend buffers return UNIMPLEMENTED; callers fall
+  /// back to `Write()`.
+  Result<ByteSpan> AcquireWriteBuffer(size_t min_size) {
+    return DoAcquireWriteBuffer(min_size);
+  }
+
+  /// Queues the first `bytes_written` bytes of the buffer returned by
+  /// `AcquireWriteBuffer()` for transmission and returns ownership of the
+  /// buffer to the driver. Pass 0 to abandon the buffer without sending.
+  Status CommitWrite(size_t bytes_written) {
+    return DoCommitWrite(bytes_written);
+  }
+
+  /// Borrows a span of already-received bytes owned by the driver (e.g. a
+  /// DMA ring segment), avoiding a copy into a caller buffer. Returns an
+  /// empty span if no data is available. Call `ReleaseReadBuffer()` with the
+  /// number of bytes consumed when done; unconsumed bytes are returned by the
+  /// next acquire.
+  Result<ConstByteSpan> AcquireReadBuffer() { return DoAcquireReadBuffer(); }
+
+  /// Returns a buffer borrowed with `AcquireReadBuffer()` to the driver,
+  /// consuming `bytes_consumed` bytes from the receive stream.
+  Status ReleaseReadBuffer(size_t bytes_consumed) {
+    return DoReleaseReadBuffer(bytes_consumed);
+  }
+
  private:
   /// Reads data from the UART into a provided buffer with an optional timeout
   /// provided.
@@ -352,6 +385,23 @@ class Uart : public UartBase {
       ConstByteSpan tx_buffer,
       std::optional<chrono::SystemClock::duration> timeout) = 0;
   virtual Status DoFlushOutput() = 0;
+
+  /// Optional zero-copy buffer-lending hooks; see the public wrappers above.
+  /// The default implementations report UNIMPLEMENTED so existing backends
+  /// are unaffected.
+  virtual Result<ByteSpan> DoAcquireWriteBuffer(size_t) {
+    return Status::Unimplemented();
+  }
+
+  virtual Status DoCommitWrite(size_t) { return Status::Unimplemented(); }
+
+  virtual Result<ConstByteSpan> DoAcquireReadBuffer() {
+    return Status::Unimplemented();
+  }
+
+  virtual Status DoReleaseReadBuffer(size_t) {
+    return Status::Unimplemented();
+  }
 };
 
 }  // namespace pw::uart
@@ -14,6 +14,8 @@
 
 #include "pw_uart/uart.h"
 
+#include <array>
+
 #include "pw_status/status.h"
 #include "pw_status/status_with_size.h"
 #include "pw_unit_test/framework.h"
@@ -48,11 +50,73 @@ class UartTest : public ::testing::Test {
  public:
   UartTest() : stub_() {}
 
- private:
+ protected:
   UartStub stub_;
 };
 
 TEST_F(UartTest, CompilationSucceeds) { EXPECT_TRUE(true); }
 
+TEST_F(UartTest, BufferLendingIsUnimplementedByDefault) {
+  EXPECT_EQ(stub_.AcquireWriteBuffer(16).status(), Status::Unimplemented());
+  EXPECT_EQ(stub_.CommitWrite(0), Status::Unimplemented());
+  EXPECT_EQ(stub_.AcquireReadBuffer().status(), Status::Unimplemented());
+  EXPECT_EQ(stub_.ReleaseReadBuffer(0), Status::Unimplemented());
+}
+
+// Uart backend that lends its internal buffers for zero-copy access.
+class LendingUart : public UartStub {
+ public:
+  std::array<std::byte, 8> tx_buffer = {};
+  std::array<std::byte, 4> rx_buffer = {std::byte{1}, std::byte{2},
+                                        std::byte{3}, std::byte{4}};
+  size_t committed = 0;
+  size_t consumed = 0;
+
+ private:
+  Result<ByteSpan> DoAcquireWriteBuffer(size_t min_size) override {
+    if (min_size > tx_buffer.size()) {
+      return Status::ResourceExhausted();
+    }
+    return ByteSpan(tx_buffer);
+  }
+
+  Status DoCommitWrite(size_t bytes_written) override {
+    committed = bytes_written;
+    return OkStatus();
+  }
+
+  Result<ConstByteSpan> DoAcquireReadBuffer() override {
+    return ConstByteSpan(rx_buffer).subspan(consumed);
+  }
+
+  Status DoReleaseReadBuffer(size_t bytes_consumed) override {
+    consumed += bytes_consumed;
+    return OkStatus();
+  }
+};
+
+TEST_F(UartTest, BufferLendingRoundTrip) {
+  LendingUart uart;
+
+  Result<ByteSpan> tx = uart.AcquireWriteBuffer(4);
+  ASSERT_EQ(tx.status(), OkStatus());
+  (*tx)[0] = std::byte{0xaa};
+  (*tx)[1] = std::byte{0xbb};
+  ASSERT_EQ(uart.CommitWrite(2), OkStatus());
+  EXPECT_EQ(uart.committed, 2u);
+  EXPECT_EQ(uart.tx_buffer[0], std::byte{0xaa});
+
+  Result<ConstByteSpan> rx = uart.AcquireReadBuffer();
+  ASSERT_EQ(rx.status(), OkStatus());
+  ASSERT_EQ(rx->size(), 4u);
+  EXPECT_EQ((*rx)[0], std::byte{1});
+  ASSERT_EQ(uart.ReleaseReadBuffer(2), OkStatus());
+
+  rx = uart.AcquireReadBuffer();
+  ASSERT_EQ(rx.status(), OkStatus());
+  ASSERT_EQ(rx->size(), 2u);
+  EXPECT_EQ((*rx)[0], std::byte{3});
+}
+
 }  // namespace
 }  // namespace pw::uart
@@ -0,0 +1,80 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_unit_test/allocation_profiling.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace pw::unit_test {
+namespace internal {
+namespace {
+
+std::atomic<uint64_t> allocation_count{0};
+std::atomic<uint64_t> deallocation_count{0};
+std::atomic<uint64_t> allocated_byte_count{0};
+
+}  // namespace
+
+void* CountedAllocate(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_byte_count.fetch_add(size, std::memory_order_relaxed);
+  void* ptr = std::malloc(size);
+  if (ptr == nullptr) {
+    std::abort();  // Allocation functions must not return null.
+  }
+  return ptr;
+}
+
+void CountedDeallocate(void* ptr) {
+  if (ptr != nullptr) {
+    deallocation_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  std::free(ptr);
+}
+
+}  // namespace internal
+
+AllocationStats GetAllocationStats() {
+  return AllocationStats{
+      .allocations =
+          internal::allocation_count.load(std::memory_order_relaxed),
+      .deallocations =
+          internal::deallocation_count.load(std::memory_order_relaxed),
+      .allocated_bytes =
+          internal::allocated_byte_count.load(std::memory_order_relaxed),
+  };
+}
+
+}  // namespace pw::unit_test
+
+// Counting replacements for the global allocation functions. Sized and
+// aligned variants funnel into the same counters.
+void* operator new(size_t size) { return pw::unit_test::internal::CountedAllocate(size); }
+void* operator new[](size_t size) {
+  return pw::unit_test::internal::CountedAllocate(size);
+}
+void operator delete(void* ptr) noexcept {
+  pw::unit_test::internal::CountedDeallocate(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  pw::unit_test::internal::CountedDeallocate(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept {
+  pw::unit_test::internal::CountedDeallocate(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept {
+  pw::unit_test::internal::CountedDeallocate(ptr);
+}
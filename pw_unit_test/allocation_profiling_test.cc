@@ -0,0 +1,48 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_unit_test/allocation_profiling.h"
+
+#include "pw_unit_test/framework.h"
+
+namespace pw::unit_test {
+namespace {
+
+TEST(AllocationProfiling, CountsAllocations) {
+  ScopedAllocationProfile profile;
+  EXPECT_EQ(profile.allocations(), 0u);
+
+  int* value = new int(42);
+  EXPECT_EQ(profile.allocations(), 1u);
+  EXPECT_GE(profile.allocated_bytes(), sizeof(int));
+  delete value;
+
+  char* array = new char[100];
+  EXPECT_EQ(profile.allocations(), 2u);
+  delete[] array;
+}
+
+TEST(AllocationProfiling, AllocationFreeRegionStaysAtZero) {
+  ScopedAllocationProfile profile;
+  int accumulator = 0;
+  for (int i = 0; i < 100; ++i) {
+    accumulator += i;  // No heap usage.
+  }
+  EXPECT_NE(accumulator, 0);
+  EXPECT_EQ(profile.allocations(), 0u);
+  EXPECT_EQ(profile.allocated_bytes(), 0u);
+}
+
+}  // namespace
+}  // namespace pw::unit_test
@@ -0,0 +1,65 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_unit_test/allocation_profiling.h
+///
+/// Heap allocation profiling for unit tests. Linking the
+/// `pw_unit_test.allocation_profiling` library into a test binary replaces
+/// the global `operator new`/`delete` with counting versions, so tests can
+/// assert that hot paths do not allocate and measure how much a code path
+/// allocates, catching allocation regressions in CI rather than on target.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pw::unit_test {
+
+/// Global allocation counters since process start.
+struct AllocationStats {
+  uint64_t allocations;
+  uint64_t deallocations;
+  uint64_t allocated_bytes;
+};
+
+/// Returns the current global allocation counters. Only meaningful when the
+/// `allocation_profiling` library is linked; otherwise all counters are zero.
+AllocationStats GetAllocationStats();
+
+/// Measures allocations within a scope:
+///
+/// @code{.cpp}
+///   ScopedAllocationProfile profile;
+///   RunHotPath();
+///   EXPECT_EQ(profile.allocations(), 0u);  // The hot path must not allocate.
+/// @endcode
+class ScopedAllocationProfile {
+ public:
+  ScopedAllocationProfile() : start_(GetAllocationStats()) {}
+
+  /// Allocations since construction.
+  uint64_t allocations() const {
+    return GetAllocationStats().allocations - start_.allocations;
+  }
+
+  /// Bytes allocated since construction.
+  uint64_t allocated_bytes() const {
+    return GetAllocationStats().allocated_bytes - start_.allocated_bytes;
+  }
+
+ private:
+  AllocationStats start_;
+};
+
+}  // namespace pw::unit_test
@@ -14,9 +14,29 @@
 
 #include "pw_varint/varint.h"
 
+// One- and two-byte fast paths, which cover the overwhelming majority of
+// varints (lengths, field keys, small counters), are emitted as straight-line
+// code with a single bounds check before entering the general loop.
+#define VARINT_ENCODE_SMALL_VALUE_FAST_PATH()         \
+  uint8_t* buffer = (uint8_t*)output;                 \
+  if (integer < 0x80u) {                              \
+    if (output_size_bytes == 0u) {                    \
+      return 0u;                                      \
+    }                                                 \
+    buffer[0] = (uint8_t)integer;                     \
+    return 1u;                                        \
+  }                                                   \
+  if (integer < 0x4000u) {                            \
+    if (output_size_bytes < 2u) {                     \
+      return 0u;                                      \
+    }                                                 \
+    buffer[0] = (uint8_t)(integer | 0x80u);           \
+    buffer[1] = (uint8_t)(integer >> 7);              \
+    return 2u;                                        \
+  }
+
 #define VARINT_ENCODE_FUNCTION_BODY(bits)                        \
   size_t written = 0;                                            \
-  uint8_t* buffer = (uint8_t*)output;                            \
                                                                  \
   do {                                                           \
     if (written >= output_size_bytes) {                          \
@@ -31,12 +51,14 @@
 size_t pw_varint_Encode32(uint32_t integer,
                           void* output,
                           size_t output_size_bytes) {
+  VARINT_ENCODE_SMALL_VALUE_FAST_PATH();
   VARINT_ENCODE_FUNCTION_BODY(32);
 }
 
 size_t pw_varint_Encode64(uint64_t integer,
                           void* output,
                           size_t output_size_bytes) {
+  VARINT_ENCODE_SMALL_VALUE_FAST_PATH();
   VARINT_ENCODE_FUNCTION_BODY(64);
 }
 
@@ -45,6 +67,12 @@ size_t pw_varint_Encode64(uint64_t integer,
   size_t count = 0;                                                           \
   const uint8_t* buffer = (const uint8_t*)(input);                            \
                                                                               \
+  /* Single-byte fast path. */                                                \
+  if (input_size_bytes != 0u && buffer[0] < 0x80u) {                          \
+    *output = buffer[0];                                                      \
+    return 1u;                                                                \
+  }                                                                           \
+                                                                              \
   /* Only read to the end of the buffer or largest possible encoded size. */  \
   const size_t max_count =                                                    \
       input_size_bytes < PW_VARINT_MAX_INT##bits##_SIZE_BYTES                 \
@@ -0,0 +1,145 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_work_queue/load_shedder.h"
+
+#include "pw_sync/thread_notification.h"
+#include "pw_thread/thread.h"
+#include "pw_unit_test/framework.h"
+#include "pw_work_queue/test_thread.h"
+#include "pw_work_queue/work_queue.h"
+
+namespace pw::work_queue {
+namespace {
+
+TEST(LoadShedder, CoalescesRepeatedClassesToNewestPayload) {
+  struct {
+    int runs = 0;
+    int last_payload = 0;
+    sync::ThreadNotification done;
+  } context;
+
+  WorkQueueWithBuffer<10> work_queue;
+  LoadShedder<4, 4> shedder(work_queue);
+
+  // Push three refresh requests of the same class before the worker starts:
+  // they must collapse to one execution of the newest payload.
+  ASSERT_EQ(shedder.PushCoalesced(/* coalesce_class= */ 7,
+                                  [&context] {
+                                    context.runs += 1;
+                                    context.last_payload = 1;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  ASSERT_EQ(shedder.PushCoalesced(7,
+                                  [&context] {
+                                    context.runs += 1;
+                                    context.last_payload = 2;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  ASSERT_EQ(shedder.PushCoalesced(7,
+                                  [&context] {
+                                    context.runs += 1;
+                                    context.last_payload = 3;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  EXPECT_EQ(shedder.coalesced_shed_count(), 2u);
+
+  Thread work_thread(test::WorkQueueThreadOptions(), work_queue);
+  context.done.acquire();
+  work_queue.RequestStop();
+  work_thread.join();
+
+  EXPECT_EQ(context.runs, 1);
+  EXPECT_EQ(context.last_payload, 3);  // The newest request won.
+}
+
+TEST(LoadShedder, ClassesRunIndependentlyAndRepeatAfterExecution) {
+  struct {
+    int class_a_runs = 0;
+    int class_b_runs = 0;
+    sync::ThreadNotification done;
+  } context;
+
+  WorkQueueWithBuffer<10> work_queue;
+  LoadShedder<4, 4> shedder(work_queue);
+  Thread work_thread(test::WorkQueueThreadOptions(), work_queue);
+
+  ASSERT_EQ(shedder.PushCoalesced(1,
+                                  [&context] { context.class_a_runs += 1; }),
+            OkStatus());
+  ASSERT_EQ(shedder.PushCoalesced(2,
+                                  [&context] {
+                                    context.class_b_runs += 1;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  context.done.acquire();
+
+  // After execution the class is pushable again.
+  ASSERT_EQ(shedder.PushCoalesced(1,
+                                  [&context] {
+                                    context.class_a_runs += 1;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  context.done.acquire();
+  work_queue.RequestStop();
+  work_thread.join();
+
+  EXPECT_EQ(context.class_a_runs, 2);
+  EXPECT_EQ(context.class_b_runs, 1);
+}
+
+TEST(LoadShedder, QuotaBoundsOutstandingItemsPerProducer) {
+  WorkQueueWithBuffer<10> work_queue;
+  LoadShedder<2, 8> shedder(work_queue);
+  QuotaToken noisy_producer(/* max_outstanding= */ 2);
+
+  struct {
+    int runs = 0;
+    sync::ThreadNotification done;
+  } context;
+
+  // With no worker running, the third push exceeds the quota and is shed.
+  ASSERT_EQ(shedder.PushWithQuota(noisy_producer,
+                                  [&context] { context.runs += 1; }),
+            OkStatus());
+  ASSERT_EQ(shedder.PushWithQuota(noisy_producer,
+                                  [&context] {
+                                    context.runs += 1;
+                                    context.done.release();
+                                  }),
+            OkStatus());
+  EXPECT_EQ(shedder.PushWithQuota(noisy_producer, [] {}),
+            Status::ResourceExhausted());
+  EXPECT_EQ(noisy_producer.shed_count(), 1u);
+  EXPECT_EQ(noisy_producer.outstanding(), 2u);
+
+  Thread work_thread(test::WorkQueueThreadOptions(), work_queue);
+  context.done.acquire();
+  work_queue.RequestStop();
+  work_thread.join();
+
+  EXPECT_EQ(context.runs, 2);
+  EXPECT_EQ(noisy_producer.outstanding(), 0u);
+
+  // Quota recovers once items complete.
+  EXPECT_EQ(shedder.quota_shed_count(), 1u);
+}
+
+}  // namespace
+}  // namespace pw::work_queue
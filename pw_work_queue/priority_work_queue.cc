@@ -0,0 +1,94 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+
+#include "pw_work_queue/priority_work_queue.h"
+
+#include <mutex>
+#include <optional>
+
+#include "pw_assert/check.h"
+
+namespace pw::work_queue {
+
+Status PriorityWorkQueue::PushWork(size_t lane, WorkItem&& work_item) {
+  PW_CHECK_UINT_LT(lane, lanes_.size());
+  {
+    std::lock_guard lock(lock_);
+
+    if (stop_requested_) {
+      // Entries are not permitted to be enqueued once stop has been requested.
+      return Status::FailedPrecondition();
+    }
+
+    if (lanes_[lane]->full()) {
+      return Status::ResourceExhausted();
+    }
+
+    lanes_[lane]->emplace(std::move(work_item));
+  }  // Release lock before calling .release() on the semaphore.
+  work_semaphore_.release();
+  return OkStatus();
+}
+
+void PriorityWorkQueue::CheckPushWork(size_t lane, WorkItem&& work_item) {
+  PW_CHECK_OK(PushWork(lane, std::move(work_item)),
+              "Failed to push work item into the work queue");
+}
+
+void PriorityWorkQueue::RequestStop() {
+  {
+    std::lock_guard lock(lock_);
+    stop_requested_ = true;
+  }  // Release lock before calling .release() on the semaphore.
+  work_semaphore_.release();
+}
+
+void PriorityWorkQueue::Run() {
+  while (true) {
+    // The semaphore is released once per queued work item, so each wakeup
+    // corresponds to (at most) one item to process.
+    work_semaphore_.acquire();
+
+    std::optional<WorkItem> possible_work_item;
+    bool stop_requested;
+    {
+      std::lock_guard lock(lock_);
+      // Pop from the highest-priority lane with queued work.
+      for (InlineQueue<WorkItem>* lane : lanes_) {
+        if (!lane->empty()) {
+          possible_work_item.emplace(std::move(lane->front()));
+          lane->pop();
+          break;
+        }
+      }
+      stop_requested = stop_requested_;
+    }
+
+    if (possible_work_item.has_value()) {
+      WorkItem& work_item = possible_work_item.value();
+      PW_CHECK(work_item != nullptr);
+      work_item();
+      continue;
+    }
+
+    // Woken with no work: this is the stop signal. Pass it along so any other
+    // workers running this queue wake up and exit as well.
+    if (stop_requested) {
+      work_semaphore_.release();
+      return;
+    }
+  }
+}
+
+}  // namespace pw::work_queue
@@ -0,0 +1,223 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+/// @file pw_work_queue/load_shedder.h
+///
+/// Graceful degradation for work queues under overload. `CheckPushWork`
+/// crashes on a full queue and `PushWork` fails silently; during a sensor
+/// storm neither keeps the system responsive. `LoadShedder` is a front end
+/// that sheds load *before* the queue fills:
+///
+/// - Coalescable work (e.g. display refresh requests) is pushed with a class
+///   id: while one item of a class is pending, further pushes of that class
+///   replace its payload instead of queueing again, so N requests collapse
+///   to one execution of the newest.
+/// - Producers with a quota get a bounded number of outstanding items;
+///   pushes beyond the quota are shed with a counted error instead of
+///   consuming the queue capacity other producers need.
+///
+/// Shed counts are exposed via pw_metric alongside the queue's existing
+/// depth watermarks, so overload is observable rather than fatal.
+
+#include <atomic>
+#include <cstdint>
+
+#include "pw_function/function.h"
+#include "pw_metric/metric.h"
+#include "pw_status/status.h"
+#include "pw_sync/interrupt_spin_lock.h"
+#include "pw_work_queue/work_queue.h"
+
+namespace pw::work_queue {
+
+/// Per-producer quota handle. Create one per producer (e.g. per sensor
+/// driver) and pass it to `LoadShedder::PushWithQuota`.
+class QuotaToken {
+ public:
+  explicit constexpr QuotaToken(size_t max_outstanding)
+      : max_outstanding_(max_outstanding) {}
+
+  /// Items currently queued or executing for this producer.
+  size_t outstanding() const {
+    return outstanding_.load(std::memory_order_relaxed);
+  }
+
+  /// Pushes shed because the producer was at quota.
+  uint32_t shed_count() const {
+    return shed_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  template <size_t, size_t>
+  friend class LoadShedder;
+
+  const size_t max_outstanding_;
+  std::atomic<size_t> outstanding_{0};
+  std::atomic<uint32_t> shed_{0};
+};
+
+/// Load-shedding front end over a `WorkQueue`, tracking up to `kMaxClasses`
+/// coalescable classes and `kMaxQuotaItems` in-flight quota items.
+template <size_t kMaxClasses, size_t kMaxQuotaItems>
+class LoadShedder {
+ public:
+  explicit LoadShedder(WorkQueue& queue) : queue_(queue) {}
+
+  /// Pushes coalescable work. While an item of `coalesce_class` is pending,
+  /// further pushes replace its payload -- the newest request runs once --
+  /// and are counted as shed. Returns the queue's error if the underlying
+  /// push fails, or RESOURCE_EXHAUSTED if the class table is full.
+  Status PushCoalesced(uint32_t coalesce_class, Function<void()>&& work) {
+    ClassSlot* slot = nullptr;
+    {
+      std::lock_guard lock(lock_);
+      slot = FindOrAllocateClass(coalesce_class);
+      if (slot == nullptr) {
+        return Status::ResourceExhausted();
+      }
+      if (slot->pending) {
+        // Collapse: the queued wrapper will run the newest payload.
+        slot->work = std::move(work);
+        coalesced_shed_.Increment();
+        return OkStatus();
+      }
+      slot->work = std::move(work);
+      slot->pending = true;
+    }
+
+    slot->owner = this;
+    // The wrapper captures a single pointer: WorkItem's inline storage only
+    // fits one word.
+    const Status status =
+        queue_.PushWork([slot] { slot->owner->RunCoalesced(*slot); });
+    if (!status.ok()) {
+      std::lock_guard lock(lock_);
+      slot->pending = false;
+    }
+    return status;
+  }
+
+  /// Pushes work subject to the producer's quota. Sheds (with
+  /// RESOURCE_EXHAUSTED and a counted drop) when the producer already has
+  /// its maximum outstanding items, keeping queue capacity available for
+  /// other producers during a storm.
+  Status PushWithQuota(QuotaToken& producer, Function<void()>&& work) {
+    if (producer.outstanding_.load(std::memory_order_relaxed) >=
+        producer.max_outstanding_) {
+      producer.shed_.fetch_add(1, std::memory_order_relaxed);
+      quota_shed_.Increment();
+      return Status::ResourceExhausted();
+    }
+
+    QuotaItem* item = nullptr;
+    {
+      std::lock_guard lock(lock_);
+      for (QuotaItem& candidate : quota_items_) {
+        if (!candidate.in_use) {
+          item = &candidate;
+          item->in_use = true;
+          break;
+        }
+      }
+    }
+    if (item == nullptr) {
+      quota_shed_.Increment();
+      return Status::ResourceExhausted();
+    }
+
+    item->work = std::move(work);
+    item->producer = &producer;
+    producer.outstanding_.fetch_add(1, std::memory_order_relaxed);
+
+    item->owner = this;
+    const Status status =
+        queue_.PushWork([item] { item->owner->RunQuotaItem(*item); });
+    if (!status.ok()) {
+      producer.outstanding_.fetch_sub(1, std::memory_order_relaxed);
+      std::lock_guard lock(lock_);
+      item->work = nullptr;
+      item->in_use = false;
+    }
+    return status;
+  }
+
+  /// Registers this shedder's metrics (coalesced and quota shed counts)
+  /// with the given group, alongside the queue's depth watermarks.
+  metric::Group& metrics() { return metrics_; }
+
+  uint32_t coalesced_shed_count() const { return coalesced_shed_.value(); }
+  uint32_t quota_shed_count() const { return quota_shed_.value(); }
+
+ private:
+  struct ClassSlot {
+    uint32_t coalesce_class = 0;
+    bool allocated = false;
+    bool pending = false;
+    LoadShedder* owner = nullptr;
+    Function<void()> work;
+  };
+
+  struct QuotaItem {
+    bool in_use = false;
+    QuotaToken* producer = nullptr;
+    LoadShedder* owner = nullptr;
+    Function<void()> work;
+  };
+
+  void RunCoalesced(ClassSlot& slot) {
+    Function<void()> to_run;
+    {
+      std::lock_guard lock(lock_);
+      to_run = std::move(slot.work);
+      slot.pending = false;
+    }
+    to_run();
+  }
+
+  void RunQuotaItem(QuotaItem& item) {
+    item.work();
+    item.producer->outstanding_.fetch_sub(1, std::memory_order_relaxed);
+    std::lock_guard lock(lock_);
+    item.work = nullptr;
+    item.in_use = false;
+  }
+
+  ClassSlot* FindOrAllocateClass(uint32_t coalesce_class) {
+    for (ClassSlot& slot : class_slots_) {
+      if (slot.allocated && slot.coalesce_class == coalesce_class) {
+        return &slot;
+      }
+    }
+    for (ClassSlot& slot : class_slots_) {
+      if (!slot.allocated) {
+        slot.allocated = true;
+        slot.coalesce_class = coalesce_class;
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  WorkQueue& queue_;
+  sync::InterruptSpinLock lock_;
+  ClassSlot class_slots_[kMaxClasses];
+  QuotaItem quota_items_[kMaxQuotaItems];
+
+  PW_METRIC_GROUP(metrics_, "pw::work_queue::LoadShedder");
+  PW_METRIC(metrics_, coalesced_shed_, "coalesced_shed", 0u);
+  PW_METRIC(metrics_, quota_shed_, "quota_shed", 0u);
+};
+
+}  // namespace pw::work_queue
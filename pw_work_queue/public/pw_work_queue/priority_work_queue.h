@@ -0,0 +1,104 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "pw_containers/inline_queue.h"
+#include "pw_function/function.h"
+#include "pw_span/span.h"
+#include "pw_status/status.h"
+#include "pw_sync/counting_semaphore.h"
+#include "pw_sync/interrupt_spin_lock.h"
+#include "pw_sync/lock_annotations.h"
+#include "pw_thread/thread_core.h"
+
+namespace pw::work_queue {
+
+using WorkItem = Function<void()>;
+
+/// A work queue with fixed priority lanes. Work is pushed to a lane, and
+/// workers always execute the oldest item of the highest-priority non-empty
+/// lane, so latency-sensitive work is never queued behind bulk work. Items
+/// within a lane execute in FIFO order. As with `WorkQueue`, multiple worker
+/// threads may run the same queue concurrently.
+///
+/// There is no aging: a saturated high-priority lane starves lower lanes, so
+/// high-priority lanes should carry strictly bounded work. Deadline-based
+/// ordering within a lane is intentionally not provided; map coarse deadline
+/// classes onto lanes instead.
+class PriorityWorkQueue : public thread::ThreadCore {
+ public:
+  /// @param[in] lanes Queues for each priority lane, ordered from highest to
+  /// lowest priority. The pointers must remain valid for the lifetime of the
+  /// work queue.
+  ///
+  /// @note The `CountingSemaphore` prevents this from being `constexpr`.
+  explicit PriorityWorkQueue(span<InlineQueue<WorkItem>* const> lanes)
+      : stop_requested_(false), lanes_(lanes) {}
+
+  /// Enqueues a work item on the given priority lane (0 is the highest
+  /// priority).
+  ///
+  /// @returns @rst
+  ///
+  /// .. pw-status-codes::
+  ///
+  ///    OK: Success.
+  ///
+  ///    FAILED_PRECONDITION: The work queue is shutting down.
+  ///
+  ///    RESOURCE_EXHAUSTED: The lane's internal queue is full.
+  ///
+  /// @endrst
+  Status PushWork(size_t lane, WorkItem&& work_item) PW_LOCKS_EXCLUDED(lock_);
+
+  /// Queues work for execution, crashing if the work cannot be queued.
+  void CheckPushWork(size_t lane, WorkItem&& work_item)
+      PW_LOCKS_EXCLUDED(lock_);
+
+  /// Locks the queues to prevent further work enqueues, runs outstanding
+  /// work, then shuts down the worker threads.
+  void RequestStop() PW_LOCKS_EXCLUDED(lock_);
+
+  /// The number of priority lanes.
+  size_t lanes() const { return lanes_.size(); }
+
+ private:
+  void Run() override PW_LOCKS_EXCLUDED(lock_);
+
+  sync::InterruptSpinLock lock_;
+  bool stop_requested_ PW_GUARDED_BY(lock_);
+  const span<InlineQueue<WorkItem>* const> lanes_ PW_GUARDED_BY(lock_);
+  sync::CountingSemaphore work_semaphore_;
+};
+
+template <size_t kNumLanes, size_t kEntriesPerLane>
+class PriorityWorkQueueWithBuffer : public PriorityWorkQueue {
+ public:
+  PriorityWorkQueueWithBuffer() : PriorityWorkQueue(lane_pointers_) {
+    for (size_t i = 0; i < kNumLanes; ++i) {
+      lane_pointers_[i] = &queues_[i];
+    }
+  }
+
+ private:
+  static_assert(kNumLanes > 0);
+
+  std::array<InlineQueue<WorkItem, kEntriesPerLane>, kNumLanes> queues_;
+  std::array<InlineQueue<WorkItem>*, kNumLanes> lane_pointers_;
+};
+
+}  // namespace pw::work_queue
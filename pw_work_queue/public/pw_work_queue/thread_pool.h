@@ -0,0 +1,70 @@
+// Copyright 2025 The Pigweed Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not
+// use this file except in compliance with the License. You may obtain a copy of
+// the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+// License for the specific language governing permissions and limitations under
+// the License.
+#pragma once
+
+#include <cstddef>
+
+#include "pw_assert/assert.h"
+#include "pw_span/span.h"
+#include "pw_thread/thread.h"
+#include "pw_work_queue/work_queue.h"
+
+namespace pw::work_queue {
+
+/// Pooled executor: runs a `WorkQueue` (or `PriorityWorkQueue`) on a pool of
+/// threads, one per provided `thread::Options`.
+///
+/// Worker priorities come from the options, so deadline classes map onto
+/// worker priorities chosen by the integrator (e.g. one high-priority worker
+/// for latency-critical items alongside standard workers). Priority
+/// inheritance is the lock implementation's job -- pw_sync mutex backends on
+/// RTOSes with PI-aware mutexes provide it -- so the pool deliberately adds
+/// no inheritance machinery of its own.
+template <size_t kMaxThreads>
+class ThreadPool {
+ public:
+  explicit ThreadPool(WorkQueue& queue) : queue_(queue) {}
+
+  ~ThreadPool() { Stop(); }
+
+  /// Starts one worker per option. May only be called once.
+  void Start(span<const thread::Options* const> options) {
+    PW_ASSERT(thread_count_ == 0);
+    PW_ASSERT(options.size() <= kMaxThreads);
+    for (const thread::Options* thread_options : options) {
+      threads_[thread_count_++] = thread::Thread(*thread_options, queue_);
+    }
+  }
+
+  /// Stops the queue after it drains and joins all workers.
+  void Stop() {
+    if (thread_count_ == 0) {
+      return;
+    }
+    queue_.RequestStop();
+    for (size_t i = 0; i < thread_count_; ++i) {
+      threads_[i].join();
+    }
+    thread_count_ = 0;
+  }
+
+  size_t thread_count() const { return thread_count_; }
+
+ private:
+  WorkQueue& queue_;
+  thread::Thread threads_[kMaxThreads];
+  size_t thread_count_ = 0;
+};
+
+}  // namespace pw::work_queue
@@ -24,7 +24,7 @@
 #include "pw_status/status.h"
 #include "pw_sync/interrupt_spin_lock.h"
 #include "pw_sync/lock_annotations.h"
-#include "pw_sync/thread_notification.h"
+#include "pw_sync/counting_semaphore.h"
 #include "pw_thread/thread_core.h"
 
 namespace pw::work_queue {
@@ -47,6 +47,11 @@ using WorkItem = Function<void()>;
 /// Once a stop has been requested the queue will no longer accept further work.
 ///
 /// The entire API is thread-safe and interrupt-safe.
+/// Multiple worker threads may run the same `WorkQueue` concurrently (e.g. by
+/// constructing several threads with the same `WorkQueue` as the
+/// `ThreadCore`). Each queued work item is executed by exactly one worker, so
+/// independent items run in parallel. `RequestStop()` stops all workers after
+/// the queue drains.
 class WorkQueue : public thread::ThreadCore {
  public:
   /// @param[in] queue The work entries to enqueue.
@@ -54,7 +59,7 @@ class WorkQueue : public thread::ThreadCore {
   /// @param[in] queue_capacity The internal queue size which limits the number
   /// of outstanding work requests.
   ///
-  /// @note The `ThreadNotification` prevents this from being `constexpr`.
+  /// @note The `CountingSemaphore` prevents this from being `constexpr`.
   WorkQueue(InlineQueue<WorkItem>& queue, size_t queue_capacity)
       : stop_requested_(false), queue_(queue) {
     min_queue_remaining_.Set(static_cast<uint32_t>(queue_capacity));
@@ -111,7 +116,7 @@ class WorkQueue : public thread::ThreadCore {
   sync::InterruptSpinLock lock_;
   bool stop_requested_ PW_GUARDED_BY(lock_);
   InlineQueue<WorkItem>& queue_ PW_GUARDED_BY(lock_);
-  sync::ThreadNotification work_notification_;
+  sync::CountingSemaphore work_semaphore_;
 
   // TODO(ewout): The group and/or its name token should be passed as a ctor
   // arg instead. Depending on the approach here the group should be exposed
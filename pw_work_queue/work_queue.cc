@@ -25,37 +25,37 @@ void WorkQueue::RequestStop() {
     std::lock_guard lock(lock_);
     stop_requested_ = true;
   }  // Release lock before calling .release() on the semaphore.
-  work_notification_.release();
+  work_semaphore_.release();
 }
 
 void WorkQueue::Run() {
   while (true) {
-    work_notification_.acquire();
+    // The semaphore is released once per queued work item, so with multiple
+    // workers each wakeup corresponds to (at most) one item to process.
+    work_semaphore_.acquire();
 
-    // Drain the work queue.
+    std::optional<WorkItem> possible_work_item;
     bool stop_requested;
-    bool work_remaining;
-    do {
-      std::optional<WorkItem> possible_work_item;
-      {
-        std::lock_guard lock(lock_);
-        if (!queue_.empty()) {
-          possible_work_item.emplace(std::move(queue_.front()));
-          queue_.pop();
-        }
-        work_remaining = !queue_.empty();
-        stop_requested = stop_requested_;
-      }
-      if (!possible_work_item.has_value()) {
-        continue;  // No work item to process.
+    {
+      std::lock_guard lock(lock_);
+      if (!queue_.empty()) {
+        possible_work_item.emplace(std::move(queue_.front()));
+        queue_.pop();
       }
+      stop_requested = stop_requested_;
+    }
+
+    if (possible_work_item.has_value()) {
       WorkItem& work_item = possible_work_item.value();
       PW_CHECK(work_item != nullptr);
       work_item();
-    } while (work_remaining);
+      continue;
+    }
 
-    // Queue was drained, return if we've been requested to stop.
+    // Woken with no work: this is the stop signal. Pass it along so any other
+    // workers running this queue wake up and exit as well.
     if (stop_requested) {
+      work_semaphore_.release();
       return;
     }
   }
@@ -91,7 +91,7 @@ Status WorkQueue::InternalPushWork(WorkItem&& work_item) {
       min_queue_remaining_.Set(queue_entries);
     }
   }  // Release lock before calling .release() on the semaphore.
-  work_notification_.release();
+  work_semaphore_.release();
   return OkStatus();
 }
 